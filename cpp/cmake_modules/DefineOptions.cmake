@@ -106,6 +106,15 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
                        "AVX2"
                        "AVX512")
 
+  define_option_string(ARROW_RUNTIME_SIMD_LEVEL
+                       "Max runtime SIMD optimization level"
+                       "MAX" # default to max supported by compiler
+                       "NONE"
+                       "SSE4_2"
+                       "AVX2"
+                       "AVX512"
+                       "MAX")
+
   # Arm64 architectures and extensions can lead to exploding combinations.
   # So set it directly through cmake command line.
   define_option_string(ARROW_ARMV8_ARCH
@@ -224,6 +233,10 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
 
   define_option(ARROW_MIMALLOC "Build the Arrow mimalloc-based allocator" OFF)
 
+  define_option(ARROW_NUMA
+                "Build the NUMA-aware memory pool and CPU thread pools (requires libnuma)"
+                OFF)
+
   define_option(ARROW_PARQUET "Build the Parquet libraries" OFF)
 
   define_option(ARROW_ORC "Build the Arrow ORC adapter" OFF)
@@ -291,6 +304,10 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
   define_option(ARROW_USE_GLOG "Build libraries with glog support for pluggable logging"
                 OFF)
 
+  define_option(ARROW_WITH_RE2
+                "Build with regular expression support in compute kernels using re2"
+                OFF)
+
   define_option(ARROW_WITH_BROTLI "Build with Brotli compression" OFF)
   define_option(ARROW_WITH_BZ2 "Build with BZ2 compression" OFF)
   define_option(ARROW_WITH_LZ4 "Build with lz4 compression" OFF)
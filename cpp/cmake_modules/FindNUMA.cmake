@@ -0,0 +1,59 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+# Tries to find libnuma, the Linux NUMA policy library.
+#
+# Usage of this module as follows:
+#
+#  find_package(NUMA)
+#
+# Variables used by this module, they can change the default behaviour and need
+# to be set before calling find_package:
+#
+#  NUMA_ROOT - When set, this path is inspected instead of standard library
+#              locations as the root of the libnuma installation.
+#
+# This module defines
+#  NUMA_INCLUDE_DIR, directory containing headers
+#  NUMA_LIB, path to libnuma
+#  NUMA_FOUND, whether libnuma has been found
+#  NUMA::numa, imported target
+
+if(NUMA_ROOT)
+  find_library(NUMA_LIB
+               NAMES numa
+               PATHS ${NUMA_ROOT}
+               PATH_SUFFIXES ${LIB_PATH_SUFFIXES}
+               NO_DEFAULT_PATH)
+  find_path(NUMA_INCLUDE_DIR
+            NAMES numa.h numaif.h
+            PATHS ${NUMA_ROOT}
+            NO_DEFAULT_PATH
+            PATH_SUFFIXES ${INCLUDE_PATH_SUFFIXES})
+else()
+  find_library(NUMA_LIB NAMES numa PATH_SUFFIXES ${LIB_PATH_SUFFIXES})
+  find_path(NUMA_INCLUDE_DIR NAMES numa.h numaif.h PATH_SUFFIXES ${INCLUDE_PATH_SUFFIXES})
+endif()
+
+find_package_handle_standard_args(NUMA REQUIRED_VARS NUMA_LIB NUMA_INCLUDE_DIR)
+
+if(NUMA_FOUND)
+  add_library(NUMA::numa UNKNOWN IMPORTED)
+  set_target_properties(NUMA::numa
+                        PROPERTIES IMPORTED_LOCATION "${NUMA_LIB}"
+                                   INTERFACE_INCLUDE_DIRECTORIES "${NUMA_INCLUDE_DIR}")
+endif()
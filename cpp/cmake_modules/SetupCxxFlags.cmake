@@ -325,6 +325,17 @@ if(ARROW_CPU_FLAG STREQUAL "x86" AND ARROW_USE_SIMD)
     set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} ${ARROW_SSE4_2_FLAG}")
     add_definitions(-DARROW_HAVE_SSE4_2)
   endif()
+
+  # Some kernels are additionally built for the instruction sets up to
+  # ARROW_RUNTIME_SIMD_LEVEL, and the best one the CPU supports is picked at runtime
+  if(CXX_SUPPORTS_AVX2 AND ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX2|AVX512|MAX)$")
+    set(ARROW_HAVE_RUNTIME_AVX2 ON)
+    add_definitions(-DARROW_HAVE_RUNTIME_AVX2)
+  endif()
+  if(CXX_SUPPORTS_AVX512 AND ARROW_RUNTIME_SIMD_LEVEL MATCHES "^(AVX512|MAX)$")
+    set(ARROW_HAVE_RUNTIME_AVX512 ON)
+    add_definitions(-DARROW_HAVE_RUNTIME_AVX512)
+  endif()
 endif()
 
 if(ARROW_CPU_FLAG STREQUAL "ppc" AND ARROW_USE_SIMD)
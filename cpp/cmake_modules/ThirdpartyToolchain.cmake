@@ -1411,6 +1411,14 @@ if(ARROW_MIMALLOC)
   add_dependencies(toolchain mimalloc_ep)
 endif()
 
+# ----------------------------------------------------------------------
+# libnuma - NUMA policy library, only available from the system
+
+if(ARROW_NUMA)
+  find_package(NUMA REQUIRED)
+  include_directories(SYSTEM ${NUMA_INCLUDE_DIR})
+endif()
+
 # ----------------------------------------------------------------------
 # Google gtest
 
@@ -1871,7 +1879,7 @@ if(ARROW_WITH_ZSTD)
 endif()
 
 # ----------------------------------------------------------------------
-# RE2 (required for Gandiva)
+# RE2 (required for Gandiva and for the regular expression kernels)
 
 macro(build_re2)
   message(STATUS "Building re2 from source")
@@ -1898,7 +1906,7 @@ macro(build_re2)
   add_dependencies(RE2::re2 re2_ep)
 endmacro()
 
-if(ARROW_GANDIVA)
+if(ARROW_WITH_RE2 OR ARROW_GANDIVA)
   resolve_dependency(RE2)
 
   # TODO: Don't use global includes but rather target_include_directories
@@ -19,6 +19,7 @@
 #include "arrow/adapters/orc/adapter_util.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -27,6 +28,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/io/interfaces.h"
@@ -43,10 +45,13 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/range.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/Exceptions.hh"
 #include "orc/OrcFile.hh"
+#include "orc/sargs/SearchArgument.hh"
 
 // alias to not interfere with nested orc namespace
 namespace liborc = orc;
@@ -106,6 +111,333 @@ class ArrowInputFile : public liborc::InputStream {
   std::shared_ptr<io::RandomAccessFile> file_;
 };
 
+ORCSearchArgument ORCSearchArgument::And(std::vector<ORCSearchArgument> children) {
+  ORCSearchArgument out;
+  out.kind = AND;
+  out.children = std::move(children);
+  return out;
+}
+
+ORCSearchArgument ORCSearchArgument::Or(std::vector<ORCSearchArgument> children) {
+  ORCSearchArgument out;
+  out.kind = OR;
+  out.children = std::move(children);
+  return out;
+}
+
+ORCSearchArgument ORCSearchArgument::Not(ORCSearchArgument child) {
+  ORCSearchArgument out;
+  out.kind = NOT;
+  out.children.push_back(std::move(child));
+  return out;
+}
+
+static ORCSearchArgument MakeLeaf(ORCSearchArgument::Kind kind, std::string column,
+                                  ScalarVector values) {
+  ORCSearchArgument out;
+  out.kind = kind;
+  out.column = std::move(column);
+  out.values = std::move(values);
+  return out;
+}
+
+ORCSearchArgument ORCSearchArgument::Equal(std::string column,
+                                           std::shared_ptr<Scalar> value) {
+  return MakeLeaf(EQUAL, std::move(column), {std::move(value)});
+}
+
+ORCSearchArgument ORCSearchArgument::LessThan(std::string column,
+                                              std::shared_ptr<Scalar> value) {
+  return MakeLeaf(LESS_THAN, std::move(column), {std::move(value)});
+}
+
+ORCSearchArgument ORCSearchArgument::LessThanEqual(std::string column,
+                                                   std::shared_ptr<Scalar> value) {
+  return MakeLeaf(LESS_THAN_EQUAL, std::move(column), {std::move(value)});
+}
+
+ORCSearchArgument ORCSearchArgument::IsNull(std::string column) {
+  return MakeLeaf(IS_NULL, std::move(column), {});
+}
+
+ORCSearchArgument ORCSearchArgument::In(std::string column, ScalarVector values) {
+  return MakeLeaf(IN, std::move(column), std::move(values));
+}
+
+// Whether a floating point value lies within the range of the integers backing `type`,
+// as converting one which does not to that integer is undefined
+static bool FitsIntegerRange(double value, const DataType& type) {
+  if (!is_primitive(type.id()) || is_floating(type.id()) || type.id() == Type::NA ||
+      type.id() == Type::BOOL) {
+    return true;
+  }
+  const int bit_width = checked_cast<const FixedWidthType&>(type).bit_width();
+  const bool is_signed =
+      !is_integer(type.id()) || checked_cast<const IntegerType&>(type).is_signed();
+  const double upper = std::ldexp(1.0, is_signed ? bit_width - 1 : bit_width);
+  const double lower = is_signed ? -upper : 0.0;
+  return value >= lower && value < upper;
+}
+
+static Result<double> AsDouble(const Scalar& value) {
+  ARROW_ASSIGN_OR_RAISE(auto as_double, value.CastTo(float64()));
+  return checked_cast<const DoubleScalar&>(*as_double).value;
+}
+
+Result<std::shared_ptr<Scalar>> ORCSearchArgument::CastLiteral(
+    const std::shared_ptr<Scalar>& value, const std::shared_ptr<DataType>& type) {
+  if (value->type->Equals(*type)) {
+    return value;
+  }
+  auto not_representable = [&] {
+    return Status::Invalid("ORC search argument literal ", value->ToString(),
+                           " is not representable as ", *type);
+  };
+  if (value->is_valid && is_floating(value->type->id())) {
+    ARROW_ASSIGN_OR_RAISE(auto as_double, AsDouble(*value));
+    if (!FitsIntegerRange(as_double, *type)) {
+      return not_representable();
+    }
+  }
+  // Scalar::CastTo narrows numbers with a static_cast, so a literal which was wrapped or
+  // truncated would compare against the wrong value; it must survive the round trip
+  ARROW_ASSIGN_OR_RAISE(auto cast, value->CastTo(type));
+  ARROW_ASSIGN_OR_RAISE(auto round_trip, cast->CastTo(value->type));
+  if (!round_trip->Equals(*value)) {
+    return not_representable();
+  }
+  if (value->is_valid && is_integer(value->type->id()) && is_integer(type->id())) {
+    // ... which doesn't reveal a sign flipped by an integer of the other signedness
+    ARROW_ASSIGN_OR_RAISE(auto before, AsDouble(*value));
+    ARROW_ASSIGN_OR_RAISE(auto after, AsDouble(*cast));
+    if ((before < 0) != (after < 0)) {
+      return not_representable();
+    }
+  }
+  return cast;
+}
+
+std::string ORCSearchArgument::ToString() const {
+  auto join_children = [this](const std::string& name) {
+    std::string out = name + "(";
+    for (size_t i = 0; i < children.size(); ++i) {
+      out += (i == 0 ? "" : ", ") + children[i].ToString();
+    }
+    return out + ")";
+  };
+  auto value_string = [this](size_t i) {
+    return i < values.size() && values[i] != nullptr ? values[i]->ToString() : "null";
+  };
+
+  switch (kind) {
+    case AND:
+      return join_children("and");
+    case OR:
+      return join_children("or");
+    case NOT:
+      return join_children("not");
+    case EQUAL:
+      return column + " == " + value_string(0);
+    case LESS_THAN:
+      return column + " < " + value_string(0);
+    case LESS_THAN_EQUAL:
+      return column + " <= " + value_string(0);
+    case IS_NULL:
+      return column + " is null";
+    case IN: {
+      std::string out = column + " in [";
+      for (size_t i = 0; i < values.size(); ++i) {
+        out += (i == 0 ? "" : ", ") + value_string(i);
+      }
+      return out + "]";
+    }
+  }
+  return "";
+}
+
+Status GetPredicateDataType(const DataType& type, liborc::PredicateDataType* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::PredicateDataType::BOOLEAN;
+      break;
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+      *out = liborc::PredicateDataType::LONG;
+      break;
+    case Type::FLOAT:
+    case Type::DOUBLE:
+      *out = liborc::PredicateDataType::FLOAT;
+      break;
+    case Type::STRING:
+      *out = liborc::PredicateDataType::STRING;
+      break;
+    case Type::DATE32:
+      *out = liborc::PredicateDataType::DATE;
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::PredicateDataType::TIMESTAMP;
+      break;
+    case Type::DECIMAL:
+      *out = liborc::PredicateDataType::DECIMAL;
+      break;
+    default:
+      return Status::NotImplemented("ORC search arguments on columns of type ", type);
+  }
+  return Status::OK();
+}
+
+template <typename ScalarType>
+int64_t IntegerValue(const Scalar& scalar) {
+  return static_cast<int64_t>(checked_cast<const ScalarType&>(scalar).value);
+}
+
+Status GetLiteral(const std::shared_ptr<Scalar>& value,
+                  const std::shared_ptr<DataType>& type, liborc::Literal* out) {
+  if (!value->is_valid) {
+    return Status::Invalid("ORC search argument literals must not be null");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto cast, ORCSearchArgument::CastLiteral(value, type));
+  const Scalar& scalar = *cast;
+
+  switch (type->id()) {
+    case Type::BOOL:
+      *out = liborc::Literal(checked_cast<const BooleanScalar&>(scalar).value);
+      break;
+    case Type::INT8:
+      *out = liborc::Literal(IntegerValue<Int8Scalar>(scalar));
+      break;
+    case Type::INT16:
+      *out = liborc::Literal(IntegerValue<Int16Scalar>(scalar));
+      break;
+    case Type::INT32:
+      *out = liborc::Literal(IntegerValue<Int32Scalar>(scalar));
+      break;
+    case Type::INT64:
+      *out = liborc::Literal(IntegerValue<Int64Scalar>(scalar));
+      break;
+    case Type::FLOAT:
+      *out = liborc::Literal(
+          static_cast<double>(checked_cast<const FloatScalar&>(scalar).value));
+      break;
+    case Type::DOUBLE:
+      *out = liborc::Literal(checked_cast<const DoubleScalar&>(scalar).value);
+      break;
+    case Type::STRING: {
+      const auto& buffer = *checked_cast<const StringScalar&>(scalar).value;
+      *out = liborc::Literal(reinterpret_cast<const char*>(buffer.data()),
+                             static_cast<size_t>(buffer.size()));
+      break;
+    }
+    case Type::DATE32:
+      *out = liborc::Literal(liborc::PredicateDataType::DATE,
+                             IntegerValue<Date32Scalar>(scalar));
+      break;
+    case Type::TIMESTAMP: {
+      int64_t seconds, nanos;
+      SplitTimestamp(checked_cast<const TimestampScalar&>(scalar).value,
+                     checked_cast<const TimestampType&>(*type).unit(), &seconds, &nanos);
+      *out = liborc::Literal(seconds, static_cast<int32_t>(nanos));
+      break;
+    }
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(*type);
+      const auto& decimal = checked_cast<const Decimal128Scalar&>(scalar).value;
+      *out = liborc::Literal(liborc::Int128(decimal.high_bits(), decimal.low_bits()),
+                             decimal_type.precision(), decimal_type.scale());
+      break;
+    }
+    default:
+      return Status::NotImplemented("ORC search argument literal of type ", *type);
+  }
+  return Status::OK();
+}
+
+Status BuildSearchArgument(const ORCSearchArgument& sarg, const Schema& schema,
+                           liborc::SearchArgumentBuilder* builder) {
+  switch (sarg.kind) {
+    case ORCSearchArgument::AND:
+    case ORCSearchArgument::OR:
+    case ORCSearchArgument::NOT: {
+      if (sarg.children.empty() ||
+          (sarg.kind == ORCSearchArgument::NOT && sarg.children.size() != 1)) {
+        return Status::Invalid("Malformed ORC search argument ", sarg.ToString());
+      }
+      if (sarg.kind == ORCSearchArgument::AND) {
+        builder->startAnd();
+      } else if (sarg.kind == ORCSearchArgument::OR) {
+        builder->startOr();
+      } else {
+        builder->startNot();
+      }
+      for (const auto& child : sarg.children) {
+        RETURN_NOT_OK(BuildSearchArgument(child, schema, builder));
+      }
+      builder->end();
+      return Status::OK();
+    }
+    default:
+      break;
+  }
+
+  auto field = schema.GetFieldByName(sarg.column);
+  if (field == nullptr) {
+    return Status::Invalid("ORC search argument column '", sarg.column,
+                           "' is not a top-level column of the file");
+  }
+  liborc::PredicateDataType type;
+  RETURN_NOT_OK(GetPredicateDataType(*field->type(), &type));
+
+  std::vector<liborc::Literal> literals;
+  for (const auto& value : sarg.values) {
+    if (value == nullptr) {
+      return Status::Invalid("Malformed ORC search argument ", sarg.ToString());
+    }
+    liborc::Literal literal(type);
+    RETURN_NOT_OK(GetLiteral(value, field->type(), &literal));
+    literals.push_back(std::move(literal));
+  }
+  const size_t expected_literals = sarg.kind == ORCSearchArgument::IS_NULL ? 0 : 1;
+  if (sarg.kind == ORCSearchArgument::IN ? literals.empty()
+                                         : literals.size() != expected_literals) {
+    return Status::Invalid("Malformed ORC search argument ", sarg.ToString());
+  }
+
+  switch (sarg.kind) {
+    case ORCSearchArgument::EQUAL:
+      builder->equals(sarg.column, type, literals[0]);
+      break;
+    case ORCSearchArgument::LESS_THAN:
+      builder->lessThan(sarg.column, type, literals[0]);
+      break;
+    case ORCSearchArgument::LESS_THAN_EQUAL:
+      builder->lessThanEquals(sarg.column, type, literals[0]);
+      break;
+    case ORCSearchArgument::IS_NULL:
+      builder->isNull(sarg.column, type);
+      break;
+    case ORCSearchArgument::IN:
+      builder->in(sarg.column, type, literals);
+      break;
+    default:
+      break;
+  }
+  return Status::OK();
+}
+
+// Account for a read of num_rows rows of which rows_read survived the search argument
+void UpdateStatistics(int64_t num_rows, int64_t rows_read,
+                      ORCReadStatistics* statistics) {
+  statistics->rows_read += rows_read;
+  statistics->rows_skipped += num_rows - rows_read;
+  if (rows_read > 0 || num_rows == 0) {
+    ++statistics->stripes_read;
+  } else {
+    ++statistics->stripes_skipped;
+  }
+}
+
 struct StripeInformation {
   uint64_t offset;
   uint64_t length;
@@ -113,22 +445,43 @@ struct StripeInformation {
   uint64_t first_row_of_stripe;
 };
 
-// The number of rows to read in a ColumnVectorBatch
-constexpr int64_t kReadRowsBatch = 1000;
+// Convert a top-level ORC struct batch to a RecordBatch. Where the layouts agree the
+// columns view the memory of batch rather than copying it.
+Status MakeRecordBatch(const liborc::Type& type,
+                       const std::shared_ptr<liborc::ColumnVectorBatch>& batch,
+                       const std::shared_ptr<Schema>& schema, MemoryPool* pool,
+                       std::shared_ptr<RecordBatch>* out) {
+  // The top-level type must be a struct to read into an arrow table
+  const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
+  const auto length = static_cast<int64_t>(batch->numElements);
+
+  std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); i++) {
+    RETURN_NOT_OK(ConvertBatch(type.getSubtype(i), struct_batch.fields[i], 0, length,
+                               schema->field(i)->type(), batch, pool, &columns[i]));
+  }
+
+  *out = RecordBatch::Make(schema, length, std::move(columns));
+  return Status::OK();
+}
 
 class OrcStripeReader : public RecordBatchReader {
  public:
   OrcStripeReader(std::unique_ptr<liborc::RowReader> row_reader,
-                  std::shared_ptr<Schema> schema, int64_t batch_size, MemoryPool* pool)
+                  std::shared_ptr<Schema> schema, int64_t batch_size, int64_t num_rows,
+                  std::shared_ptr<ORCReadStatistics> statistics, MemoryPool* pool)
       : row_reader_(std::move(row_reader)),
         schema_(schema),
         pool_(pool),
-        batch_size_{batch_size} {}
+        batch_size_{batch_size},
+        num_rows_(num_rows),
+        statistics_(std::move(statistics)) {}
 
   std::shared_ptr<Schema> schema() const override { return schema_; }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
-    std::unique_ptr<liborc::ColumnVectorBatch> batch;
+    // A fresh batch per call, since the returned RecordBatch may share its memory
+    std::shared_ptr<liborc::ColumnVectorBatch> batch;
     try {
       batch = row_reader_->createRowBatch(batch_size_);
     } catch (const liborc::ParseError& e) {
@@ -137,23 +490,16 @@ class OrcStripeReader : public RecordBatchReader {
 
     const liborc::Type& type = row_reader_->getSelectedType();
     if (!row_reader_->next(*batch)) {
+      if (!finished_) {
+        UpdateStatistics(num_rows_, rows_read_, statistics_.get());
+        finished_ = true;
+      }
       out->reset();
       return Status::OK();
     }
 
-    std::unique_ptr<RecordBatchBuilder> builder;
-    RETURN_NOT_OK(RecordBatchBuilder::Make(schema_, pool_, batch->numElements, &builder));
-
-    // The top-level type must be a struct to read into an arrow table
-    const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
-
-    for (int i = 0; i < builder->num_fields(); i++) {
-      RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
-                                batch->numElements, builder->GetField(i)));
-    }
-
-    RETURN_NOT_OK(builder->Flush(out));
-    return Status::OK();
+    rows_read_ += static_cast<int64_t>(batch->numElements);
+    return MakeRecordBatch(type, batch, schema_, pool_, out);
   }
 
  private:
@@ -161,11 +507,16 @@ class OrcStripeReader : public RecordBatchReader {
   std::shared_ptr<Schema> schema_;
   MemoryPool* pool_;
   int64_t batch_size_;
+  // The rows remaining in the stripe when reading started, and those read since
+  int64_t num_rows_;
+  int64_t rows_read_ = 0;
+  bool finished_ = false;
+  std::shared_ptr<ORCReadStatistics> statistics_;
 };
 
 class ORCFileReader::Impl {
  public:
-  Impl() {}
+  Impl() : statistics_(std::make_shared<ORCReadStatistics>()) {}
   ~Impl() {}
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool) {
@@ -290,6 +641,28 @@ class ORCFileReader::Impl {
     return ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
   }
 
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    std::shared_ptr<RecordBatch>* out) {
+    liborc::RowReaderOptions opts;
+    opts.include(std::list<std::string>(include_names.begin(), include_names.end()));
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+    return ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
+  }
+
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    std::shared_ptr<Table>* out) {
+    liborc::RowReaderOptions opts;
+    opts.include(std::list<std::string>(include_names.begin(), include_names.end()));
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    RETURN_NOT_OK(ReadBatches(opts, schema, stripes_[stripe].num_rows, &batches));
+    return Table::FromRecordBatches(schema, std::move(batches)).Value(out);
+  }
+
   Status SelectStripe(liborc::RowReaderOptions* opts, int64_t stripe) {
     ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
                     Status::Invalid("Out of bounds stripe: ", stripe));
@@ -329,10 +702,11 @@ class ORCFileReader::Impl {
   Status ReadTable(const liborc::RowReaderOptions& row_opts,
                    const std::shared_ptr<Schema>& schema, std::shared_ptr<Table>* out) {
     liborc::RowReaderOptions opts(row_opts);
-    std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    batches.reserve(stripes_.size());
     for (size_t stripe = 0; stripe < stripes_.size(); stripe++) {
       opts.range(stripes_[stripe].offset, stripes_[stripe].length);
-      RETURN_NOT_OK(ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]));
+      RETURN_NOT_OK(ReadBatches(opts, schema, stripes_[stripe].num_rows, &batches));
     }
     return Table::FromRecordBatches(schema, std::move(batches)).Value(out);
   }
@@ -340,28 +714,108 @@ class ORCFileReader::Impl {
   Status ReadBatch(const liborc::RowReaderOptions& opts,
                    const std::shared_ptr<Schema>& schema, int64_t nrows,
                    std::shared_ptr<RecordBatch>* out) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    RETURN_NOT_OK(ReadBatches(opts, schema, nrows, &batches));
+    if (batches.size() == 1) {
+      *out = std::move(batches[0]);
+      return Status::OK();
+    }
+
+    // Several stripes or runs of row groups were selected, or none at all. Callers
+    // which can consume a chunked result avoid this copy by reading a Table instead.
+    int64_t length = 0;
+    for (const auto& batch : batches) {
+      length += batch->num_rows();
+    }
+    std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+    for (int i = 0; i < schema->num_fields(); i++) {
+      if (batches.empty()) {
+        RETURN_NOT_OK(
+            MakeArrayOfNull(schema->field(i)->type(), 0, pool_).Value(&columns[i]));
+        continue;
+      }
+      std::vector<std::shared_ptr<Array>> chunks;
+      for (const auto& batch : batches) {
+        chunks.push_back(batch->column(i));
+      }
+      RETURN_NOT_OK(Concatenate(chunks, pool_, &columns[i]));
+    }
+    *out = RecordBatch::Make(schema, length, std::move(columns));
+    return Status::OK();
+  }
+
+  // Read a range of nrows rows, appending to out. liborc stops each batch at a
+  // stripe boundary and, with a search argument, at the end of each run of
+  // selected row groups.
+  Status ReadBatches(const liborc::RowReaderOptions& row_opts,
+                     const std::shared_ptr<Schema>& schema, int64_t nrows,
+                     std::vector<std::shared_ptr<RecordBatch>>* out) {
+    liborc::RowReaderOptions opts(row_opts);
+    RETURN_NOT_OK(ApplySearchArgument(&opts));
+
     std::unique_ptr<liborc::RowReader> row_reader;
-    std::unique_ptr<liborc::ColumnVectorBatch> batch;
     try {
       row_reader = reader_->createRowReader(opts);
-      batch = row_reader->createRowBatch(std::min(nrows, kReadRowsBatch));
     } catch (const liborc::ParseError& e) {
       return Status::Invalid(e.what());
     }
-    std::unique_ptr<RecordBatchBuilder> builder;
-    RETURN_NOT_OK(RecordBatchBuilder::Make(schema, pool_, nrows, &builder));
-
-    // The top-level type must be a struct to read into an arrow table
-    const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
-
     const liborc::Type& type = row_reader->getSelectedType();
-    while (row_reader->next(*batch)) {
-      for (int i = 0; i < builder->num_fields(); i++) {
-        RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
-                                  batch->numElements, builder->GetField(i)));
+
+    // Decode each stripe or run into a single batch, which the result can then
+    // view without another copy
+    int64_t rows_read = 0;
+    for (;;) {
+      std::shared_ptr<liborc::ColumnVectorBatch> batch;
+      try {
+        batch = row_reader->createRowBatch(std::max<int64_t>(nrows - rows_read, 1));
+        if (!row_reader->next(*batch)) {
+          break;
+        }
+      } catch (const liborc::ParseError& e) {
+        return Status::Invalid(e.what());
       }
+
+      std::shared_ptr<RecordBatch> record_batch;
+      RETURN_NOT_OK(MakeRecordBatch(type, batch, schema, pool_, &record_batch));
+      rows_read += record_batch->num_rows();
+      out->push_back(std::move(record_batch));
+    }
+
+    UpdateStatistics(nrows, rows_read, statistics_.get());
+    return Status::OK();
+  }
+
+  Status SetSearchArgument(const ORCSearchArgument& sarg) {
+    std::unique_ptr<ORCSearchArgument> previous = std::move(sarg_);
+    sarg_.reset(new ORCSearchArgument(sarg));
+    // Validate eagerly rather than on the next read
+    liborc::RowReaderOptions opts;
+    Status status = ApplySearchArgument(&opts);
+    if (!status.ok()) {
+      sarg_ = std::move(previous);
+    }
+    return status;
+  }
+
+  void ClearSearchArgument() { sarg_.reset(); }
+
+  ORCReadStatistics statistics() const { return *statistics_; }
+
+  // liborc consumes the SearchArgument it is given, so build one for each reader
+  Status ApplySearchArgument(liborc::RowReaderOptions* opts) {
+    if (sarg_ == nullptr) {
+      return Status::OK();
+    }
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(&schema));
+    try {
+      auto builder = liborc::SearchArgumentFactory::newBuilder();
+      RETURN_NOT_OK(BuildSearchArgument(*sarg_, *schema, builder.get()));
+      opts->searchArgument(builder->build());
+    } catch (const std::exception& e) {
+      return Status::Invalid("Could not build ORC search argument ", sarg_->ToString(),
+                             ": ", e.what());
     }
-    RETURN_NOT_OK(builder->Flush(out));
     return Status::OK();
   }
 
@@ -388,6 +842,10 @@ class ORCFileReader::Impl {
     RETURN_NOT_OK(SelectStripeWithRowNumber(&opts, current_row_, &stripe_info));
     std::shared_ptr<Schema> schema;
     RETURN_NOT_OK(ReadSchema(opts, &schema));
+    RETURN_NOT_OK(ApplySearchArgument(&opts));
+    const int64_t num_rows = static_cast<int64_t>(stripe_info.first_row_of_stripe +
+                                                  stripe_info.num_rows) -
+                             current_row_;
     std::unique_ptr<liborc::RowReader> row_reader;
     try {
       row_reader = reader_->createRowReader(opts);
@@ -397,8 +855,8 @@ class ORCFileReader::Impl {
       return Status::Invalid(e.what());
     }
 
-    *out = std::shared_ptr<RecordBatchReader>(
-        new OrcStripeReader(std::move(row_reader), schema, batch_size, pool_));
+    *out = std::shared_ptr<RecordBatchReader>(new OrcStripeReader(
+        std::move(row_reader), schema, batch_size, num_rows, statistics_, pool_));
     return Status::OK();
   }
 
@@ -411,6 +869,8 @@ class ORCFileReader::Impl {
   std::unique_ptr<liborc::Reader> reader_;
   std::vector<StripeInformation> stripes_;
   int64_t current_row_;
+  std::unique_ptr<ORCSearchArgument> sarg_;
+  std::shared_ptr<ORCReadStatistics> statistics_;
 };
 
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
@@ -456,6 +916,18 @@ Status ORCFileReader::ReadStripe(int64_t stripe, const std::vector<int>& include
   return impl_->ReadStripe(stripe, include_indices, out);
 }
 
+Status ORCFileReader::ReadStripe(int64_t stripe,
+                                 const std::vector<std::string>& include_names,
+                                 std::shared_ptr<RecordBatch>* out) {
+  return impl_->ReadStripe(stripe, include_names, out);
+}
+
+Status ORCFileReader::ReadStripe(int64_t stripe,
+                                 const std::vector<std::string>& include_names,
+                                 std::shared_ptr<Table>* out) {
+  return impl_->ReadStripe(stripe, include_names, out);
+}
+
 Status ORCFileReader::Seek(int64_t row_number) { return impl_->Seek(row_number); }
 
 Status ORCFileReader::NextStripeReader(int64_t batch_sizes,
@@ -469,10 +941,193 @@ Status ORCFileReader::NextStripeReader(int64_t batch_size,
   return impl_->NextStripeReader(batch_size, include_indices, out);
 }
 
+Status ORCFileReader::SetSearchArgument(const ORCSearchArgument& sarg) {
+  return impl_->SetSearchArgument(sarg);
+}
+
+void ORCFileReader::ClearSearchArgument() { impl_->ClearSearchArgument(); }
+
+ORCReadStatistics ORCFileReader::statistics() const { return impl_->statistics(); }
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+class ArrowOutputStream : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputStream(io::OutputStream* output_stream)
+      : output_stream_(output_stream) {}
+
+  uint64_t getLength() const override { return static_cast<uint64_t>(length_); }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(output_stream_->Write(buf, static_cast<int64_t>(length)));
+    length_ += static_cast<int64_t>(length);
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputFile");
+    return filename;
+  }
+
+  // The stream is owned by the caller of ORCFileWriter::Open
+  void close() override {}
+
+ private:
+  io::OutputStream* output_stream_;
+  int64_t length_ = 0;
+};
+
+Status GetOrcCompression(Compression::type compression, liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::LZO:
+      *out = liborc::CompressionKind_LZO;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    default:
+      return Status::Invalid("Compression codec ",
+                             util::Codec::GetCodecAsString(compression),
+                             " is not supported by ORC");
+  }
+  return Status::OK();
+}
+
+class ORCFileWriter::Impl {
+ public:
+  Status Open(const std::shared_ptr<Schema>& schema, io::OutputStream* output_stream,
+              const ORCWriterOptions& options) {
+    if (options.batch_size <= 0) {
+      return Status::Invalid("ORC write batch size must be positive");
+    }
+    schema_ = schema;
+    options_ = options;
+
+    RETURN_NOT_OK(GetOrcType(*schema, &type_));
+
+    liborc::WriterOptions orc_options;
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetOrcCompression(options.compression, &compression));
+    orc_options.setCompression(compression);
+    orc_options.setStripeSize(static_cast<uint64_t>(options.stripe_size));
+    orc_options.setRowIndexStride(static_cast<uint64_t>(options.row_index_stride));
+    orc_options.setCompressionBlockSize(
+        static_cast<uint64_t>(options.compression_block_size));
+
+    output_stream_.reset(new ArrowOutputStream(output_stream));
+    try {
+      writer_ = liborc::createWriter(*type_, output_stream_.get(), orc_options);
+      batch_ = writer_->createRowBatch(static_cast<uint64_t>(options.batch_size));
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("RecordBatch schema ", batch.schema()->ToString(),
+                             " does not match the ORC writer schema ",
+                             schema_->ToString());
+    }
+
+    auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch_);
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      const int64_t length = std::min(options_.batch_size, batch.num_rows() - offset);
+
+      // The batch's columns are independent, so they may be filled concurrently
+      auto fill_column = [&](int i) {
+        return FillBatch(*batch.column(i), offset, length, struct_batch.fields[i]);
+      };
+      if (options_.use_threads && batch.num_columns() > 1) {
+        auto task_group =
+            internal::TaskGroup::MakeThreaded(internal::GetCpuThreadPool());
+        for (int i = 0; i < batch.num_columns(); i++) {
+          task_group->Append([&fill_column, i] { return fill_column(i); });
+        }
+        RETURN_NOT_OK(task_group->Finish());
+      } else {
+        for (int i = 0; i < batch.num_columns(); i++) {
+          RETURN_NOT_OK(fill_column(i));
+        }
+      }
+
+      struct_batch.numElements = static_cast<uint64_t>(length);
+      try {
+        writer_->add(*batch_);
+      } catch (const std::exception& e) {
+        return Status::IOError(e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Write(const Table& table) {
+    TableBatchReader reader(table);
+    reader.set_chunksize(options_.batch_size);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(Write(*batch));
+    }
+  }
+
+  Status Close() {
+    try {
+      writer_->close();
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  ORCWriterOptions options_;
+  std::unique_ptr<liborc::Type> type_;
+  std::unique_ptr<ArrowOutputStream> output_stream_;
+  std::unique_ptr<liborc::Writer> writer_;
+  std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(const std::shared_ptr<Schema>& schema,
+                           io::OutputStream* output_stream,
+                           const ORCWriterOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, output_stream, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Write(const Table& table) { return impl_->Write(table); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -19,13 +19,17 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -34,6 +38,56 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief A predicate over the top-level columns of an ORC file
+///
+/// It is translated to a liborc SearchArgument, which ORC evaluates against the
+/// statistics of each row group (and bloom filters, when present) to skip row groups
+/// which cannot contain a matching row. Literal values are cast to the type of the
+/// column they are compared with, see CastLiteral.
+struct ARROW_EXPORT ORCSearchArgument {
+  enum Kind { AND, OR, NOT, EQUAL, LESS_THAN, LESS_THAN_EQUAL, IS_NULL, IN };
+
+  static ORCSearchArgument And(std::vector<ORCSearchArgument> children);
+  static ORCSearchArgument Or(std::vector<ORCSearchArgument> children);
+  static ORCSearchArgument Not(ORCSearchArgument child);
+  static ORCSearchArgument Equal(std::string column, std::shared_ptr<Scalar> value);
+  static ORCSearchArgument LessThan(std::string column, std::shared_ptr<Scalar> value);
+  static ORCSearchArgument LessThanEqual(std::string column,
+                                         std::shared_ptr<Scalar> value);
+  static ORCSearchArgument IsNull(std::string column);
+  static ORCSearchArgument In(std::string column, ScalarVector values);
+
+  /// \brief Cast a literal to the type of the column it is compared with
+  ///
+  /// Fails rather than wrapping or truncating the literal, e.g. an int64 literal
+  /// outside of the range of an int32 column, since comparing against such a value
+  /// could skip row groups which contain matching rows.
+  static Result<std::shared_ptr<Scalar>> CastLiteral(
+      const std::shared_ptr<Scalar>& value, const std::shared_ptr<DataType>& type);
+
+  std::string ToString() const;
+
+  Kind kind;
+  /// \brief The operands of AND, OR and NOT
+  std::vector<ORCSearchArgument> children;
+  /// \brief The column name of the other kinds
+  std::string column;
+  /// \brief The literal of EQUAL, LESS_THAN and LESS_THAN_EQUAL, or the set of IN
+  ScalarVector values;
+};
+
+/// \brief Counts of the data an ORCFileReader read and skipped
+struct ARROW_EXPORT ORCReadStatistics {
+  /// \brief Stripes of which at least one row group was read
+  int64_t stripes_read = 0;
+  /// \brief Stripes of which every row group was skipped by the search argument
+  int64_t stripes_skipped = 0;
+  /// \brief Rows returned
+  int64_t rows_read = 0;
+  /// \brief Rows in row groups skipped by the search argument
+  int64_t rows_skipped = 0;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -101,6 +155,25 @@ class ARROW_EXPORT ORCFileReader {
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
                     std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Read a single stripe as a RecordBatch
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] include_names the names of the top-level fields to read
+  /// \param[out] out the returned RecordBatch
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    std::shared_ptr<RecordBatch>* out);
+
+  /// \brief Read a single stripe as a Table
+  ///
+  /// With a search argument, the table will be composed of one record batch per run
+  /// of selected row groups, which are not copied into a single contiguous batch.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] include_names the names of the top-level fields to read
+  /// \param[out] out the returned Table
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    std::shared_ptr<Table>* out);
+
   /// \brief Seek to designated row. Invoke NextStripeReader() after seek
   ///        will return stripe reader starting from designated row.
   ///
@@ -130,6 +203,22 @@ class ARROW_EXPORT ORCFileReader {
   Status NextStripeReader(int64_t batch_size, const std::vector<int>& include_indices,
                           std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Skip row groups which cannot contain rows matching a predicate
+  ///
+  /// Applies to subsequent calls to Read, ReadStripe and NextStripeReader. ORC
+  /// filters at the granularity of row groups (10000 rows by default), so returned
+  /// batches may still contain rows which do not match.
+  ///
+  /// \param[in] sarg the predicate, over columns of the file schema
+  Status SetSearchArgument(const ORCSearchArgument& sarg);
+
+  /// \brief Read all row groups again
+  void ClearSearchArgument();
+
+  /// \brief The data read and skipped so far by Read, ReadStripe and the stripe
+  /// readers returned by NextStripeReader
+  ORCReadStatistics statistics() const;
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
@@ -142,6 +231,68 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+/// \brief Options for writing ORC files with ORCFileWriter
+struct ARROW_EXPORT ORCWriterOptions {
+  /// \brief The number of rows converted and handed to the ORC encoder at a time
+  int64_t batch_size = 1024;
+
+  /// \brief The target size of a stripe in bytes
+  int64_t stripe_size = 64 * 1024 * 1024;
+
+  /// \brief The compression codec. ORC supports UNCOMPRESSED, GZIP (as ZLIB),
+  /// SNAPPY, LZO, LZ4 and ZSTD.
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// \brief The number of rows between row index entries, the granularity of
+  /// statistics used to skip row groups on read
+  int64_t row_index_stride = 10000;
+
+  /// \brief The size of a compression block in bytes
+  int64_t compression_block_size = 64 * 1024;
+
+  /// \brief Convert the columns of each batch concurrently on the CPU thread pool
+  ///
+  /// ORC encodes stripes serially, so this parallelizes the Arrow to ORC conversion.
+  bool use_threads = false;
+};
+
+/// \class ORCFileWriter
+/// \brief Write an Arrow Table or RecordBatch to an ORC file.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Creates a new ORC writer.
+  ///
+  /// \param[in] schema the schema of the data to be written
+  /// \param[in] output_stream the destination, which must outlive the writer. It is
+  ///            not closed by the writer.
+  /// \param[in] options the writer options
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(const std::shared_ptr<Schema>& schema,
+                     io::OutputStream* output_stream, const ORCWriterOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Write a RecordBatch, whose schema must equal the writer's
+  ///
+  /// \param[in] batch the RecordBatch to write
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write a Table, whose schema must equal the writer's
+  ///
+  /// \param[in] table the Table to write
+  Status Write(const Table& table);
+
+  /// \brief Flush the last stripe and write the file footer
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
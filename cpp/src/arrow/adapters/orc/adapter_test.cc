@@ -19,7 +19,11 @@
 
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/io/api.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
 
 #include <gtest/gtest.h>
 #include <orc/OrcFile.hh>
@@ -28,6 +32,8 @@ namespace liborc = orc;
 
 namespace arrow {
 
+using internal::checked_pointer_cast;
+
 constexpr int DEFAULT_MEM_STREAM_SIZE = 100 * 1024 * 1024;
 
 class MemoryOutputStream : public liborc::OutputStream {
@@ -157,4 +163,231 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
 }
+
+class TestORCWriter : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestORCWriter, WriteReadRoundTrip) {
+  auto schema = ::arrow::schema({
+      field("bool", boolean()),
+      field("int8", int8()),
+      field("int32", int32()),
+      field("int64", int64()),
+      field("float", float32()),
+      field("double", float64()),
+      field("string", utf8()),
+      field("binary", binary()),
+      field("fixed", fixed_size_binary(2)),
+      field("date", date32()),
+      field("timestamp", timestamp(TimeUnit::NANO)),
+      field("decimal64", decimal(10, 2)),
+      field("decimal128", decimal(25, 3)),
+      field("list", list(int32())),
+      field("struct", struct_({field("a", int64()), field("b", float64())})),
+  });
+
+  auto batch = RecordBatch::Make(
+      schema, 4,
+      {
+          ArrayFromJSON(boolean(), "[true, false, null, true]"),
+          ArrayFromJSON(int8(), "[1, -2, null, 4]"),
+          ArrayFromJSON(int32(), "[1, null, 300000, -4]"),
+          ArrayFromJSON(int64(), "[null, 2, 3, 4000000000000]"),
+          ArrayFromJSON(float32(), "[1.5, null, -3.25, 4]"),
+          ArrayFromJSON(float64(), "[1.5, 2.5, null, -4.75]"),
+          ArrayFromJSON(utf8(), R"(["a", "", null, "dddd"])"),
+          ArrayFromJSON(binary(), R"(["x", null, "yz", ""])"),
+          ArrayFromJSON(fixed_size_binary(2), R"(["ab", null, "cd", "ef"])"),
+          ArrayFromJSON(date32(), "[0, 18000, null, -1]"),
+          ArrayFromJSON(timestamp(TimeUnit::NANO),
+                        "[0, -1, 1500000000123456789, null]"),
+          ArrayFromJSON(decimal(10, 2), R"(["1.23", "-45.60", null, "0.00"])"),
+          ArrayFromJSON(decimal(25, 3),
+                        R"(["1234567890123456789012.345", null, "-0.001", "7.000"])"),
+          ArrayFromJSON(list(int32()), "[[1, 2], [], null, [3, null, 5]]"),
+          ArrayFromJSON(struct_({field("a", int64()), field("b", float64())}),
+                        R"([{"a": 1, "b": 0.5}, null, {"a": null, "b": 2}, {}])"),
+      });
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  adapters::orc::ORCWriterOptions options;
+  // exercise conversion in several ORC batches, also starting at slice offsets
+  options.batch_size = 3;
+  options.use_threads = GetParam();
+
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+  ASSERT_OK(adapters::orc::ORCFileWriter::Open(schema, sink.get(), options, &writer));
+  ASSERT_OK(writer->Write(*batch));
+  ASSERT_OK(writer->Write(*batch->Slice(1)));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_OK(adapters::orc::ORCFileReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                               default_memory_pool(), &reader));
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(reader->Read(&actual));
+
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       Table::FromRecordBatches({batch, batch->Slice(1)}));
+  AssertSchemaEqual(*schema, *actual->schema());
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+INSTANTIATE_TEST_SUITE_P(SerialAndThreaded, TestORCWriter,
+                         ::testing::Values(false, true));
+
+TEST(TestAdapter, WriteReadMultipleStripes) {
+  auto schema = ::arrow::schema({field("a", int64())});
+  Int64Builder builder;
+  for (int64_t i = 0; i < 2000; i++) {
+    ASSERT_OK(builder.Append(i));
+  }
+  std::shared_ptr<Array> values;
+  ASSERT_OK(builder.Finish(&values));
+  auto batch = RecordBatch::Make(schema, values->length(), {values});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  adapters::orc::ORCWriterOptions options;
+  options.batch_size = batch->num_rows();
+  // flush a stripe after every batch
+  options.stripe_size = 1;
+
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+  ASSERT_OK(adapters::orc::ORCFileWriter::Open(schema, sink.get(), options, &writer));
+  for (int i = 0; i < 4; i++) {
+    ASSERT_OK(writer->Write(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_OK(adapters::orc::ORCFileReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                               default_memory_pool(), &reader));
+  ASSERT_GT(reader->NumberOfStripes(), 1);
+  ASSERT_EQ(reader->NumberOfRows(), 4 * batch->num_rows());
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(reader->Read(&actual));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       Table::FromRecordBatches({batch, batch, batch, batch}));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  int64_t num_rows = 0;
+  for (int64_t i = 0; i < reader->NumberOfStripes(); i++) {
+    std::shared_ptr<RecordBatch> stripe;
+    ASSERT_OK(reader->ReadStripe(i, &stripe));
+    ASSERT_OK(stripe->ValidateFull());
+    num_rows += stripe->num_rows();
+  }
+  ASSERT_EQ(num_rows, reader->NumberOfRows());
+}
+
+TEST(TestAdapter, WriteRejectsMismatchedSchema) {
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+  ASSERT_OK(adapters::orc::ORCFileWriter::Open(::arrow::schema({field("a", int32())}),
+                                               sink.get(),
+                                               adapters::orc::ORCWriterOptions(),
+                                               &writer));
+  auto batch = RecordBatch::Make(::arrow::schema({field("a", int64())}), 1,
+                                 {ArrayFromJSON(int64(), "[1]")});
+  ASSERT_RAISES(Invalid, writer->Write(*batch));
+  ASSERT_OK(writer->Close());
+}
+
+TEST(TestAdapter, SearchArgumentSkipsRowGroups) {
+  constexpr int64_t num_rows = 100000;
+  constexpr int64_t row_index_stride = 1000;
+
+  Int64Builder builder;
+  ASSERT_OK(builder.Resize(num_rows));
+  for (int64_t i = 0; i < num_rows; ++i) {
+    builder.UnsafeAppend(i);
+  }
+  std::shared_ptr<Array> values;
+  ASSERT_OK(builder.Finish(&values));
+  auto schema = ::arrow::schema({field("x", int64())});
+  auto batch = RecordBatch::Make(schema, num_rows, {values});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  adapters::orc::ORCWriterOptions options;
+  options.row_index_stride = row_index_stride;
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+  ASSERT_OK(adapters::orc::ORCFileWriter::Open(schema, sink.get(), options, &writer));
+  ASSERT_OK(writer->Write(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_OK(adapters::orc::ORCFileReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                               default_memory_pool(), &reader));
+
+  using adapters::orc::ORCSearchArgument;
+  // the literal is cast to the column's type
+  ASSERT_OK(reader->SetSearchArgument(ORCSearchArgument::Or(
+      {ORCSearchArgument::LessThan("x", MakeScalar(int32_t(2500))),
+       ORCSearchArgument::Equal("x", MakeScalar(int64_t(50500)))})));
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->Read(&table));
+
+  // row groups are read whole: [0, 3000) and [50000, 51000)
+  ASSERT_EQ(table->num_rows(), 4 * row_index_stride);
+  auto stats = reader->statistics();
+  ASSERT_EQ(stats.rows_read, 4 * row_index_stride);
+  ASSERT_EQ(stats.rows_skipped, num_rows - 4 * row_index_stride);
+
+  std::shared_ptr<RecordBatch> stripe;
+  ASSERT_OK(reader->ReadStripe(0, &stripe));
+  ASSERT_OK(stripe->ValidateFull());
+  auto x = checked_pointer_cast<Int64Array>(stripe->column(0));
+  ASSERT_EQ(x->length(), 4 * row_index_stride);
+  ASSERT_EQ(x->Value(0), 0);
+  ASSERT_EQ(x->Value(3 * row_index_stride - 1), 3 * row_index_stride - 1);
+  ASSERT_EQ(x->Value(3 * row_index_stride), 50000);
+
+  // as a Table, each run of selected row groups is a chunk of its own
+  std::shared_ptr<Table> stripe_table;
+  ASSERT_OK(reader->ReadStripe(0, std::vector<std::string>{"x"}, &stripe_table));
+  ASSERT_OK(stripe_table->ValidateFull());
+  ASSERT_EQ(stripe_table->column(0)->num_chunks(), 2);
+  ASSERT_EQ(stripe_table->column(0)->chunk(0)->length(), 3 * row_index_stride);
+  ASSERT_TRUE(stripe_table->column(0)->Equals(ChunkedArray(ArrayVector{x})));
+
+  // no row group matches
+  ASSERT_OK(reader->SetSearchArgument(
+      ORCSearchArgument::Not(ORCSearchArgument::LessThan("x", MakeScalar(num_rows)))));
+  ASSERT_OK(reader->ReadStripe(0, &stripe));
+  ASSERT_EQ(stripe->num_rows(), 0);
+  ASSERT_EQ(reader->statistics().stripes_skipped, 1);
+
+  reader->ClearSearchArgument();
+  ASSERT_OK(reader->Read(&table));
+  ASSERT_EQ(table->num_rows(), num_rows);
+
+  ASSERT_RAISES(Invalid, reader->SetSearchArgument(
+                             ORCSearchArgument::IsNull("not_in_file")));
+  // truncating the literal to 0 would skip the row group holding x == 0
+  ASSERT_RAISES(Invalid, reader->SetSearchArgument(
+                             ORCSearchArgument::LessThan("x", MakeScalar(0.5))));
+}
+
+TEST(TestAdapter, SearchArgumentCastLiteral) {
+  using adapters::orc::ORCSearchArgument;
+  ASSERT_OK_AND_ASSIGN(auto cast,
+                       ORCSearchArgument::CastLiteral(MakeScalar(int64_t(5)), int32()));
+  ASSERT_TRUE(cast->Equals(*MakeScalar(int32_t(5))));
+  ASSERT_OK_AND_ASSIGN(cast, ORCSearchArgument::CastLiteral(MakeScalar(2.0), int8()));
+  ASSERT_TRUE(cast->Equals(*MakeScalar(int8_t(2))));
+
+  // literals which a static_cast would wrap or truncate
+  ASSERT_RAISES(Invalid, ORCSearchArgument::CastLiteral(
+                             MakeScalar(int64_t(1) << 40), int32()));
+  ASSERT_RAISES(Invalid,
+                ORCSearchArgument::CastLiteral(MakeScalar(int32_t(-1)), uint32()));
+  ASSERT_RAISES(Invalid, ORCSearchArgument::CastLiteral(MakeScalar(1.5), int64()));
+  ASSERT_RAISES(Invalid, ORCSearchArgument::CastLiteral(MakeScalar(1e300), int32()));
+  ASSERT_RAISES(Invalid, ORCSearchArgument::CastLiteral(MakeScalar(128.0), int8()));
+}
+
 }  // namespace arrow
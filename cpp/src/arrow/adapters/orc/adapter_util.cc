@@ -15,16 +15,20 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/adapters/orc/adapter_util.h"
+#include "arrow/array.h"
 #include "arrow/array/builder_base.h"
+#include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
-#include "arrow/util/range.h"
 
 #include "orc/Exceptions.hh"
 #include "orc/OrcFile.hh"
@@ -142,13 +146,13 @@ Status AppendNumericBatchCast(liborc::ColumnVectorBatch* cbatch, int64_t offset,
     valid_bytes = reinterpret_cast<const uint8_t*>(batch->notNull.data()) + offset;
   }
   const source_type* source = batch->data.data() + offset;
-  auto cast_iter = internal::MakeLazyRange(
-      [&source](int64_t index) { return static_cast<target_type>(source[index]); },
-      length);
 
-  RETURN_NOT_OK(builder->AppendValues(cast_iter.begin(), cast_iter.end(), valid_bytes));
+  // Narrow in a single pass the compiler can vectorize, then append in bulk
+  std::vector<target_type> values(length);
+  std::transform(source, source + length, values.begin(),
+                 [](source_type value) { return static_cast<target_type>(value); });
 
-  return Status::OK();
+  return builder->AppendValues(values.data(), length, valid_bytes);
 }
 
 Status AppendBoolBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset, int64_t length,
@@ -166,12 +170,11 @@ Status AppendBoolBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset, int64_
   }
   const int64_t* source = batch->data.data() + offset;
 
-  auto cast_iter = internal::MakeLazyRange(
-      [&source](int64_t index) { return static_cast<bool>(source[index]); }, length);
-
-  RETURN_NOT_OK(builder->AppendValues(cast_iter.begin(), cast_iter.end(), valid_bytes));
+  std::vector<uint8_t> values(length);
+  std::transform(source, source + length, values.begin(),
+                 [](int64_t value) { return static_cast<uint8_t>(value != 0); });
 
-  return Status::OK();
+  return builder->AppendValues(values.data(), length, valid_bytes);
 }
 
 Status AppendTimestampBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
@@ -191,15 +194,12 @@ Status AppendTimestampBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   const int64_t* seconds = batch->data.data() + offset;
   const int64_t* nanos = batch->nanoseconds.data() + offset;
 
-  auto transform_timestamp = [seconds, nanos](int64_t index) {
-    return seconds[index] * kOneSecondNanos + nanos[index];
-  };
-
-  auto transform_range = internal::MakeLazyRange(transform_timestamp, length);
+  std::vector<int64_t> values(length);
+  for (int64_t i = 0; i < length; i++) {
+    values[i] = seconds[i] * kOneSecondNanos + nanos[i];
+  }
 
-  RETURN_NOT_OK(
-      builder->AppendValues(transform_range.begin(), transform_range.end(), valid_bytes));
-  return Status::OK();
+  return builder->AppendValues(values.data(), length, valid_bytes);
 }
 
 template <class builder_type>
@@ -209,12 +209,23 @@ Status AppendBinaryBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
 
   const bool has_nulls = batch->hasNulls;
+  const char* not_null = batch->notNull.data();
+
+  // Size the offsets and data up front so that each value is a bare copy
+  int64_t data_length = 0;
   for (int64_t i = offset; i < length + offset; i++) {
-    if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(
-          builder->Append(batch->data[i], static_cast<int32_t>(batch->length[i])));
+    if (!has_nulls || not_null[i]) {
+      data_length += batch->length[i];
+    }
+  }
+  RETURN_NOT_OK(builder->Reserve(length));
+  RETURN_NOT_OK(builder->ReserveData(data_length));
+
+  for (int64_t i = offset; i < length + offset; i++) {
+    if (!has_nulls || not_null[i]) {
+      builder->UnsafeAppend(batch->data[i], static_cast<int32_t>(batch->length[i]));
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -226,11 +237,12 @@ Status AppendFixedBinaryBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset,
   auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
 
   const bool has_nulls = batch->hasNulls;
+  RETURN_NOT_OK(builder->Reserve(length));
   for (int64_t i = offset; i < length + offset; i++) {
     if (!has_nulls || batch->notNull[i]) {
-      RETURN_NOT_OK(builder->Append(batch->data[i]));
+      builder->UnsafeAppend(reinterpret_cast<const uint8_t*>(batch->data[i]));
     } else {
-      RETURN_NOT_OK(builder->AppendNull());
+      builder->UnsafeAppendNull();
     }
   }
   return Status::OK();
@@ -316,6 +328,127 @@ Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
   }
 }
 
+namespace {
+
+// A Buffer viewing memory owned by a liborc ColumnVectorBatch, which it keeps alive
+class ColumnVectorBuffer : public Buffer {
+ public:
+  ColumnVectorBuffer(const void* data, int64_t size,
+                     std::shared_ptr<liborc::ColumnVectorBatch> owner)
+      : Buffer(reinterpret_cast<const uint8_t*>(data), size), owner_(std::move(owner)) {}
+
+ private:
+  std::shared_ptr<liborc::ColumnVectorBatch> owner_;
+};
+
+// Pack liborc's one byte per slot notNull flags into a validity bitmap
+Status MakeNullBitmap(const liborc::ColumnVectorBatch& batch, int64_t offset,
+                      int64_t length, MemoryPool* pool, std::shared_ptr<Buffer>* out,
+                      int64_t* null_count) {
+  *out = nullptr;
+  *null_count = 0;
+  if (!batch.hasNulls) {
+    return Status::OK();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(*out, AllocateBitmap(length, pool));
+  const char* not_null = batch.notNull.data() + offset;
+  internal::GenerateBitsUnrolled((*out)->mutable_data(), 0, length,
+                                 [&not_null] { return *not_null++ != 0; });
+
+  *null_count = length - internal::CountSetBits((*out)->data(), 0, length);
+  if (*null_count == 0) {
+    *out = nullptr;
+  }
+  return Status::OK();
+}
+
+template <class batch_type, class elem_type>
+Status WrapNumericBatch(liborc::ColumnVectorBatch* cbatch, int64_t offset, int64_t length,
+                        const std::shared_ptr<DataType>& arrow_type,
+                        const std::shared_ptr<liborc::ColumnVectorBatch>& owner,
+                        MemoryPool* pool, std::shared_ptr<Array>* out) {
+  auto batch = checked_cast<batch_type*>(cbatch);
+
+  std::shared_ptr<Buffer> null_bitmap;
+  int64_t null_count;
+  RETURN_NOT_OK(MakeNullBitmap(*batch, offset, length, pool, &null_bitmap, &null_count));
+
+  auto values = std::make_shared<ColumnVectorBuffer>(
+      batch->data.data() + offset, length * static_cast<int64_t>(sizeof(elem_type)),
+      owner);
+  *out = MakeArray(ArrayData::Make(arrow_type, length,
+                                   {std::move(null_bitmap), std::move(values)},
+                                   null_count));
+  return Status::OK();
+}
+
+Status ConvertStructBatch(const liborc::Type* type, liborc::ColumnVectorBatch* cbatch,
+                          int64_t offset, int64_t length,
+                          const std::shared_ptr<DataType>& arrow_type,
+                          const std::shared_ptr<liborc::ColumnVectorBatch>& owner,
+                          MemoryPool* pool, std::shared_ptr<Array>* out) {
+  auto batch = checked_cast<liborc::StructVectorBatch*>(cbatch);
+
+  std::vector<std::shared_ptr<Array>> children(arrow_type->num_children());
+  for (int i = 0; i < arrow_type->num_children(); i++) {
+    RETURN_NOT_OK(ConvertBatch(type->getSubtype(i), batch->fields[i], offset, length,
+                               arrow_type->child(i)->type(), owner, pool,
+                               &children[i]));
+  }
+
+  std::shared_ptr<Buffer> null_bitmap;
+  int64_t null_count;
+  RETURN_NOT_OK(MakeNullBitmap(*batch, offset, length, pool, &null_bitmap, &null_count));
+
+  *out = std::make_shared<StructArray>(arrow_type, length, std::move(children),
+                                       std::move(null_bitmap), null_count);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status ConvertBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
+                    int64_t offset, int64_t length,
+                    const std::shared_ptr<DataType>& arrow_type,
+                    const std::shared_ptr<liborc::ColumnVectorBatch>& owner,
+                    MemoryPool* pool, std::shared_ptr<Array>* out) {
+  if (type == nullptr) {
+    // a column which was not selected for reading
+    *out = std::make_shared<NullArray>(length);
+    return Status::OK();
+  }
+
+  switch (type->getKind()) {
+    case liborc::LONG:
+      if (arrow_type->id() == Type::INT64) {
+        return WrapNumericBatch<liborc::LongVectorBatch, int64_t>(
+            batch, offset, length, arrow_type, owner, pool, out);
+      }
+      break;
+    case liborc::DOUBLE:
+      if (arrow_type->id() == Type::DOUBLE) {
+        return WrapNumericBatch<liborc::DoubleVectorBatch, double>(
+            batch, offset, length, arrow_type, owner, pool, out);
+      }
+      break;
+    case liborc::STRUCT:
+      if (arrow_type->id() == Type::STRUCT &&
+          static_cast<uint64_t>(arrow_type->num_children()) == type->getSubtypeCount()) {
+        return ConvertStructBatch(type, batch, offset, length, arrow_type, owner, pool,
+                                  out);
+      }
+      break;
+    default:
+      break;
+  }
+
+  std::unique_ptr<ArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(pool, arrow_type, &builder));
+  RETURN_NOT_OK(AppendBatch(type, batch, offset, length, builder.get()));
+  return builder->Finish(out);
+}
+
 Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   // When subselecting fields on read, liborc will set some nodes to nullptr,
   // so we need to check for nullptr before progressing
@@ -425,6 +558,293 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   return Status::OK();
 }
 
+void SplitTimestamp(int64_t value, TimeUnit::type unit, int64_t* seconds,
+                    int64_t* nanos) {
+  int64_t units_per_second = 1;
+  switch (unit) {
+    case TimeUnit::SECOND:
+      units_per_second = 1;
+      break;
+    case TimeUnit::MILLI:
+      units_per_second = 1000;
+      break;
+    case TimeUnit::MICRO:
+      units_per_second = 1000000;
+      break;
+    case TimeUnit::NANO:
+      units_per_second = kOneSecondNanos;
+      break;
+  }
+
+  *seconds = value / units_per_second;
+  int64_t remainder = value % units_per_second;
+  if (remainder < 0) {
+    --*seconds;
+    remainder += units_per_second;
+  }
+  *nanos = remainder * (kOneSecondNanos / units_per_second);
+}
+
+Status GetOrcType(const DataType& type, std::unique_ptr<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::FIXED_SIZE_BINARY: {
+      const auto& fixed_type = checked_cast<const FixedSizeBinaryType&>(type);
+      *out = liborc::createCharType(liborc::CHAR,
+                                    static_cast<uint64_t>(fixed_type.byte_width()));
+      break;
+    }
+    case Type::DATE32:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(static_cast<uint64_t>(decimal_type.precision()),
+                                       static_cast<uint64_t>(decimal_type.scale()));
+      break;
+    }
+    case Type::LIST: {
+      std::unique_ptr<liborc::Type> elemtype;
+      RETURN_NOT_OK(
+          GetOrcType(*checked_cast<const ListType&>(type).value_type(), &elemtype));
+      *out = liborc::createListType(std::move(elemtype));
+      break;
+    }
+    case Type::STRUCT: {
+      auto struct_type = liborc::createStructType();
+      for (const auto& child : type.children()) {
+        std::unique_ptr<liborc::Type> elemtype;
+        RETURN_NOT_OK(GetOrcType(*child->type(), &elemtype));
+        struct_type->addStructField(child->name(), std::move(elemtype));
+      }
+      *out = std::move(struct_type);
+      break;
+    }
+    default: {
+      return Status::NotImplemented("Writing arrow type ", type.ToString(),
+                                    " to ORC is not supported");
+    }
+  }
+  return Status::OK();
+}
+
+Status GetOrcType(const Schema& schema, std::unique_ptr<liborc::Type>* out) {
+  auto struct_type = liborc::createStructType();
+  for (const auto& field : schema.fields()) {
+    std::unique_ptr<liborc::Type> elemtype;
+    RETURN_NOT_OK(GetOrcType(*field->type(), &elemtype));
+    struct_type->addStructField(field->name(), std::move(elemtype));
+  }
+  *out = std::move(struct_type);
+  return Status::OK();
+}
+
+namespace {
+
+void FillNotNull(const Array& array, int64_t offset, int64_t length,
+                 liborc::ColumnVectorBatch* batch) {
+  batch->hasNulls = array.null_count() > 0;
+  if (!batch->hasNulls) {
+    return;
+  }
+  char* not_null = batch->notNull.data();
+  internal::BitmapReader reader(array.null_bitmap_data(), array.offset() + offset,
+                                length);
+  for (int64_t i = 0; i < length; i++) {
+    not_null[i] = reader.IsSet();
+    reader.Next();
+  }
+}
+
+template <class array_type, class batch_type>
+Status FillNumericBatch(const Array& parray, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& array = checked_cast<const array_type&>(parray);
+  auto batch = checked_cast<batch_type*>(cbatch);
+
+  // Widen in a single pass; slots under nulls are copied along and ignored by liborc
+  const auto* values = array.raw_values() + offset;
+  std::copy(values, values + length, batch->data.data());
+  return Status::OK();
+}
+
+Status FillBoolBatch(const Array& parray, int64_t offset, int64_t length,
+                     liborc::ColumnVectorBatch* cbatch) {
+  const auto& array = checked_cast<const BooleanArray&>(parray);
+  auto batch = checked_cast<liborc::LongVectorBatch*>(cbatch);
+
+  int64_t* values = batch->data.data();
+  internal::BitmapReader reader(array.values()->data(), array.offset() + offset, length);
+  for (int64_t i = 0; i < length; i++) {
+    values[i] = reader.IsSet();
+    reader.Next();
+  }
+  return Status::OK();
+}
+
+Status FillTimestampBatch(const Array& parray, int64_t offset, int64_t length,
+                          liborc::ColumnVectorBatch* cbatch) {
+  const auto& array = checked_cast<const TimestampArray&>(parray);
+  auto batch = checked_cast<liborc::TimestampVectorBatch*>(cbatch);
+
+  const auto unit = checked_cast<const TimestampType&>(*array.type()).unit();
+  const int64_t* values = array.raw_values() + offset;
+  for (int64_t i = 0; i < length; i++) {
+    SplitTimestamp(values[i], unit, &batch->data[i], &batch->nanoseconds[i]);
+  }
+  return Status::OK();
+}
+
+template <class array_type>
+Status FillBinaryBatch(const Array& parray, int64_t offset, int64_t length,
+                       liborc::ColumnVectorBatch* cbatch) {
+  const auto& array = checked_cast<const array_type&>(parray);
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+
+  // liborc only keeps pointers to the values, which stay owned by the arrow array
+  for (int64_t i = 0; i < length; i++) {
+    auto view = array.GetView(offset + i);
+    batch->data[i] = const_cast<char*>(view.data());
+    batch->length[i] = static_cast<int64_t>(view.size());
+  }
+  return Status::OK();
+}
+
+Status FillDecimalBatch(const Array& parray, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& array = checked_cast<const Decimal128Array&>(parray);
+  const auto& type = checked_cast<const Decimal128Type&>(*array.type());
+
+  // liborc uses 64 bit decimals up to precision 18, as in AppendDecimalBatch
+  if (type.precision() > 18) {
+    auto batch = checked_cast<liborc::Decimal128VectorBatch*>(cbatch);
+    for (int64_t i = 0; i < length; i++) {
+      Decimal128 value(array.GetValue(offset + i));
+      batch->values[i] = liborc::Int128(value.high_bits(), value.low_bits());
+    }
+    batch->precision = type.precision();
+    batch->scale = type.scale();
+  } else {
+    auto batch = checked_cast<liborc::Decimal64VectorBatch*>(cbatch);
+    for (int64_t i = 0; i < length; i++) {
+      Decimal128 value(array.GetValue(offset + i));
+      batch->values[i] = static_cast<int64_t>(value.low_bits());
+    }
+    batch->precision = type.precision();
+    batch->scale = type.scale();
+  }
+  return Status::OK();
+}
+
+Status FillStructBatch(const Array& parray, int64_t offset, int64_t length,
+                       liborc::ColumnVectorBatch* cbatch) {
+  const auto& array = checked_cast<const StructArray&>(parray);
+  auto batch = checked_cast<liborc::StructVectorBatch*>(cbatch);
+
+  for (int i = 0; i < array.num_fields(); i++) {
+    RETURN_NOT_OK(FillBatch(*array.field(i), offset, length, batch->fields[i]));
+  }
+  return Status::OK();
+}
+
+Status FillListBatch(const Array& parray, int64_t offset, int64_t length,
+                     liborc::ColumnVectorBatch* cbatch) {
+  const auto& array = checked_cast<const ListArray&>(parray);
+  auto batch = checked_cast<liborc::ListVectorBatch*>(cbatch);
+
+  const int32_t* offsets = array.raw_value_offsets() + offset;
+  const int64_t values_offset = offsets[0];
+  for (int64_t i = 0; i <= length; i++) {
+    batch->offsets[i] = offsets[i] - values_offset;
+  }
+  return FillBatch(*array.values(), values_offset, offsets[length] - values_offset,
+                   batch->elements.get());
+}
+
+}  // namespace
+
+Status FillBatch(const Array& array, int64_t offset, int64_t length,
+                 liborc::ColumnVectorBatch* batch) {
+  if (batch->capacity < static_cast<uint64_t>(length)) {
+    // only list elements may outgrow the capacity the batch was created with
+    batch->resize(static_cast<uint64_t>(length));
+  }
+  batch->numElements = static_cast<uint64_t>(length);
+  FillNotNull(array, offset, length, batch);
+
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return FillBoolBatch(array, offset, length, batch);
+    case Type::INT8:
+      return FillNumericBatch<Int8Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                  batch);
+    case Type::INT16:
+      return FillNumericBatch<Int16Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                   batch);
+    case Type::INT32:
+      return FillNumericBatch<Int32Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                   batch);
+    case Type::INT64:
+      return FillNumericBatch<Int64Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                   batch);
+    case Type::FLOAT:
+      return FillNumericBatch<FloatArray, liborc::DoubleVectorBatch>(array, offset,
+                                                                     length, batch);
+    case Type::DOUBLE:
+      return FillNumericBatch<DoubleArray, liborc::DoubleVectorBatch>(array, offset,
+                                                                      length, batch);
+    case Type::DATE32:
+      return FillNumericBatch<Date32Array, liborc::LongVectorBatch>(array, offset,
+                                                                    length, batch);
+    case Type::STRING:
+      return FillBinaryBatch<StringArray>(array, offset, length, batch);
+    case Type::BINARY:
+      return FillBinaryBatch<BinaryArray>(array, offset, length, batch);
+    case Type::FIXED_SIZE_BINARY:
+      return FillBinaryBatch<FixedSizeBinaryArray>(array, offset, length, batch);
+    case Type::TIMESTAMP:
+      return FillTimestampBatch(array, offset, length, batch);
+    case Type::DECIMAL:
+      return FillDecimalBatch(array, offset, length, batch);
+    case Type::STRUCT:
+      return FillStructBatch(array, offset, length, batch);
+    case Type::LIST:
+      return FillListBatch(array, offset, length, batch);
+    default:
+      return Status::NotImplemented("Writing arrow type ", array.type()->ToString(),
+                                    " to ORC is not supported");
+  }
+}
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "arrow/array/builder_base.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "orc/OrcFile.hh"
 
@@ -36,6 +37,33 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out);
 
 Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
                    int64_t offset, int64_t length, ArrayBuilder* builder);
+
+/// \brief Convert rows [offset, offset + length) of an ORC batch to an Array
+///
+/// LONG and DOUBLE columns (also within structs) are not copied: the returned Array
+/// views the batch's memory and keeps owner, the batch holding it, alive. Other
+/// types are appended to a builder with AppendBatch.
+Status ConvertBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
+                    int64_t offset, int64_t length,
+                    const std::shared_ptr<DataType>& arrow_type,
+                    const std::shared_ptr<liborc::ColumnVectorBatch>& owner,
+                    MemoryPool* pool, std::shared_ptr<Array>* out);
+
+Status GetOrcType(const DataType& type, std::unique_ptr<liborc::Type>* out);
+
+Status GetOrcType(const Schema& schema, std::unique_ptr<liborc::Type>* out);
+
+/// \brief Split a timestamp into ORC's seconds and non negative nanoseconds
+void SplitTimestamp(int64_t value, TimeUnit::type unit, int64_t* seconds,
+                    int64_t* nanos);
+
+/// \brief Write rows [offset, offset + length) of array to the start of an ORC batch
+///
+/// String and binary values are referenced, not copied, so array must outlive any
+/// use of the batch.
+Status FillBatch(const Array& array, int64_t offset, int64_t length,
+                 liborc::ColumnVectorBatch* batch);
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
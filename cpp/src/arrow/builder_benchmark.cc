@@ -56,6 +56,12 @@ constexpr int64_t kBytesProcessed = kRounds * kBytesProcessPerRound;
 static const char* kBinaryString = "12345678";
 static arrow::util::string_view kBinaryView(kBinaryString);
 
+// A pool serving the large builder buffers from recycled huge page mappings
+static MemoryPool* HugePagePool() {
+  static HugePageMemoryPool pool(default_memory_pool());
+  return &pool;
+}
+
 static void BuildIntArrayNoNulls(benchmark::State& state) {  // NOLINT non-const reference
   for (auto _ : state) {
     Int64Builder builder;
@@ -71,6 +77,22 @@ static void BuildIntArrayNoNulls(benchmark::State& state) {  // NOLINT non-const
   state.SetBytesProcessed(state.iterations() * kBytesProcessed);
 }
 
+static void BuildIntArrayNoNullsHugePages(
+    benchmark::State& state) {  // NOLINT non-const reference
+  for (auto _ : state) {
+    Int64Builder builder(HugePagePool());
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendValues(kData.data(), kData.size(), nullptr));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+}
+
 static void BuildAdaptiveIntNoNulls(
     benchmark::State& state) {  // NOLINT non-const reference
   for (auto _ : state) {
@@ -364,13 +386,14 @@ static void ArrayDataConstructDestruct(
 
 static void BenchmarkBufferBuilder(
     const std::string& datum,
-    benchmark::State& state) {  // NOLINT non-const reference
+    benchmark::State& state,  // NOLINT non-const reference
+    MemoryPool* pool = default_memory_pool()) {
   const void* raw_data = datum.data();
   int64_t raw_nbytes = static_cast<int64_t>(datum.size());
   // Write approx. 256 MB to BufferBuilder
   int64_t num_raw_values = (1 << 28) / raw_nbytes;
   for (auto _ : state) {
-    BufferBuilder builder;
+    BufferBuilder builder(pool);
     std::shared_ptr<Buffer> buf;
     for (int64_t i = 0; i < num_raw_values; ++i) {
       ABORT_NOT_OK(builder.Append(raw_data, raw_nbytes));
@@ -403,9 +426,17 @@ static void BufferBuilderLargeWrites(
   return BenchmarkBufferBuilder(datum, state);
 }
 
+static void BufferBuilderLargeWritesHugePages(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // A 1.5MB datum
+  std::string datum(1500000, 'x');
+  return BenchmarkBufferBuilder(datum, state, HugePagePool());
+}
+
 BENCHMARK(BufferBuilderTinyWrites)->UseRealTime();
 BENCHMARK(BufferBuilderSmallWrites)->UseRealTime();
 BENCHMARK(BufferBuilderLargeWrites)->UseRealTime();
+BENCHMARK(BufferBuilderLargeWritesHugePages)->UseRealTime();
 
 // ----------------------------------------------------------------------
 // Benchmark declarations
@@ -435,6 +466,7 @@ BENCHMARK(ReferenceBuildVectorNoNulls);
 BENCHMARK(BuildBooleanArrayNoNulls);
 
 BENCHMARK(BuildIntArrayNoNulls);
+BENCHMARK(BuildIntArrayNoNullsHugePages);
 BENCHMARK(BuildAdaptiveIntNoNulls);
 BENCHMARK(BuildAdaptiveIntNoNullsScalarAppend);
 
@@ -30,5 +30,6 @@
 #include "arrow/compute/kernels/mean.h"             // IWYU pragma: export
 #include "arrow/compute/kernels/nth_to_indices.h"   // IWYU pragma: export
 #include "arrow/compute/kernels/sort_to_indices.h"  // IWYU pragma: export
+#include "arrow/compute/kernels/string.h"           // IWYU pragma: export
 #include "arrow/compute/kernels/sum.h"              // IWYU pragma: export
 #include "arrow/compute/kernels/take.h"             // IWYU pragma: export
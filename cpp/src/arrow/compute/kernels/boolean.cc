@@ -139,8 +139,8 @@ class BinaryBooleanKernel : public BinaryKernel {
       ++i;
     };
 
-    if (right.null_count == 0 || left.null_count == 0) {
-      if (left.null_count == 0) {
+    if (right.GetNullCount() == 0 || left.GetNullCount() == 0) {
+      if (left.GetNullCount() == 0) {
         // ensure only bitmaps[RIGHT_VALID].buffer might be null
         std::swap(bitmaps[LEFT_VALID], bitmaps[RIGHT_VALID]);
         std::swap(bitmaps[LEFT_DATA], bitmaps[RIGHT_DATA]);
@@ -17,13 +17,16 @@
 
 #include "arrow/compute/kernels/compare.h"
 
+#include <type_traits>
 #include <utility>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/compare_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
 #include "arrow/visitor_inline.h"
@@ -32,6 +35,8 @@ namespace arrow {
 
 using internal::checked_cast;
 using internal::checked_pointer_cast;
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
 using util::string_view;
 
 namespace compute {
@@ -180,6 +185,36 @@ Status Compare(L&& get_left, R&& get_right, ArrayData* out) {
   return Status::OK();
 }
 
+// The comparison kernels over C values for the best instruction set supported
+// by the CPU, see compare_internal.h
+template <typename T>
+struct NumericCompareKernels {
+  detail::CompareArrayArrayFunc<T> array_array;
+  detail::CompareArrayScalarFunc<T> array_scalar;
+
+  static const NumericCompareKernels& Get() {
+    static const DynamicDispatch<NumericCompareKernels> dispatch{
+        {DispatchLevel::NONE,
+         {detail::CompareArrayArrayImpl<T>, detail::CompareArrayScalarImpl<T>}},
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+        {DispatchLevel::AVX2,
+         {detail::avx2::CompareArrayArray<T>, detail::avx2::CompareArrayScalar<T>}},
+#endif
+#ifdef ARROW_HAVE_RUNTIME_AVX512
+        {DispatchLevel::AVX512,
+         {detail::avx512::CompareArrayArray<T>, detail::avx512::CompareArrayScalar<T>}},
+#endif
+    };
+    return dispatch.func;
+  }
+};
+
+// Types whose values are compared as C values by NumericCompareKernels
+template <typename ArrowType>
+using is_simd_comparable =
+    std::integral_constant<bool, has_c_type<ArrowType>::value &&
+                                     !is_boolean_type<ArrowType>::value>;
+
 template <typename ArrowType, CompareOperator Op>
 class CompareKernel final : public BinaryKernel {
  public:
@@ -198,18 +233,54 @@ class CompareKernel final : public BinaryKernel {
 
     if (left_array && right_array) {
       RETURN_NOT_OK(AssignNulls(ctx, *left_array, *right_array, out.get()));
-      return Compare<Op>(MakeRange(*left_array), MakeRange(*right_array), out.get());
+      return CompareArrays(*left_array, *right_array, out.get());
     }
 
     if (left_array && right_scalar) {
       RETURN_NOT_OK(AssignNulls(ctx, *left_array, *right_scalar, out.get()));
-      return Compare<Op>(MakeRange(*left_array), MakeRange(*right_scalar), out.get());
+      if (!right_scalar->is_valid) {
+        // All the output is null, there is nothing to compare
+        BitUtil::SetBitsTo(out->buffers[1]->mutable_data(), 0, out->length, false);
+        return Status::OK();
+      }
+      return CompareArrayScalar(*left_array, *right_scalar, out.get());
     }
 
     return Status::Invalid("Invalid datum signature for CompareBinaryKernel::Call");
   }
 
  private:
+  template <typename T = ArrowType>
+  static enable_if_t<!is_simd_comparable<T>::value, Status> CompareArrays(
+      const ArrayType& left, const ArrayType& right, ArrayData* out) {
+    return Compare<Op>(MakeRange(left), MakeRange(right), out);
+  }
+
+  template <typename T = ArrowType>
+  static enable_if_t<!is_simd_comparable<T>::value, Status> CompareArrayScalar(
+      const ArrayType& left, const ScalarType& right, ArrayData* out) {
+    return Compare<Op>(MakeRange(left), MakeRange(right), out);
+  }
+
+  template <typename T = ArrowType>
+  static enable_if_t<is_simd_comparable<T>::value, Status> CompareArrays(
+      const ArrayType& left, const ArrayType& right, ArrayData* out) {
+    using CType = typename T::c_type;
+    NumericCompareKernels<CType>::Get().array_array(
+        Op, left.raw_values(), right.raw_values(), out->length,
+        out->buffers[1]->mutable_data());
+    return Status::OK();
+  }
+
+  template <typename T = ArrowType>
+  static enable_if_t<is_simd_comparable<T>::value, Status> CompareArrayScalar(
+      const ArrayType& left, const ScalarType& right, ArrayData* out) {
+    using CType = typename T::c_type;
+    NumericCompareKernels<CType>::Get().array_scalar(
+        Op, left.raw_values(), right.value, out->length, out->buffers[1]->mutable_data());
+    return Status::OK();
+  }
+
   static std::shared_ptr<ArrayType> AsArray(const Datum& datum) {
     if (datum.kind() != Datum::ARRAY) return nullptr;
     return checked_pointer_cast<ArrayType>(datum.make_array());
@@ -0,0 +1,32 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Built with ARROW_AVX2_FLAG, only include compare_internal.h here
+
+#include "arrow/compute/kernels/compare_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace detail {
+namespace avx2 {
+
+ARROW_DEFINE_ALL_COMPARE_KERNELS
+
+}  // namespace avx2
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
@@ -17,12 +17,14 @@
 
 #include "benchmark/benchmark.h"
 
+#include <memory>
 #include <vector>
 
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 
@@ -31,37 +33,41 @@ namespace compute {
 
 constexpr auto kSeed = 0x94378165;
 
-static void CompareArrayScalarKernel(benchmark::State& state) {
+template <typename Type>
+static void CompareArrayScalar(benchmark::State& state) {
+  using CType = typename Type::c_type;
+
   const int64_t memory_size = state.range(0);
-  const int64_t array_size = memory_size / sizeof(int64_t);
+  const int64_t array_size = memory_size / sizeof(CType);
   const double null_percent = static_cast<double>(state.range(1)) / 100.0;
   auto rand = random::RandomArrayGenerator(kSeed);
-  auto array = std::static_pointer_cast<NumericArray<Int64Type>>(
-      rand.Int64(array_size, -100, 100, null_percent));
+  auto array = rand.Numeric<Type>(array_size, CType(-100), CType(100), null_percent);
+  auto zero = Datum(std::make_shared<NumericScalar<Type>>(CType(0)));
 
   CompareOptions ge{GREATER_EQUAL};
 
   FunctionContext ctx;
   for (auto _ : state) {
     Datum out;
-    ABORT_NOT_OK(Compare(&ctx, Datum(array), Datum(int64_t(0)), ge, &out));
+    ABORT_NOT_OK(Compare(&ctx, Datum(array), zero, ge, &out));
     benchmark::DoNotOptimize(out);
   }
 
   state.counters["size"] = static_cast<double>(memory_size);
   state.counters["null_percent"] = static_cast<double>(state.range(1));
-  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(CType));
 }
 
-static void CompareArrayArrayKernel(benchmark::State& state) {
+template <typename Type>
+static void CompareArrayArray(benchmark::State& state) {
+  using CType = typename Type::c_type;
+
   const int64_t memory_size = state.range(0);
-  const int64_t array_size = memory_size / sizeof(int64_t);
+  const int64_t array_size = memory_size / sizeof(CType);
   const double null_percent = static_cast<double>(state.range(1)) / 100.0;
   auto rand = random::RandomArrayGenerator(kSeed);
-  auto lhs = std::static_pointer_cast<NumericArray<Int64Type>>(
-      rand.Int64(array_size, -100, 100, null_percent));
-  auto rhs = std::static_pointer_cast<NumericArray<Int64Type>>(
-      rand.Int64(array_size, -100, 100, null_percent));
+  auto lhs = rand.Numeric<Type>(array_size, CType(-100), CType(100), null_percent);
+  auto rhs = rand.Numeric<Type>(array_size, CType(-100), CType(100), null_percent);
 
   CompareOptions ge(GREATER_EQUAL);
 
@@ -74,11 +80,49 @@ static void CompareArrayArrayKernel(benchmark::State& state) {
 
   state.counters["size"] = static_cast<double>(memory_size);
   state.counters["null_percent"] = static_cast<double>(state.range(1));
-  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t) * 2);
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(CType) * 2);
+}
+
+static void CompareArrayScalarKernel(benchmark::State& state) {
+  CompareArrayScalar<Int64Type>(state);
+}
+
+static void CompareArrayArrayKernel(benchmark::State& state) {
+  CompareArrayArray<Int64Type>(state);
+}
+
+static void CompareArrayScalarInt8(benchmark::State& state) {
+  CompareArrayScalar<Int8Type>(state);
+}
+
+static void CompareArrayScalarInt32(benchmark::State& state) {
+  CompareArrayScalar<Int32Type>(state);
+}
+
+static void CompareArrayScalarDouble(benchmark::State& state) {
+  CompareArrayScalar<DoubleType>(state);
+}
+
+static void CompareArrayArrayInt8(benchmark::State& state) {
+  CompareArrayArray<Int8Type>(state);
+}
+
+static void CompareArrayArrayInt32(benchmark::State& state) {
+  CompareArrayArray<Int32Type>(state);
+}
+
+static void CompareArrayArrayDouble(benchmark::State& state) {
+  CompareArrayArray<DoubleType>(state);
 }
 
 BENCHMARK(CompareArrayScalarKernel)->Apply(RegressionSetArgs);
 BENCHMARK(CompareArrayArrayKernel)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarInt8)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarInt32)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarDouble)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayArrayInt8)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayArrayInt32)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayArrayDouble)->Apply(RegressionSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
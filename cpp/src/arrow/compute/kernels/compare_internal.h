@@ -0,0 +1,211 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Comparison kernels over numeric values writing their results directly into
+// a bitmap. They are built once with the default compiler flags, and again
+// with the AVX2 and AVX512 flags in compare_avx2.cc and compare_avx512.cc;
+// compare.cc picks the best one the CPU supports at runtime.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__AVX512BW__) || defined(ARROW_HAVE_SSE4_2)
+#include <immintrin.h>
+#endif
+
+#include "arrow/compute/kernels/compare.h"
+
+namespace arrow {
+namespace compute {
+namespace detail {
+
+template <typename T>
+using CompareArrayArrayFunc = void (*)(CompareOperator op, const T* left, const T* right,
+                                       int64_t length, uint8_t* out);
+
+template <typename T>
+using CompareArrayScalarFunc = void (*)(CompareOperator op, const T* left, T right,
+                                        int64_t length, uint8_t* out);
+
+#define ARROW_DECLARE_COMPARE_KERNELS                                                 \
+  template <typename T>                                                               \
+  void CompareArrayArray(CompareOperator op, const T* left, const T* right,           \
+                         int64_t length, uint8_t* out);                               \
+  template <typename T>                                                               \
+  void CompareArrayScalar(CompareOperator op, const T* left, T right, int64_t length, \
+                          uint8_t* out);
+
+namespace avx2 {
+ARROW_DECLARE_COMPARE_KERNELS
+}  // namespace avx2
+
+namespace avx512 {
+ARROW_DECLARE_COMPARE_KERNELS
+}  // namespace avx512
+
+#undef ARROW_DECLARE_COMPARE_KERNELS
+
+// Everything below has internal linkage, so that each translation unit
+// including it gets its own copy built for its own instruction set. Code
+// built with the AVX flags must not end up in symbols shared with the rest
+// of the library, which is also why std::min and the like aren't used.
+
+// The values are compared by blocks, first into one byte per value in a loop
+// the compiler vectorizes, then packed into the output bits
+static constexpr int64_t kCompareBlockSize = 256;
+
+// Pack bytes which are 0 or 1 into bits. num_bytes must be a multiple of 8.
+static inline void PackBytesToBits(const uint8_t* bytes, int64_t num_bytes,
+                                   uint8_t* out) {
+#if defined(__AVX512BW__)
+  for (; num_bytes >= 64; num_bytes -= 64, bytes += 64, out += 8) {
+    const __m512i values = _mm512_loadu_si512(bytes);
+    const uint64_t bits = _mm512_test_epi8_mask(values, values);
+    std::memcpy(out, &bits, 8);
+  }
+#elif defined(__AVX2__)
+  for (; num_bytes >= 32; num_bytes -= 32, bytes += 32, out += 4) {
+    const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+    // movemask reads the high bit of each byte
+    const auto bits =
+        static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_slli_epi16(values, 7)));
+    std::memcpy(out, &bits, 4);
+  }
+#elif defined(ARROW_HAVE_SSE4_2)
+  for (; num_bytes >= 16; num_bytes -= 16, bytes += 16, out += 2) {
+    const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+    const auto bits =
+        static_cast<uint16_t>(_mm_movemask_epi8(_mm_slli_epi16(values, 7)));
+    std::memcpy(out, &bits, 2);
+  }
+#endif
+  for (; num_bytes > 0; num_bytes -= 8, bytes += 8, ++out) {
+    *out = static_cast<uint8_t>(bytes[0] | bytes[1] << 1 | bytes[2] << 2 |
+                                bytes[3] << 3 | bytes[4] << 4 | bytes[5] << 5 |
+                                bytes[6] << 6 | bytes[7] << 7);
+  }
+}
+
+template <CompareOperator Op, typename T>
+static inline bool CompareValues(T left, T right) {
+  switch (Op) {
+    case CompareOperator::EQUAL:
+      return left == right;
+    case CompareOperator::NOT_EQUAL:
+      return left != right;
+    case CompareOperator::GREATER:
+      return left > right;
+    case CompareOperator::GREATER_EQUAL:
+      return left >= right;
+    case CompareOperator::LESS:
+      return left < right;
+    case CompareOperator::LESS_EQUAL:
+      return left <= right;
+  }
+  return false;
+}
+
+template <CompareOperator Op, typename T, typename GetRight>
+static void CompareBlocks(const T* left, GetRight&& get_right, int64_t length,
+                          uint8_t* out) {
+  uint8_t bytes[kCompareBlockSize];
+  int64_t offset = 0;
+  for (; length - offset >= kCompareBlockSize; offset += kCompareBlockSize) {
+    for (int64_t i = 0; i < kCompareBlockSize; ++i) {
+      bytes[i] = CompareValues<Op>(left[offset + i], get_right(offset + i));
+    }
+    PackBytesToBits(bytes, kCompareBlockSize, out + offset / 8);
+  }
+
+  // The bits past the end of the last block are zeroed
+  const int64_t remaining = length - offset;
+  const int64_t padded = (remaining + 7) / 8 * 8;
+  for (int64_t i = 0; i < remaining; ++i) {
+    bytes[i] = CompareValues<Op>(left[offset + i], get_right(offset + i));
+  }
+  for (int64_t i = remaining; i < padded; ++i) {
+    bytes[i] = 0;
+  }
+  PackBytesToBits(bytes, padded, out + offset / 8);
+}
+
+template <typename T, typename GetRight>
+static void CompareWithOperator(CompareOperator op, const T* left, GetRight&& get_right,
+                                int64_t length, uint8_t* out) {
+  switch (op) {
+    case CompareOperator::EQUAL:
+      return CompareBlocks<CompareOperator::EQUAL>(left, get_right, length, out);
+    case CompareOperator::NOT_EQUAL:
+      return CompareBlocks<CompareOperator::NOT_EQUAL>(left, get_right, length, out);
+    case CompareOperator::GREATER:
+      return CompareBlocks<CompareOperator::GREATER>(left, get_right, length, out);
+    case CompareOperator::GREATER_EQUAL:
+      return CompareBlocks<CompareOperator::GREATER_EQUAL>(left, get_right, length, out);
+    case CompareOperator::LESS:
+      return CompareBlocks<CompareOperator::LESS>(left, get_right, length, out);
+    case CompareOperator::LESS_EQUAL:
+      return CompareBlocks<CompareOperator::LESS_EQUAL>(left, get_right, length, out);
+  }
+}
+
+/// \brief Write the bitmap of (left[i] op right[i]) for i in [0, length) to out,
+/// starting at bit 0
+template <typename T>
+static void CompareArrayArrayImpl(CompareOperator op, const T* left, const T* right,
+                                  int64_t length, uint8_t* out) {
+  CompareWithOperator(op, left, [right](int64_t i) { return right[i]; }, length, out);
+}
+
+/// \brief Write the bitmap of (left[i] op right) for i in [0, length) to out,
+/// starting at bit 0
+template <typename T>
+static void CompareArrayScalarImpl(CompareOperator op, const T* left, T right,
+                                   int64_t length, uint8_t* out) {
+  CompareWithOperator(op, left, [right](int64_t) { return right; }, length, out);
+}
+
+// Define the kernels of an instruction set namespace for all the C types of
+// the numeric and temporal Arrow types
+#define ARROW_DEFINE_COMPARE_KERNELS(T)                                                  \
+  template <>                                                                            \
+  void CompareArrayArray<T>(CompareOperator op, const T* left, const T* right,           \
+                            int64_t length, uint8_t* out) {                              \
+    CompareArrayArrayImpl(op, left, right, length, out);                                 \
+  }                                                                                      \
+  template <>                                                                            \
+  void CompareArrayScalar<T>(CompareOperator op, const T* left, T right, int64_t length, \
+                             uint8_t* out) {                                             \
+    CompareArrayScalarImpl(op, left, right, length, out);                                \
+  }
+
+#define ARROW_DEFINE_ALL_COMPARE_KERNELS \
+  ARROW_DEFINE_COMPARE_KERNELS(int8_t)   \
+  ARROW_DEFINE_COMPARE_KERNELS(uint8_t)  \
+  ARROW_DEFINE_COMPARE_KERNELS(int16_t)  \
+  ARROW_DEFINE_COMPARE_KERNELS(uint16_t) \
+  ARROW_DEFINE_COMPARE_KERNELS(int32_t)  \
+  ARROW_DEFINE_COMPARE_KERNELS(uint32_t) \
+  ARROW_DEFINE_COMPARE_KERNELS(int64_t)  \
+  ARROW_DEFINE_COMPARE_KERNELS(uint64_t) \
+  ARROW_DEFINE_COMPARE_KERNELS(float)    \
+  ARROW_DEFINE_COMPARE_KERNELS(double)
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
@@ -423,6 +423,28 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TYPED_TEST(TestNumericCompareKernel, CompareBlockBoundaries) {
+  // Numeric values are compared by blocks of 256, check the lengths around
+  // them, as well as sliced inputs
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  for (int64_t length : {1, 7, 8, 9, 255, 256, 257, 511, 1000}) {
+    for (int64_t offset : {0, 3}) {
+      auto lhs = rand.Numeric<TypeParam>(length + offset, 0, 10, 0.1)->Slice(offset);
+      auto rhs = rand.Numeric<TypeParam>(length + offset, 0, 10, 0.1)->Slice(offset);
+      auto five = Datum(std::make_shared<ScalarType>(CType(5)));
+      for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+        auto options = CompareOptions(op);
+        ValidateCompare<TypeParam>(&this->ctx_, options, lhs, rhs);
+        ValidateCompare<TypeParam>(&this->ctx_, options, lhs, five);
+        ValidateCompare<TypeParam>(&this->ctx_, options, five, lhs);
+      }
+    }
+  }
+}
+
 class TestStringCompareKernel : public ComputeFixture, public TestBase {};
 
 TEST_F(TestStringCompareKernel, SimpleCompareArrayScalar) {
@@ -0,0 +1,819 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/string.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/utf8.h"
+
+#ifdef ARROW_WITH_RE2
+#include <re2/re2.h>
+#include <re2/set.h>
+#endif
+
+namespace arrow {
+
+using internal::GenerateBitsUnrolled;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Case mapping
+
+// Only the codepoints of which both cases have the same UTF8 length are
+// mapped, so that the strings keep their length in bytes. The table covers
+// the blocks documented for Utf8Upper in string.h; keep both in sync.
+
+inline uint32_t UpperCodepoint(uint32_t c) {
+  if (c < 0x80) {
+    return (c >= 'a' && c <= 'z') ? c - 32 : c;
+  }
+  if (c < 0x100) {
+    // Latin-1 Supplement
+    if (c == 0xff) return 0x178;
+    return (c >= 0xe0 && c != 0xf7) ? c - 0x20 : c;
+  }
+  if (c < 0x180) {
+    // Latin Extended-A, pairs of upper and lower case letters
+    if (c < 0x130 || (c >= 0x132 && c < 0x138) || (c >= 0x14a && c < 0x178)) {
+      return c & ~1u;
+    }
+    if ((c >= 0x139 && c < 0x149) || (c >= 0x179 && c < 0x17f)) {
+      return (c % 2 == 0) ? c - 1 : c;
+    }
+    return c;
+  }
+  if (c >= 0x3b1 && c <= 0x3c9) {
+    // Greek, with final sigma
+    return c == 0x3c2 ? 0x3a3 : c - 0x20;
+  }
+  if (c >= 0x430 && c < 0x450) return c - 0x20;  // Cyrillic
+  if (c >= 0x450 && c < 0x460) return c - 0x50;
+  return c;
+}
+
+inline uint32_t LowerCodepoint(uint32_t c) {
+  if (c < 0x80) {
+    return (c >= 'A' && c <= 'Z') ? c + 32 : c;
+  }
+  if (c < 0x100) {
+    return (c >= 0xc0 && c <= 0xde && c != 0xd7) ? c + 0x20 : c;
+  }
+  if (c < 0x180) {
+    if (c < 0x130 || (c >= 0x132 && c < 0x138) || (c >= 0x14a && c < 0x178)) {
+      return c | 1u;
+    }
+    if ((c >= 0x139 && c < 0x149) || (c >= 0x179 && c < 0x17f)) {
+      return (c % 2 == 1) ? c + 1 : c;
+    }
+    return c == 0x178 ? 0xff : c;
+  }
+  if (c >= 0x391 && c <= 0x3a9 && c != 0x3a2) return c + 0x20;
+  if (c >= 0x410 && c < 0x430) return c + 0x20;
+  if (c >= 0x400 && c < 0x410) return c + 0x50;
+  return c;
+}
+
+// Branch-free so that the loop over a buffer is vectorized
+template <bool kUpper>
+inline uint8_t AsciiCase(uint8_t c) {
+  return kUpper ? static_cast<uint8_t>(c - (static_cast<uint8_t>(c - 'a') < 26) * 32)
+                : static_cast<uint8_t>(c + (static_cast<uint8_t>(c - 'A') < 26) * 32);
+}
+
+// Return the first non-ASCII byte in [data, end), or end
+inline const uint8_t* FindNonAscii(const uint8_t* data, const uint8_t* end) {
+  while (end - data >= 8) {
+    uint64_t word;
+    std::memcpy(&word, data, 8);
+    const uint64_t high_bits = BitUtil::FromLittleEndian(word) & 0x8080808080808080ULL;
+    if (high_bits != 0) {
+      return data + BitUtil::CountTrailingZeros(high_bits) / 8;
+    }
+    data += 8;
+  }
+  while (data < end && *data < 0x80) {
+    ++data;
+  }
+  return data;
+}
+
+template <bool kUpper>
+Status TransformCase(const uint8_t* data, int64_t nbytes, uint8_t* out) {
+  if (util::ValidateAscii(data, nbytes)) {
+    for (int64_t i = 0; i < nbytes; ++i) {
+      out[i] = AsciiCase<kUpper>(data[i]);
+    }
+    return Status::OK();
+  }
+
+  const uint8_t* end = data + nbytes;
+  while (data < end) {
+    // Convert the run of ASCII bytes up to the next non-ASCII codepoint at once
+    const uint8_t* run_end = FindNonAscii(data, end);
+    const int64_t run_length = run_end - data;
+    for (int64_t i = 0; i < run_length; ++i) {
+      out[i] = AsciiCase<kUpper>(data[i]);
+    }
+    data = run_end;
+    out += run_length;
+    if (data == end) break;
+
+    uint32_t codepoint;
+    if (ARROW_PREDICT_FALSE(!util::UTF8Decode(&data, end, &codepoint))) {
+      return Status::Invalid("Invalid UTF8 sequence in input");
+    }
+    out = util::UTF8Encode(out, kUpper ? UpperCodepoint(codepoint)
+                                       : LowerCodepoint(codepoint));
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Substring search and pattern matching
+
+// Return the first occurrence of the pattern in [begin, end), or end. memchr
+// is vectorized by the C library.
+inline const uint8_t* FindSubstring(const uint8_t* begin, const uint8_t* end,
+                                    const uint8_t* pattern, int64_t pattern_length) {
+  if (pattern_length == 0) {
+    return begin;
+  }
+  while (end - begin >= pattern_length) {
+    auto candidate = static_cast<const uint8_t*>(
+        std::memchr(begin, pattern[0], end - begin - pattern_length + 1));
+    if (candidate == nullptr) break;
+    if (std::memcmp(candidate + 1, pattern + 1, pattern_length - 1) == 0) {
+      return candidate;
+    }
+    begin = candidate + 1;
+  }
+  return end;
+}
+
+// A pattern matching the strings equal to, starting with, ending with or
+// containing a literal
+struct LiteralPattern {
+  enum Kind { EXACT, PREFIX, SUFFIX, CONTAINS };
+
+  Kind kind;
+  std::string literal;
+
+  bool Match(const uint8_t* data, int64_t length) const {
+    const auto pattern = reinterpret_cast<const uint8_t*>(literal.data());
+    const auto pattern_length = static_cast<int64_t>(literal.size());
+    switch (kind) {
+      case EXACT:
+        return length == pattern_length &&
+               std::memcmp(data, pattern, pattern_length) == 0;
+      case PREFIX:
+        return length >= pattern_length &&
+               std::memcmp(data, pattern, pattern_length) == 0;
+      case SUFFIX:
+        return length >= pattern_length &&
+               std::memcmp(data + length - pattern_length, pattern, pattern_length) == 0;
+      case CONTAINS:
+        return FindSubstring(data, data + length, pattern, pattern_length) !=
+               data + length;
+    }
+    return false;
+  }
+};
+
+// Escape the characters of s which are special in a regular expression
+std::string QuoteRegex(const std::string& s) {
+  std::string quoted;
+  for (const char c : s) {
+    const auto byte = static_cast<uint8_t>(c);
+    if (c == '\0') {
+      quoted += "\\x00";
+      continue;
+    }
+    if (byte < 0x80 && !std::isalnum(byte) && c != '_') {
+      quoted += '\\';
+    }
+    quoted += c;
+  }
+  return quoted;
+}
+
+// Translate a LIKE pattern into a literal pattern if its only wildcards are '%'
+// at its ends, otherwise into a regular expression matching whole strings
+Status TranslateLikePattern(const std::string& pattern, bool* is_literal,
+                            LiteralPattern* literal, std::string* regex) {
+  bool leading_any = false;
+  bool trailing_any = false;
+  bool simple = true;
+  std::string text;
+  regex->clear();
+
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    char c = pattern[i];
+    if (c == '%') {
+      if (text.empty() && simple) {
+        leading_any = true;
+      } else {
+        trailing_any = true;
+      }
+      *regex += ".*";
+      continue;
+    }
+    if (c == '_') {
+      simple = false;
+      *regex += '.';
+      continue;
+    }
+    if (c == '\\') {
+      if (++i == pattern.size()) {
+        return Status::Invalid("Unexpected escape char at the end of pattern ",
+                               pattern);
+      }
+      c = pattern[i];
+      if (c != '%' && c != '_' && c != '\\') {
+        return Status::Invalid("Invalid escape sequence in pattern ", pattern,
+                               " at offset ", i - 1);
+      }
+    }
+    if (trailing_any) {
+      // A literal character after an inner '%'
+      simple = false;
+    }
+    text += c;
+    *regex += QuoteRegex(std::string(1, c));
+  }
+
+  *is_literal = simple;
+  if (simple) {
+    literal->kind = leading_any ? (trailing_any ? LiteralPattern::CONTAINS
+                                                : LiteralPattern::SUFFIX)
+                                : (trailing_any ? LiteralPattern::PREFIX
+                                                : LiteralPattern::EXACT);
+    literal->literal = std::move(text);
+  }
+  return Status::OK();
+}
+
+// Translate a regular expression into a literal pattern if it has no
+// metacharacters other than a leading '^' and a trailing '$'
+bool TranslateRegexPattern(const std::string& pattern, LiteralPattern* literal) {
+  size_t begin = 0;
+  size_t end = pattern.size();
+  const bool anchor_start = end > 0 && pattern[0] == '^';
+  begin += anchor_start;
+  const bool anchor_end = end > begin && pattern[end - 1] == '$';
+  end -= anchor_end;
+
+  for (size_t i = begin; i < end; ++i) {
+    if (std::strchr("\\.+*?()|[]{}^$", pattern[i]) != nullptr ||
+        pattern[i] == '\0') {
+      return false;
+    }
+  }
+  literal->kind = anchor_start ? (anchor_end ? LiteralPattern::EXACT
+                                             : LiteralPattern::PREFIX)
+                               : (anchor_end ? LiteralPattern::SUFFIX
+                                             : LiteralPattern::CONTAINS);
+  literal->literal = pattern.substr(begin, end - begin);
+  return true;
+}
+
+// Match strings against a set of patterns. The literal patterns are checked
+// first, cheapest first, and the regular expressions are matched at once by
+// a RE2::Set.
+class PatternMatcher {
+ public:
+  static Result<std::shared_ptr<PatternMatcher>> Make(
+      const MatchPatternsOptions& options) {
+    std::shared_ptr<PatternMatcher> matcher(new PatternMatcher());
+    std::vector<std::string> regexes;
+    for (const auto& pattern : options.patterns) {
+      LiteralPattern literal;
+      bool is_literal;
+      std::string regex;
+      if (options.syntax == MatchPatternsOptions::LIKE) {
+        RETURN_NOT_OK(TranslateLikePattern(pattern, &is_literal, &literal, &regex));
+      } else {
+        is_literal = TranslateRegexPattern(pattern, &literal);
+        regex = pattern;
+      }
+      if (is_literal) {
+        matcher->literals_.push_back(std::move(literal));
+      } else {
+        regexes.push_back(std::move(regex));
+      }
+    }
+    std::stable_sort(matcher->literals_.begin(), matcher->literals_.end(),
+                     [](const LiteralPattern& left, const LiteralPattern& right) {
+                       return left.kind < right.kind;
+                     });
+    if (!regexes.empty()) {
+      RETURN_NOT_OK(matcher->CompileRegexes(options.syntax, regexes));
+    }
+    return matcher;
+  }
+
+  bool Match(const uint8_t* data, int64_t length) const {
+    for (const auto& literal : literals_) {
+      if (literal.Match(data, length)) {
+        return true;
+      }
+    }
+#ifdef ARROW_WITH_RE2
+    if (regexes_) {
+      return regexes_->Match(
+          re2::StringPiece(reinterpret_cast<const char*>(data), length), nullptr);
+    }
+#endif
+    return false;
+  }
+
+ private:
+  PatternMatcher() = default;
+
+#ifdef ARROW_WITH_RE2
+  Status CompileRegexes(MatchPatternsOptions::Syntax syntax,
+                        const std::vector<std::string>& regexes) {
+    RE2::Options re2_options;
+    re2_options.set_log_errors(false);
+    // LIKE patterns match whole strings, and their wildcards match newlines
+    RE2::Anchor anchor = RE2::UNANCHORED;
+    if (syntax == MatchPatternsOptions::LIKE) {
+      re2_options.set_dot_nl(true);
+      anchor = RE2::ANCHOR_BOTH;
+    }
+    regexes_.reset(new RE2::Set(re2_options, anchor));
+    for (const auto& regex : regexes) {
+      std::string error;
+      if (regexes_->Add(regex, &error) < 0) {
+        return Status::Invalid("Invalid regular expression ", regex, ": ", error);
+      }
+    }
+    if (!regexes_->Compile()) {
+      return Status::CapacityError("Could not compile the regular expressions");
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<RE2::Set> regexes_;
+#else
+  Status CompileRegexes(MatchPatternsOptions::Syntax,
+                        const std::vector<std::string>& regexes) {
+    return Status::NotImplemented("Matching pattern ", regexes[0],
+                                  " requires Arrow to be built with ARROW_WITH_RE2");
+  }
+#endif
+
+  std::vector<LiteralPattern> literals_;
+};
+
+// ----------------------------------------------------------------------
+// Kernels
+
+// Base class of the kernels over the strings of a StringArray or
+// LargeStringArray. The validity bitmap of the input is propagated to the output.
+template <typename Type>
+class StringUnaryKernel : public UnaryKernel {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    static const offset_type kEmptyOffsets[1] = {0};
+
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+
+    // The offsets buffer of an empty array may be missing
+    const offset_type* offsets = in_data.length > 0
+                                     ? in_data.GetValues<offset_type>(1)
+                                     : kEmptyOffsets;
+    const uint8_t* data = in_data.buffers[2] ? in_data.buffers[2]->data() : nullptr;
+    return Exec(ctx, in_data, offsets, data, result);
+  }
+
+ protected:
+  virtual Status Exec(FunctionContext* ctx, const ArrayData& input,
+                      const offset_type* offsets, const uint8_t* data,
+                      ArrayData* out) = 0;
+
+  // Offsets of input rebased to start at zero, sharing the input buffer if they
+  // already do
+  Status RebaseOffsets(FunctionContext* ctx, const ArrayData& input,
+                       const offset_type* offsets, std::shared_ptr<Buffer>* out) {
+    if (input.offset == 0 && offsets[0] == 0 && input.buffers[1]) {
+      *out = input.buffers[1];
+      return Status::OK();
+    }
+    RETURN_NOT_OK(ctx->Allocate((input.length + 1) * sizeof(offset_type), out));
+    auto out_offsets = reinterpret_cast<offset_type*>((*out)->mutable_data());
+    for (int64_t i = 0; i <= input.length; ++i) {
+      out_offsets[i] = offsets[i] - offsets[0];
+    }
+    return Status::OK();
+  }
+};
+
+template <typename Type, bool kUpper>
+class Utf8CaseKernel : public StringUnaryKernel<Type> {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<Type>::type_singleton();
+  }
+
+ protected:
+  // The whole data range is converted at once, since case mapping does not
+  // change the length of the strings in bytes
+  Status Exec(FunctionContext* ctx, const ArrayData& input, const offset_type* offsets,
+              const uint8_t* data, ArrayData* out) override {
+    const int64_t nbytes = offsets[input.length] - offsets[0];
+    std::shared_ptr<Buffer> out_offsets, out_data;
+    RETURN_NOT_OK(this->RebaseOffsets(ctx, input, offsets, &out_offsets));
+    RETURN_NOT_OK(ctx->Allocate(nbytes, &out_data));
+    RETURN_NOT_OK(
+        TransformCase<kUpper>(data + offsets[0], nbytes, out_data->mutable_data()));
+
+    out->buffers = {out->buffers[0], std::move(out_offsets), std::move(out_data)};
+    return Status::OK();
+  }
+};
+
+template <typename Type>
+using Utf8UpperKernel = Utf8CaseKernel<Type, true>;
+
+template <typename Type>
+using Utf8LowerKernel = Utf8CaseKernel<Type, false>;
+
+template <typename Type>
+class Utf8LengthKernel : public StringUnaryKernel<Type> {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  std::shared_ptr<DataType> out_type() const override {
+    return std::is_same<Type, LargeStringType>::value ? int64() : int32();
+  }
+
+ protected:
+  Status Exec(FunctionContext* ctx, const ArrayData& input, const offset_type* offsets,
+              const uint8_t* data, ArrayData* out) override {
+    std::shared_ptr<Buffer> out_data;
+    RETURN_NOT_OK(ctx->Allocate(input.length * sizeof(offset_type), &out_data));
+    auto lengths = reinterpret_cast<offset_type*>(out_data->mutable_data());
+
+    const int64_t nbytes = offsets[input.length] - offsets[0];
+    if (util::ValidateAscii(data + offsets[0], nbytes)) {
+      for (int64_t i = 0; i < input.length; ++i) {
+        lengths[i] = offsets[i + 1] - offsets[i];
+      }
+    } else {
+      for (int64_t i = 0; i < input.length; ++i) {
+        lengths[i] = static_cast<offset_type>(
+            util::UTF8Length(data + offsets[i], offsets[i + 1] - offsets[i]));
+      }
+    }
+
+    out->buffers = {out->buffers[0], std::move(out_data)};
+    return Status::OK();
+  }
+};
+
+template <typename Type>
+class Utf8SubstringKernel : public StringUnaryKernel<Type> {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  explicit Utf8SubstringKernel(const SubstringOptions& options) : options_(options) {}
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<Type>::type_singleton();
+  }
+
+ protected:
+  // The substrings are no longer than the input, so the output data is
+  // allocated once at the size of the input data and shrunk at the end.
+  Status Exec(FunctionContext* ctx, const ArrayData& input, const offset_type* offsets,
+              const uint8_t* data, ArrayData* out) override {
+    const int64_t nbytes = offsets[input.length] - offsets[0];
+    std::shared_ptr<Buffer> out_offsets_buffer;
+    RETURN_NOT_OK(
+        ctx->Allocate((input.length + 1) * sizeof(offset_type), &out_offsets_buffer));
+    ARROW_ASSIGN_OR_RAISE(auto out_data,
+                          AllocateResizableBuffer(nbytes, ctx->memory_pool()));
+
+    auto out_offsets = reinterpret_cast<offset_type*>(out_offsets_buffer->mutable_data());
+    uint8_t* out_start = out_data->mutable_data();
+    uint8_t* out_end = out_start;
+    const bool ascii = util::ValidateAscii(data + offsets[0], nbytes);
+
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < input.length; ++i) {
+      const uint8_t* begin = data + offsets[i];
+      const uint8_t* end = data + offsets[i + 1];
+      if (ascii) {
+        Slice(end - begin, &begin, &end);
+      } else {
+        SliceUtf8(&begin, &end);
+      }
+      std::memcpy(out_end, begin, end - begin);
+      out_end += end - begin;
+      out_offsets[i + 1] = static_cast<offset_type>(out_end - out_start);
+    }
+
+    RETURN_NOT_OK(out_data->Resize(out_end - out_start));
+    out->buffers = {out->buffers[0], std::move(out_offsets_buffer), std::move(out_data)};
+    return Status::OK();
+  }
+
+ private:
+  // Narrow [*begin, *end) to the substring of a string of the given number of
+  // codepoints, with one byte per codepoint
+  void Slice(int64_t length, const uint8_t** begin, const uint8_t** end) const {
+    const int64_t start = options_.start >= 0
+                              ? std::min(options_.start, length)
+                              : std::max<int64_t>(0, length + options_.start);
+    const int64_t stop = (options_.length < 0 || options_.length > length - start)
+                             ? length
+                             : start + options_.length;
+    *end = *begin + stop;
+    *begin += start;
+  }
+
+  void SliceUtf8(const uint8_t** begin, const uint8_t** end) const {
+    int64_t start = options_.start;
+    if (start < 0) {
+      start = std::max<int64_t>(0, util::UTF8Length(*begin, *end - *begin) + start);
+    }
+    *begin = util::UTF8AdvanceCodepoints(*begin, *end, start);
+    if (options_.length >= 0) {
+      *end = util::UTF8AdvanceCodepoints(*begin, *end, options_.length);
+    }
+  }
+
+  SubstringOptions options_;
+};
+
+template <typename Type>
+class StartsWithKernel : public StringUnaryKernel<Type> {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  explicit StartsWithKernel(const std::string& prefix) : prefix_(prefix) {}
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+ protected:
+  Status Exec(FunctionContext* ctx, const ArrayData& input, const offset_type* offsets,
+              const uint8_t* data, ArrayData* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto out_data,
+                          AllocateBitmap(input.length, ctx->memory_pool()));
+
+    const auto prefix_length = static_cast<int64_t>(prefix_.size());
+    const char* prefix = prefix_.data();
+    int64_t i = 0;
+    GenerateBitsUnrolled(out_data->mutable_data(), 0, input.length, [&]() {
+      const bool match = offsets[i + 1] - offsets[i] >= prefix_length &&
+                         std::memcmp(data + offsets[i], prefix, prefix_length) == 0;
+      ++i;
+      return match;
+    });
+
+    out->buffers = {out->buffers[0], std::move(out_data)};
+    return Status::OK();
+  }
+
+ private:
+  std::string prefix_;
+};
+
+template <typename Type>
+class SplitPatternKernel : public StringUnaryKernel<Type> {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  explicit SplitPatternKernel(const SplitPatternOptions& options)
+      : pattern_(reinterpret_cast<const uint8_t*>(options.pattern.data())),
+        pattern_length_(static_cast<int64_t>(options.pattern.size())),
+        max_splits_(options.max_splits) {}
+
+  std::shared_ptr<DataType> out_type() const override {
+    return std::is_same<Type, LargeStringType>::value ? large_list(large_utf8())
+                                                       : list(utf8());
+  }
+
+ protected:
+  // The strings are split twice, first to count the pieces and their bytes so
+  // that the output buffers are allocated once, then to copy the pieces
+  Status Exec(FunctionContext* ctx, const ArrayData& input, const offset_type* offsets,
+              const uint8_t* data, ArrayData* out) override {
+    const uint8_t* validity =
+        input.GetNullCount() > 0 ? input.buffers[0]->data() : nullptr;
+    auto IsValid = [&](int64_t i) {
+      return validity == nullptr || BitUtil::GetBit(validity, input.offset + i);
+    };
+
+    int64_t num_pieces = 0;
+    int64_t num_bytes = 0;
+    for (int64_t i = 0; i < input.length; ++i) {
+      if (!IsValid(i)) continue;
+      const int64_t num_splits = Split(data + offsets[i], data + offsets[i + 1],
+                                       [](const uint8_t*, const uint8_t*) {});
+      num_pieces += num_splits + 1;
+      num_bytes += offsets[i + 1] - offsets[i] - num_splits * pattern_length_;
+    }
+
+    std::shared_ptr<Buffer> list_offsets_buffer, piece_offsets_buffer, piece_data;
+    RETURN_NOT_OK(
+        ctx->Allocate((input.length + 1) * sizeof(offset_type), &list_offsets_buffer));
+    RETURN_NOT_OK(
+        ctx->Allocate((num_pieces + 1) * sizeof(offset_type), &piece_offsets_buffer));
+    RETURN_NOT_OK(ctx->Allocate(num_bytes, &piece_data));
+
+    auto list_offsets =
+        reinterpret_cast<offset_type*>(list_offsets_buffer->mutable_data());
+    auto piece_offsets =
+        reinterpret_cast<offset_type*>(piece_offsets_buffer->mutable_data());
+    uint8_t* out_start = piece_data->mutable_data();
+    uint8_t* out_end = out_start;
+    int64_t piece = 0;
+
+    list_offsets[0] = 0;
+    piece_offsets[0] = 0;
+    for (int64_t i = 0; i < input.length; ++i) {
+      if (IsValid(i)) {
+        auto Append = [&](const uint8_t* begin, const uint8_t* end) {
+          std::memcpy(out_end, begin, end - begin);
+          out_end += end - begin;
+          piece_offsets[++piece] = static_cast<offset_type>(out_end - out_start);
+        };
+        Split(data + offsets[i], data + offsets[i + 1], Append);
+      }
+      list_offsets[i + 1] = static_cast<offset_type>(piece);
+    }
+    DCHECK_EQ(piece, num_pieces);
+    DCHECK_EQ(out_end - out_start, num_bytes);
+
+    out->buffers = {out->buffers[0], std::move(list_offsets_buffer)};
+    out->child_data = {ArrayData::Make(TypeTraits<Type>::type_singleton(), num_pieces,
+                                       {nullptr, std::move(piece_offsets_buffer),
+                                        std::move(piece_data)},
+                                       /*null_count=*/0)};
+    return Status::OK();
+  }
+
+ private:
+  // Call on_piece for each piece of [begin, end) and return the number of splits
+  template <typename OnPiece>
+  int64_t Split(const uint8_t* begin, const uint8_t* end, OnPiece&& on_piece) const {
+    int64_t num_splits = 0;
+    while (max_splits_ < 0 || num_splits < max_splits_) {
+      const uint8_t* found = FindSubstring(begin, end, pattern_, pattern_length_);
+      if (found == end) break;
+      on_piece(begin, found);
+      begin = found + pattern_length_;
+      ++num_splits;
+    }
+    on_piece(begin, end);
+    return num_splits;
+  }
+
+  const uint8_t* pattern_;
+  int64_t pattern_length_;
+  int64_t max_splits_;
+};
+
+template <typename Type>
+class MatchPatternsKernel : public StringUnaryKernel<Type> {
+ public:
+  using offset_type = typename Type::offset_type;
+
+  explicit MatchPatternsKernel(std::shared_ptr<const PatternMatcher> matcher)
+      : matcher_(std::move(matcher)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+ protected:
+  Status Exec(FunctionContext* ctx, const ArrayData& input, const offset_type* offsets,
+              const uint8_t* data, ArrayData* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto out_data,
+                          AllocateBitmap(input.length, ctx->memory_pool()));
+
+    // Null strings are not matched, their output bit is left unset
+    const uint8_t* validity =
+        input.GetNullCount() > 0 ? input.buffers[0]->data() : nullptr;
+    int64_t i = 0;
+    GenerateBitsUnrolled(out_data->mutable_data(), 0, input.length, [&]() {
+      const bool match =
+          (validity == nullptr || BitUtil::GetBit(validity, input.offset + i)) &&
+          matcher_->Match(data + offsets[i], offsets[i + 1] - offsets[i]);
+      ++i;
+      return match;
+    });
+
+    out->buffers = {out->buffers[0], std::move(out_data)};
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<const PatternMatcher> matcher_;
+};
+
+// Run a kernel instantiated for the type of value over each of its chunks
+template <template <typename> class KernelType, typename... Args>
+Status ExecStringKernel(FunctionContext* ctx, const char* name, const Datum& value,
+                        Datum* out, Args&&... args) {
+  std::unique_ptr<UnaryKernel> kernel;
+  const auto type = value.type();
+  if (type != nullptr && type->id() == Type::STRING) {
+    kernel.reset(new KernelType<StringType>(std::forward<Args>(args)...));
+  } else if (type != nullptr && type->id() == Type::LARGE_STRING) {
+    kernel.reset(new KernelType<LargeStringType>(std::forward<Args>(args)...));
+  } else {
+    return Status::NotImplemented(name, " is not implemented for ",
+                                  type ? type->ToString() : "this input");
+  }
+  util::InitializeUTF8();
+
+  std::vector<Datum> result;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, kernel.get(), value, &result));
+  *out = detail::WrapDatumsLike(value, kernel->out_type(), result);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Utf8Upper(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return ExecStringKernel<Utf8UpperKernel>(ctx, "Utf8Upper", value, out);
+}
+
+Status Utf8Lower(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return ExecStringKernel<Utf8LowerKernel>(ctx, "Utf8Lower", value, out);
+}
+
+Status Utf8Length(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return ExecStringKernel<Utf8LengthKernel>(ctx, "Utf8Length", value, out);
+}
+
+Status Utf8Substring(FunctionContext* ctx, const Datum& value,
+                     const SubstringOptions& options, Datum* out) {
+  return ExecStringKernel<Utf8SubstringKernel>(ctx, "Utf8Substring", value, out,
+                                               options);
+}
+
+Status StartsWith(FunctionContext* ctx, const Datum& value, const std::string& prefix,
+                  Datum* out) {
+  return ExecStringKernel<StartsWithKernel>(ctx, "StartsWith", value, out, prefix);
+}
+
+Status SplitPattern(FunctionContext* ctx, const Datum& value,
+                    const SplitPatternOptions& options, Datum* out) {
+  if (options.pattern.empty()) {
+    return Status::Invalid("Empty separator");
+  }
+  return ExecStringKernel<SplitPatternKernel>(ctx, "SplitPattern", value, out, options);
+}
+
+Status MatchPatterns(FunctionContext* ctx, const Datum& value,
+                     const MatchPatternsOptions& options, Datum* out) {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const PatternMatcher> matcher,
+                        PatternMatcher::Make(options));
+  return ExecStringKernel<MatchPatternsKernel>(ctx, "MatchPatterns", value, out,
+                                               std::move(matcher));
+}
+
+}  // namespace compute
+}  // namespace arrow
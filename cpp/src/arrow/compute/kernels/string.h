@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Convert each string of a string or large string datum to upper case
+///
+/// This is not full Unicode case mapping: only the letters of a few blocks
+/// are converted, those whose upper case has the same UTF8 length:
+/// ASCII, the Latin-1 Supplement (U+00E0 to U+00FF, except U+00F7),
+/// Latin Extended-A (U+0100 to U+017F), the unaccented basic Greek letters
+/// (U+03B1 to U+03C9) and basic Cyrillic (U+0430 to U+045F). All other
+/// codepoints are copied unchanged, including cased letters of other blocks
+/// (e.g. Latin Extended-B, accented Greek, Armenian, Cyrillic Supplement or
+/// fullwidth Latin) and letters such as U+00DF whose upper case is longer.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of type utf8 or large_utf8
+/// \param[out] out resulting datum, of the same type as value
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Upper(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Convert each string of a string or large string datum to lower case
+///
+/// The inverse of Utf8Upper, with the same limited coverage: only the upper
+/// case letters of the blocks listed there are converted, and all other
+/// codepoints are copied unchanged.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of type utf8 or large_utf8
+/// \param[out] out resulting datum, of the same type as value
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Lower(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the number of codepoints of each string
+///
+/// For example given value = ["abc", "héhé", null], the output will be
+/// [3, 4, null]
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of type utf8 or large_utf8
+/// \param[out] out resulting datum, of type int32 for utf8 and int64 for
+///            large_utf8
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Length(FunctionContext* context, const Datum& value, Datum* out);
+
+struct ARROW_EXPORT SubstringOptions {
+  explicit SubstringOptions(int64_t start = 0, int64_t length = -1)
+      : start(start), length(length) {}
+
+  /// Index of the first codepoint, counted from the end of the string if negative
+  int64_t start;
+  /// Maximum number of codepoints, or -1 for the rest of the string
+  int64_t length;
+};
+
+/// \brief Extract a substring of each string, in codepoints
+///
+/// For example given value = ["abc", "héhé", null] and options = {1, 2}, the
+/// output will be ["bc", "éh", null]
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of type utf8 or large_utf8
+/// \param[in] options the position and length of the substrings
+/// \param[out] out resulting datum, of the same type as value
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Substring(FunctionContext* context, const Datum& value,
+                     const SubstringOptions& options, Datum* out);
+
+/// \brief Test whether each string starts with a prefix
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of type utf8 or large_utf8
+/// \param[in] prefix the prefix to look for
+/// \param[out] out resulting boolean datum, null where value is null
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status StartsWith(FunctionContext* context, const Datum& value, const std::string& prefix,
+                  Datum* out);
+
+struct ARROW_EXPORT SplitPatternOptions {
+  explicit SplitPatternOptions(std::string pattern, int64_t max_splits = -1)
+      : pattern(std::move(pattern)), max_splits(max_splits) {}
+
+  /// The separator, which must not be empty
+  std::string pattern;
+  /// Maximum number of splits from the start of each string, or -1 for no limit
+  int64_t max_splits;
+};
+
+/// \brief Split each string at each occurrence of a separator
+///
+/// For example given value = ["a,b", "", null, "a,,b"] and pattern ",", the
+/// output will be [["a", "b"], [""], null, ["a", "", "b"]]
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of type utf8 or large_utf8
+/// \param[in] options the separator and the maximum number of splits
+/// \param[out] out resulting datum, of type list(utf8) for utf8 and
+///            large_list(large_utf8) for large_utf8
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SplitPattern(FunctionContext* context, const Datum& value,
+                    const SplitPatternOptions& options, Datum* out);
+
+struct ARROW_EXPORT MatchPatternsOptions {
+  enum Syntax {
+    /// SQL LIKE patterns, where '%' matches any sequence of characters, '_' any
+    /// single character, and '\' escapes either of them or itself
+    LIKE,
+    /// RE2 regular expressions, matching anywhere in the string unless anchored
+    REGEX
+  };
+
+  explicit MatchPatternsOptions(std::vector<std::string> patterns, Syntax syntax = LIKE)
+      : patterns(std::move(patterns)), syntax(syntax) {}
+
+  std::vector<std::string> patterns;
+  Syntax syntax;
+};
+
+/// \brief Test whether each string matches any of a set of patterns
+///
+/// Patterns which are literal strings, possibly anchored at the start or at
+/// the end, are searched for directly. The other patterns are compiled into
+/// a single RE2 set, so that all of them are matched in one pass over each
+/// string. Those require Arrow to be built with ARROW_WITH_RE2.
+///
+/// For example given value = ["apple", "banana", null] and the LIKE patterns
+/// ["%nan%", "a_p%"], the output will be [true, true, null]
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of type utf8 or large_utf8
+/// \param[in] options the patterns and their syntax
+/// \param[out] out resulting boolean datum, null where value is null
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MatchPatterns(FunctionContext* context, const Datum& value,
+                     const MatchPatternsOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
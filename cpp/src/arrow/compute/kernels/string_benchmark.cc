@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "arrow/builder.h"
+#include "arrow/compute/kernels/string.h"
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x5717;
+
+// Strings of 0 to 32 bytes, with a non-ASCII letter appended to each if utf8
+static std::shared_ptr<Array> MakeStrings(const RegressionArgs& args, bool utf8) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = std::static_pointer_cast<StringArray>(
+      rand.String(args.size / 16, 0, 32, args.null_proportion));
+  if (!utf8) {
+    return array;
+  }
+
+  StringBuilder builder;
+  for (int64_t i = 0; i < array->length(); ++i) {
+    if (array->IsNull(i)) {
+      ABORT_NOT_OK(builder.AppendNull());
+    } else {
+      ABORT_NOT_OK(builder.Append(array->GetString(i) + "\xc3\xa9"));
+    }
+  }
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(builder.Finish(&out));
+  return out;
+}
+
+static void StringBenchmark(
+    benchmark::State& state, bool utf8,
+    std::function<Status(FunctionContext*, const Datum&, Datum*)> func) {
+  RegressionArgs args(state);
+  auto values = MakeStrings(args, utf8);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(func(&ctx, Datum(values), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void Utf8UpperAscii(benchmark::State& state) {
+  StringBenchmark(state, false, Utf8Upper);
+}
+
+static void Utf8UpperUtf8(benchmark::State& state) {
+  StringBenchmark(state, true, Utf8Upper);
+}
+
+static void Utf8LengthAscii(benchmark::State& state) {
+  StringBenchmark(state, false, Utf8Length);
+}
+
+static void Utf8LengthUtf8(benchmark::State& state) {
+  StringBenchmark(state, true, Utf8Length);
+}
+
+static void Utf8SubstringAscii(benchmark::State& state) {
+  StringBenchmark(state, false, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return Utf8Substring(ctx, value, SubstringOptions(2, 8), out);
+  });
+}
+
+static void Utf8SubstringUtf8(benchmark::State& state) {
+  StringBenchmark(state, true, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return Utf8Substring(ctx, value, SubstringOptions(2, 8), out);
+  });
+}
+
+static void StartsWithAscii(benchmark::State& state) {
+  StringBenchmark(state, false, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return StartsWith(ctx, value, "ab", out);
+  });
+}
+
+static void SplitPatternAscii(benchmark::State& state) {
+  StringBenchmark(state, false, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return SplitPattern(ctx, value, SplitPatternOptions("a"), out);
+  });
+}
+
+static void MatchLikeLiterals(benchmark::State& state) {
+  StringBenchmark(state, false, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return MatchPatterns(ctx, value, MatchPatternsOptions({"ab%", "%xyz", "%foo%"}),
+                         out);
+  });
+}
+
+#ifdef ARROW_WITH_RE2
+static void MatchLikeWildcards(benchmark::State& state) {
+  StringBenchmark(state, false, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return MatchPatterns(ctx, value, MatchPatternsOptions({"a_b%", "%x%y%", "%f_o%"}),
+                         out);
+  });
+}
+#endif
+
+BENCHMARK(Utf8UpperAscii)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8UpperUtf8)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8LengthAscii)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8LengthUtf8)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8SubstringAscii)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8SubstringUtf8)->Apply(RegressionSetArgs);
+BENCHMARK(StartsWithAscii)->Apply(RegressionSetArgs);
+BENCHMARK(SplitPatternAscii)->Apply(RegressionSetArgs);
+BENCHMARK(MatchLikeLiterals)->Apply(RegressionSetArgs);
+#ifdef ARROW_WITH_RE2
+BENCHMARK(MatchLikeWildcards)->Apply(RegressionSetArgs);
+#endif
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,310 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/string.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename Type>
+class TestStringKernels : public ComputeFixture, public TestBase {
+ protected:
+  using StringFunction = std::function<Status(FunctionContext*, const Datum&, Datum*)>;
+
+  std::shared_ptr<DataType> type() { return TypeTraits<Type>::type_singleton(); }
+
+  std::shared_ptr<DataType> offset_type() {
+    return std::is_same<Type, LargeStringType>::value ? int64() : int32();
+  }
+
+  std::shared_ptr<DataType> list_type() {
+    return std::is_same<Type, LargeStringType>::value ? large_list(large_utf8())
+                                                       : list(utf8());
+  }
+
+  void CheckUnary(StringFunction func, const std::string& json_input,
+                  const std::shared_ptr<DataType>& out_type,
+                  const std::string& json_expected) {
+    Datum out;
+    ASSERT_OK(func(&this->ctx_, ArrayFromJSON(type(), json_input), &out));
+    auto actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(out_type, json_expected), *actual, true);
+  }
+};
+
+using StringTypes = ::testing::Types<StringType, LargeStringType>;
+
+TYPED_TEST_SUITE(TestStringKernels, StringTypes);
+
+TYPED_TEST(TestStringKernels, Utf8Upper) {
+  this->CheckUnary(Utf8Upper, "[]", this->type(), "[]");
+  this->CheckUnary(Utf8Upper, R"(["aAazZ{", null, "", "hello, World 123"])", this->type(),
+                   R"(["AAAZZ{", null, "", "HELLO, WORLD 123"])");
+  this->CheckUnary(Utf8Upper, R"(["héhé", "ÿß×", "ăĺžſ", "αβς", "яёѐ", "中文"])",
+                   this->type(), R"(["HÉHÉ", "Ÿß×", "ĂĹŽſ", "ΑΒΣ", "ЯЁЀ", "中文"])");
+}
+
+TYPED_TEST(TestStringKernels, Utf8Lower) {
+  this->CheckUnary(Utf8Lower, "[]", this->type(), "[]");
+  this->CheckUnary(Utf8Lower, R"(["aAazZ[", null, "", "HELLO, World 123"])", this->type(),
+                   R"(["aaazz[", null, "", "hello, world 123"])");
+  this->CheckUnary(Utf8Lower, R"(["HÉHÉ", "Ÿ×", "ĂĹŽİ", "ΑΒΣ", "ЯЁЀ", "中文"])",
+                   this->type(), R"(["héhé", "ÿ×", "ăĺžİ", "αβσ", "яёѐ", "中文"])");
+}
+
+TYPED_TEST(TestStringKernels, Utf8CaseInvalid) {
+  auto array = ArrayFromJSON(this->type(), R"(["ab", "cd"])");
+  auto data = array->data()->Copy();
+  // Replace "cd" by a truncated 2-byte sequence
+  auto values = std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>("ab\xc3"), 3);
+  data->buffers[2] = values;
+  auto offsets = ArrayFromJSON(this->offset_type(), "[0, 2, 3]");
+  data->buffers[1] = offsets->data()->buffers[1];
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Utf8Upper(&this->ctx_, MakeArray(data), &out));
+}
+
+TYPED_TEST(TestStringKernels, Utf8Length) {
+  this->CheckUnary(Utf8Length, "[]", this->offset_type(), "[]");
+  this->CheckUnary(Utf8Length, R"(["abc", null, "", "a b"])", this->offset_type(),
+                   "[3, null, 0, 3]");
+  this->CheckUnary(Utf8Length, R"(["abc", "héhé", null, "中文", "😀"])",
+                   this->offset_type(), "[3, 4, null, 2, 1]");
+}
+
+TYPED_TEST(TestStringKernels, Utf8Substring) {
+  auto Substring = [](int64_t start, int64_t length) {
+    return [start, length](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return Utf8Substring(ctx, value, SubstringOptions(start, length), out);
+    };
+  };
+
+  this->CheckUnary(Substring(0, -1), "[]", this->type(), "[]");
+  this->CheckUnary(Substring(1, 2), R"(["abcd", null, "", "a", "ab"])", this->type(),
+                   R"(["bc", null, "", "", "b"])");
+  this->CheckUnary(Substring(1, -1), R"(["abcd", "a"])", this->type(), R"(["bcd", ""])");
+  this->CheckUnary(Substring(-2, 1), R"(["abcd", "a", ""])", this->type(),
+                   R"(["c", "a", ""])");
+  this->CheckUnary(Substring(1, 2), R"(["héhé", "中文字", "😀"])", this->type(),
+                   R"(["éh", "文字", ""])");
+  this->CheckUnary(Substring(-3, -1), R"(["héhé", "ab", "中文字"])", this->type(),
+                   R"(["éhé", "ab", "中文字"])");
+}
+
+TYPED_TEST(TestStringKernels, StartsWith) {
+  auto StartsWithAb = [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return StartsWith(ctx, value, "ab", out);
+  };
+  auto StartsWithEmpty = [](FunctionContext* ctx, const Datum& value, Datum* out) {
+    return StartsWith(ctx, value, "", out);
+  };
+
+  this->CheckUnary(StartsWithAb, "[]", boolean(), "[]");
+  this->CheckUnary(StartsWithAb, R"(["abc", null, "", "a", "ab", "cab", "éab"])",
+                   boolean(), "[true, null, false, false, true, false, false]");
+  this->CheckUnary(StartsWithEmpty, R"(["abc", null, ""])", boolean(),
+                   "[true, null, true]");
+}
+
+TYPED_TEST(TestStringKernels, SplitPattern) {
+  auto Split = [](const std::string& pattern, int64_t max_splits) {
+    return [pattern, max_splits](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return SplitPattern(ctx, value, SplitPatternOptions(pattern, max_splits), out);
+    };
+  };
+
+  this->CheckUnary(Split(",", -1), "[]", this->list_type(), "[]");
+  this->CheckUnary(Split(",", -1), R"(["a,b", "", null, "a,,b", ",", "abc"])",
+                   this->list_type(),
+                   R"([["a", "b"], [""], null, ["a", "", "b"], ["", ""], ["abc"]])");
+  this->CheckUnary(Split("--", -1), R"(["a--b---c", "--", "a-b"])", this->list_type(),
+                   R"([["a", "b", "-c"], ["", ""], ["a-b"]])");
+  this->CheckUnary(Split("é", 1), R"(["héhé", "é"])", this->list_type(),
+                   R"([["h", "hé"], ["", ""]])");
+  this->CheckUnary(Split(",", 0), R"(["a,b"])", this->list_type(), R"([["a,b"]])");
+
+  Datum out;
+  ASSERT_RAISES(Invalid, SplitPattern(&this->ctx_, ArrayFromJSON(this->type(), "[]"),
+                                      SplitPatternOptions(""), &out));
+}
+
+TYPED_TEST(TestStringKernels, MatchLikeLiterals) {
+  auto Like = [](std::vector<std::string> patterns) {
+    return [patterns](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return MatchPatterns(ctx, value, MatchPatternsOptions(patterns), out);
+    };
+  };
+  const std::string input = R"(["abc", null, "", "xabcx", "cab", "a%c", "a_c"])";
+
+  this->CheckUnary(Like({"abc"}), "[]", boolean(), "[]");
+  this->CheckUnary(Like({"abc"}), input, boolean(),
+                   "[true, null, false, false, false, false, false]");
+  this->CheckUnary(Like({"ab%"}), input, boolean(),
+                   "[true, null, false, false, false, false, false]");
+  this->CheckUnary(Like({"%ab"}), input, boolean(),
+                   "[false, null, false, false, true, false, false]");
+  this->CheckUnary(Like({"%%b%"}), input, boolean(),
+                   "[true, null, false, true, true, false, false]");
+  this->CheckUnary(Like({"%"}), input, boolean(),
+                   "[true, null, true, true, true, true, true]");
+  this->CheckUnary(Like({""}), input, boolean(),
+                   "[false, null, true, false, false, false, false]");
+  this->CheckUnary(Like({R"(%\%%)", R"(a\_c)"}), input, boolean(),
+                   "[false, null, false, false, false, true, true]");
+  this->CheckUnary(Like({}), input, boolean(),
+                   "[false, null, false, false, false, false, false]");
+
+  Datum out;
+  auto values = ArrayFromJSON(this->type(), "[]");
+  ASSERT_RAISES(Invalid, MatchPatterns(&this->ctx_, values,
+                                       MatchPatternsOptions({R"(ab\)"}), &out));
+  ASSERT_RAISES(Invalid, MatchPatterns(&this->ctx_, values,
+                                       MatchPatternsOptions({R"(a\bc)"}), &out));
+}
+
+TYPED_TEST(TestStringKernels, MatchRegexLiterals) {
+  auto Regex = [](std::vector<std::string> patterns) {
+    return [patterns](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return MatchPatterns(
+          ctx, value, MatchPatternsOptions(patterns, MatchPatternsOptions::REGEX), out);
+    };
+  };
+  const std::string input = R"(["abc", null, "", "xabcx", "cab"])";
+
+  this->CheckUnary(Regex({"^abc$"}), input, boolean(),
+                   "[true, null, false, false, false]");
+  this->CheckUnary(Regex({"^ab"}), input, boolean(), "[true, null, false, false, false]");
+  this->CheckUnary(Regex({"ab$"}), input, boolean(), "[false, null, false, false, true]");
+  this->CheckUnary(Regex({"ab", "zz"}), input, boolean(),
+                   "[true, null, false, true, true]");
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestStringKernels, MatchLikeWildcards) {
+  auto Like = [](std::vector<std::string> patterns) {
+    return [patterns](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return MatchPatterns(ctx, value, MatchPatternsOptions(patterns), out);
+    };
+  };
+  const std::string input = R"(["abc", null, "", "a\nc", "aéc", "a.c", "abbc"])";
+
+  this->CheckUnary(Like({"a_c"}), input, boolean(),
+                   "[true, null, false, true, true, true, false]");
+  this->CheckUnary(Like({"a%c"}), input, boolean(),
+                   "[true, null, false, true, true, true, true]");
+  this->CheckUnary(Like({"a.c", "%bb%", "zz%"}), input, boolean(),
+                   "[false, null, false, false, false, true, true]");
+  this->CheckUnary(Like({"_b%", R"(a\_%)"}), input, boolean(),
+                   "[true, null, false, false, false, false, true]");
+}
+
+TYPED_TEST(TestStringKernels, MatchRegex) {
+  auto Regex = [](std::vector<std::string> patterns) {
+    return [patterns](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return MatchPatterns(
+          ctx, value, MatchPatternsOptions(patterns, MatchPatternsOptions::REGEX), out);
+    };
+  };
+  const std::string input = R"(["abc", null, "", "error 404", "ERROR 500", "a.c"])";
+
+  this->CheckUnary(Regex({"a.c"}), input, boolean(),
+                   "[true, null, false, false, false, true]");
+  this->CheckUnary(Regex({R"(^a\.c$)"}), input, boolean(),
+                   "[false, null, false, false, false, true]");
+  this->CheckUnary(Regex({R"(error \d+)", "(?i)^error 5"}), input, boolean(),
+                   "[false, null, false, true, true, false]");
+  this->CheckUnary(Regex({"^$", "xyz", "b+"}), input, boolean(),
+                   "[true, null, true, false, false, false]");
+
+  Datum out;
+  ASSERT_RAISES(Invalid,
+                MatchPatterns(&this->ctx_, ArrayFromJSON(this->type(), "[]"),
+                              MatchPatternsOptions({"(ab"}, MatchPatternsOptions::REGEX),
+                              &out));
+}
+#else
+TYPED_TEST(TestStringKernels, MatchRegexUnavailable) {
+  Datum out;
+  ASSERT_RAISES(NotImplemented,
+                MatchPatterns(&this->ctx_, ArrayFromJSON(this->type(), R"(["a"])"),
+                              MatchPatternsOptions({"a_c"}), &out));
+}
+#endif
+
+TYPED_TEST(TestStringKernels, SlicedInput) {
+  auto array = ArrayFromJSON(this->type(), R"(["xx", "ab", null, "cd,é", "yy"])");
+  auto sliced = array->Slice(1, 3);
+
+  Datum out;
+  ASSERT_OK(Utf8Upper(&this->ctx_, sliced, &out));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(this->type(), R"(["AB", null, "CD,É"])"),
+                    *out.make_array(), true);
+
+  ASSERT_OK(Utf8Length(&this->ctx_, sliced, &out));
+  AssertArraysEqual(*ArrayFromJSON(this->offset_type(), "[2, null, 4]"),
+                    *out.make_array(), true);
+
+  ASSERT_OK(SplitPattern(&this->ctx_, sliced, SplitPatternOptions(","), &out));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(this->list_type(), R"([["ab"], null, ["cd", "é"]])"),
+                    *out.make_array(), true);
+
+  ASSERT_OK(MatchPatterns(&this->ctx_, sliced, MatchPatternsOptions({"%d%"}), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, null, true]"), *out.make_array(),
+                    true);
+}
+
+TYPED_TEST(TestStringKernels, ChunkedInput) {
+  auto input = ChunkedArrayFromJSON(this->type(), {R"(["ab", null])", R"(["cd"])"});
+
+  Datum out;
+  ASSERT_OK(Utf8Upper(&this->ctx_, input, &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  auto expected = ChunkedArrayFromJSON(this->type(), {R"(["AB", null])", R"(["CD"])"});
+  AssertChunkedEqual(*expected, *out.chunked_array());
+}
+
+TEST(TestStringKernelsErrors, NonStringInput) {
+  FunctionContext ctx;
+  Datum out;
+  ASSERT_RAISES(NotImplemented, Utf8Upper(&ctx, ArrayFromJSON(int32(), "[1]"), &out));
+  ASSERT_RAISES(NotImplemented,
+                StartsWith(&ctx, ArrayFromJSON(binary(), R"(["a"])"), "a", &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -22,10 +22,12 @@
 
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/sum_simd_internal.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -54,6 +56,30 @@ struct FindAccumulatorType<I, enable_if_floating_point<I>> {
   using Type = DoubleType;
 };
 
+// The sum loops over C values for the best instruction set supported by the
+// CPU, see sum_simd_internal.h
+template <typename T>
+struct SumKernels {
+  detail::SumDenseFunc<T> dense;
+  detail::SumSparseFunc<T> sparse;
+
+  static const SumKernels& Get() {
+    static const internal::DynamicDispatch<SumKernels> dispatch{
+        {internal::DispatchLevel::NONE,
+         {detail::SumDenseImpl<T>, detail::SumSparseImpl<T>}},
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+        {internal::DispatchLevel::AVX2,
+         {detail::avx2::SumDense<T>, detail::avx2::SumSparse<T>}},
+#endif
+#ifdef ARROW_HAVE_RUNTIME_AVX512
+        {internal::DispatchLevel::AVX512,
+         {detail::avx512::SumDense<T>, detail::avx512::SumSparse<T>}},
+#endif
+    };
+    return dispatch.func;
+  }
+};
+
 template <typename ArrowType, typename StateType>
 class SumAggregateFunction final : public AggregateFunctionStaticState<StateType> {
   using CType = typename TypeTraits<ArrowType>::CType;
@@ -99,13 +125,8 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
   StateType ConsumeDense(const ArrayType& array) const {
     StateType local;
 
-    const auto values = array.raw_values();
-    const int64_t length = array.length();
-    for (int64_t i = 0; i < length; i++) {
-      local.sum += values[i];
-    }
-
-    local.count = length;
+    local.sum = SumKernels<CType>::Get().dense(array.raw_values(), array.length());
+    local.count = array.length();
 
     return local;
   }
@@ -127,77 +148,15 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
     return local;
   }
 
-  // While this is not branchless, gcc needs this to be in a different function
-  // for it to generate cmov which ends to be slightly faster than
-  // multiplication but safe for handling NaN with doubles.
-  inline CType MaskedValue(bool valid, CType value) const { return valid ? value : 0; }
-
-  inline StateType UnrolledSum(uint8_t bits, const CType* values) const {
-    StateType local;
-
-    if (bits < 0xFF) {
-      // Some nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += MaskedValue(bits & (1U << i), values[i]);
-      }
-      local.count += BitUtil::kBytePopcount[bits];
-    } else {
-      // No nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += values[i];
-      }
-      local.count += 8;
-    }
-
-    return local;
-  }
-
   StateType ConsumeSparse(const ArrayType& array) const {
     StateType local;
 
-    // Sliced bitmaps on non-byte positions induce problem with the branchless
-    // unrolled technique. Thus extra padding is added on both left and right
-    // side of the slice such that both ends are byte-aligned. The first and
-    // last bitmap are properly masked to ignore extra values induced by
-    // padding.
-    //
-    // The execution is divided in 3 sections.
-    //
-    // 1. Compute the sum of the first masked byte.
-    // 2. Compute the sum of the middle bytes
-    // 3. Compute the sum of the last masked byte.
-
-    const int64_t length = array.length();
-    const int64_t offset = array.offset();
-
-    // The number of bytes covering the range, this includes partial bytes.
-    // This number bounded by `<= (length / 8) + 2`, e.g. a possible extra byte
-    // on the left, and on the right.
-    const int64_t covering_bytes = BitUtil::CoveringBytes(offset, length);
-    DCHECK_GE(covering_bytes, 3);
-
-    // Align values to the first batch of 8 elements. Note that raw_values() is
-    // already adjusted with the offset, thus we rewind a little to align to
-    // the closest 8-batch offset.
-    const auto values = array.raw_values() - (offset % 8);
-
-    // Align bitmap at the first consumable byte.
-    const auto bitmap = array.null_bitmap_data() + BitUtil::RoundDown(offset, 8) / 8;
-
-    // Consume the first (potentially partial) byte.
-    const uint8_t first_mask = BitUtil::kTrailingBitmask[offset % 8];
-    local += UnrolledSum(bitmap[0] & first_mask, values);
-
-    // Consume the (full) middle bytes. The loop iterates in unit of
-    // batches of 8 values and 1 byte of bitmap.
-    for (int64_t i = 1; i < covering_bytes - 1; i++) {
-      local += UnrolledSum(bitmap[i], &values[i * 8]);
-    }
-
-    // Consume the last (potentially partial) byte.
-    const int64_t last_idx = covering_bytes - 1;
-    const uint8_t last_mask = BitUtil::kPrecedingWrappingBitmask[(offset + length) % 8];
-    local += UnrolledSum(bitmap[last_idx] & last_mask, &values[last_idx * 8]);
+    DCHECK_GE(BitUtil::CoveringBytes(array.offset(), array.length()), 3);
+    int64_t count = 0;
+    local.sum = SumKernels<CType>::Get().sparse(
+        array.raw_values(), array.null_bitmap_data(), array.offset(), array.length(),
+        &count);
+    local.count = count;
 
     return local;
   }
@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Sum loops over C values. They are built once with the default compiler
+// flags, and again with the AVX2 and AVX512 flags in sum_avx2.cc and
+// sum_avx512.cc; sum_internal.h picks the best one the CPU supports at runtime.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace arrow {
+namespace compute {
+namespace detail {
+
+// The type values are summed into, see FindAccumulatorType
+template <typename T>
+using SumCType = typename std::conditional<
+    std::is_floating_point<T>::value, double,
+    typename std::conditional<std::is_signed<T>::value, int64_t,
+                              uint64_t>::type>::type;
+
+template <typename T>
+using SumDenseFunc = SumCType<T> (*)(const T* values, int64_t length);
+
+template <typename T>
+using SumSparseFunc = SumCType<T> (*)(const T* values, const uint8_t* bitmap,
+                                      int64_t offset, int64_t length, int64_t* count);
+
+#define ARROW_DECLARE_SUM_KERNELS                                                   \
+  template <typename T>                                                             \
+  SumCType<T> SumDense(const T* values, int64_t length);                            \
+  template <typename T>                                                             \
+  SumCType<T> SumSparse(const T* values, const uint8_t* bitmap, int64_t offset,     \
+                        int64_t length, int64_t* count);
+
+namespace avx2 {
+ARROW_DECLARE_SUM_KERNELS
+}  // namespace avx2
+
+namespace avx512 {
+ARROW_DECLARE_SUM_KERNELS
+}  // namespace avx512
+
+#undef ARROW_DECLARE_SUM_KERNELS
+
+// Everything below has internal linkage, so that each translation unit
+// including it gets its own copy built for its own instruction set.
+
+/// \brief Sum values[0, length)
+template <typename T>
+static SumCType<T> SumDenseImpl(const T* values, int64_t length) {
+  SumCType<T> sum = 0;
+  for (int64_t i = 0; i < length; i++) {
+    sum += values[i];
+  }
+  return sum;
+}
+
+// While this is not branchless, gcc needs this to be in a different function
+// for it to generate cmov which ends to be slightly faster than
+// multiplication but safe for handling NaN with doubles.
+template <typename T>
+static inline T MaskedValue(bool valid, T value) {
+  return valid ? value : 0;
+}
+
+template <typename T>
+static inline SumCType<T> UnrolledSum(uint8_t bits, const T* values, int64_t* count) {
+  SumCType<T> sum = 0;
+
+  if (bits < 0xFF) {
+    // Some nulls
+    for (int i = 0; i < 8; i++) {
+      const bool valid = (bits >> i) & 1;
+      sum += MaskedValue(valid, values[i]);
+      *count += valid;
+    }
+  } else {
+    // No nulls
+    for (int i = 0; i < 8; i++) {
+      sum += values[i];
+    }
+    *count += 8;
+  }
+
+  return sum;
+}
+
+/// \brief Sum the values[i] for i in [0, length) whose bit offset + i is set in
+/// bitmap, and add their number to count
+///
+/// The values of the whole bytes of bitmap covering the range must be readable,
+/// and the range must cover at least 3 bytes.
+template <typename T>
+static SumCType<T> SumSparseImpl(const T* values, const uint8_t* bitmap, int64_t offset,
+                                 int64_t length, int64_t* count) {
+  // Sliced bitmaps on non-byte positions induce problem with the branchless
+  // unrolled technique. Thus extra padding is added on both left and right
+  // side of the slice such that both ends are byte-aligned. The first and
+  // last bitmap are properly masked to ignore extra values induced by
+  // padding.
+  //
+  // The execution is divided in 3 sections.
+  //
+  // 1. Compute the sum of the first masked byte.
+  // 2. Compute the sum of the middle bytes
+  // 3. Compute the sum of the last masked byte.
+
+  // The number of bytes covering the range, this includes partial bytes.
+  // This number bounded by `<= (length / 8) + 2`, e.g. a possible extra byte
+  // on the left, and on the right.
+  const int64_t covering_bytes = (offset % 8 + length + 7) / 8;
+
+  // Align values to the first batch of 8 elements.
+  values -= offset % 8;
+
+  // Align bitmap at the first consumable byte.
+  bitmap += offset / 8;
+
+  // Consume the first (potentially partial) byte.
+  const auto first_mask = static_cast<uint8_t>(0xFF << (offset % 8));
+  SumCType<T> sum = 0;
+  sum += UnrolledSum(bitmap[0] & first_mask, values, count);
+
+  // Consume the (full) middle bytes. The loop iterates in unit of
+  // batches of 8 values and 1 byte of bitmap.
+  for (int64_t i = 1; i < covering_bytes - 1; i++) {
+    sum += UnrolledSum(bitmap[i], &values[i * 8], count);
+  }
+
+  // Consume the last (potentially partial) byte.
+  const int64_t last_idx = covering_bytes - 1;
+  const int last_bits = static_cast<int>((offset + length) % 8);
+  const auto last_mask =
+      static_cast<uint8_t>(last_bits == 0 ? 0xFF : (1 << last_bits) - 1);
+  sum += UnrolledSum(bitmap[last_idx] & last_mask, &values[last_idx * 8], count);
+
+  return sum;
+}
+
+// Define the kernels of an instruction set namespace for all the C types of
+// the numeric Arrow types
+#define ARROW_DEFINE_SUM_KERNELS(T)                                                \
+  template <>                                                                      \
+  SumCType<T> SumDense<T>(const T* values, int64_t length) {                       \
+    return SumDenseImpl(values, length);                                           \
+  }                                                                                \
+  template <>                                                                      \
+  SumCType<T> SumSparse<T>(const T* values, const uint8_t* bitmap, int64_t offset, \
+                           int64_t length, int64_t* count) {                       \
+    return SumSparseImpl(values, bitmap, offset, length, count);                   \
+  }
+
+#define ARROW_DEFINE_ALL_SUM_KERNELS \
+  ARROW_DEFINE_SUM_KERNELS(int8_t)   \
+  ARROW_DEFINE_SUM_KERNELS(uint8_t)  \
+  ARROW_DEFINE_SUM_KERNELS(int16_t)  \
+  ARROW_DEFINE_SUM_KERNELS(uint16_t) \
+  ARROW_DEFINE_SUM_KERNELS(int32_t)  \
+  ARROW_DEFINE_SUM_KERNELS(uint32_t) \
+  ARROW_DEFINE_SUM_KERNELS(int64_t)  \
+  ARROW_DEFINE_SUM_KERNELS(uint64_t) \
+  ARROW_DEFINE_SUM_KERNELS(float)    \
+  ARROW_DEFINE_SUM_KERNELS(double)
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
@@ -25,7 +25,13 @@
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse_util.h"
+
+#ifdef ARROW_HAVE_AVX2
+#include <immintrin.h>
+#endif  // ARROW_HAVE_AVX2
 
 namespace arrow {
 namespace csv {
@@ -75,13 +81,105 @@ class SpecializedOptions {
   static constexpr bool escaping = Escaping;
 };
 
+// A helper class copying a run of regular characters, up to the next
+// occurrence of any of (up to) four special characters.  With SIMD support,
+// 32 (AVX2) or 16 (SSE) bytes are compared against all special characters
+// at once, so that long runs of regular characters are copied without going
+// through the parsing state machine.
+class SpecialCharFinder {
+ public:
+#if defined(ARROW_HAVE_AVX2)
+  static constexpr int64_t kVectorSize = 32;
+#elif defined(ARROW_HAVE_SSE4_2)
+  static constexpr int64_t kVectorSize = 16;
+#else
+  static constexpr int64_t kVectorSize = 0;
+#endif
+  static constexpr int64_t kShortRunSize = 8;
+
+  SpecialCharFinder(char c1, char c2, char c3, char c4)
+      : c1_(c1), c2_(c2), c3_(c3), c4_(c4) {
+#if defined(ARROW_HAVE_AVX2)
+    v1_ = _mm256_set1_epi8(c1);
+    v2_ = _mm256_set1_epi8(c2);
+    v3_ = _mm256_set1_epi8(c3);
+    v4_ = _mm256_set1_epi8(c4);
+#elif defined(ARROW_HAVE_SSE4_2)
+    v1_ = _mm_set1_epi8(c1);
+    v2_ = _mm_set1_epi8(c2);
+    v3_ = _mm_set1_epi8(c3);
+    v4_ = _mm_set1_epi8(c4);
+#endif
+  }
+
+  // Copy characters from [data, data_end) to `out` until the first special
+  // character, and return the number of characters copied.  `out` must have
+  // room for kVectorSize bytes past the copied characters.
+  int64_t CopyRun(const char* data, const char* data_end, uint8_t* out) const {
+    const char* start = data;
+    // Short fields are common, handle their characters without vector overhead
+    const char* scalar_end = std::min(data_end, data + kShortRunSize);
+    while (data < scalar_end && !IsSpecial(*data)) {
+      *out++ = static_cast<uint8_t>(*data++);
+    }
+    if (data < scalar_end) {
+      return data - start;
+    }
+    out -= data - start;
+#if defined(ARROW_HAVE_AVX2)
+    while (data_end - data >= kVectorSize) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + (data - start)), v);
+      const __m256i matches = _mm256_or_si256(
+          _mm256_or_si256(_mm256_cmpeq_epi8(v, v1_), _mm256_cmpeq_epi8(v, v2_)),
+          _mm256_or_si256(_mm256_cmpeq_epi8(v, v3_), _mm256_cmpeq_epi8(v, v4_)));
+      const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+      if (mask != 0) {
+        return (data - start) + BitUtil::CountTrailingZeros(mask);
+      }
+      data += kVectorSize;
+    }
+#elif defined(ARROW_HAVE_SSE4_2)
+    while (data_end - data >= kVectorSize) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + (data - start)), v);
+      const __m128i matches =
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, v1_), _mm_cmpeq_epi8(v, v2_)),
+                       _mm_or_si128(_mm_cmpeq_epi8(v, v3_), _mm_cmpeq_epi8(v, v4_)));
+      const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+      if (mask != 0) {
+        return (data - start) + BitUtil::CountTrailingZeros(mask);
+      }
+      data += kVectorSize;
+    }
+#endif
+    while (data < data_end && !IsSpecial(*data)) {
+      out[data - start] = static_cast<uint8_t>(*data);
+      ++data;
+    }
+    return data - start;
+  }
+
+ protected:
+  bool IsSpecial(char c) const { return c == c1_ || c == c2_ || c == c3_ || c == c4_; }
+
+  const char c1_, c2_, c3_, c4_;
+#if defined(ARROW_HAVE_AVX2)
+  __m256i v1_, v2_, v3_, v4_;
+#elif defined(ARROW_HAVE_SSE4_2)
+  __m128i v1_, v2_, v3_, v4_;
+#endif
+};
+
 // A helper class allocating the buffer for parsed values and writing into it
 // without any further resizes, except at the end.
 class BlockParser::PresizedParsedWriter {
  public:
   PresizedParsedWriter(MemoryPool* pool, uint32_t size)
       : parsed_size_(0), parsed_capacity_(size) {
-    parsed_buffer_ = *AllocateResizableBuffer(parsed_capacity_, pool);
+    // Allow SpecialCharFinder to overshoot when copying runs of characters
+    parsed_buffer_ = *AllocateResizableBuffer(
+        parsed_capacity_ + SpecialCharFinder::kVectorSize, pool);
     parsed_ = parsed_buffer_->mutable_data();
   }
 
@@ -97,6 +195,15 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Push a run of regular characters, return the end of the run
+  const char* PushFieldRun(const SpecialCharFinder& finder, const char* data,
+                           const char* data_end) {
+    const int64_t length = finder.CopyRun(data, data_end, parsed_ + parsed_size_);
+    parsed_size_ += length;
+    DCHECK_LE(parsed_size_, parsed_capacity_);
+    return data + length;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -223,6 +330,15 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
   auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
 
+  // Characters which interrupt a run of regular field characters
+  const SpecialCharFinder unquoted_finder(
+      options_.delimiter, '\r', '\n',
+      SpecializedOptions::escaping ? options_.escape_char : options_.delimiter);
+  const SpecialCharFinder quoted_finder(
+      options_.quote_char, options_.quote_char,
+      SpecializedOptions::escaping ? options_.escape_char : options_.quote_char,
+      options_.quote_char);
+
   values_writer->BeginLine();
   parsed_writer->BeginLine();
 
@@ -258,6 +374,7 @@ FieldStart:
 
 InField:
   // Inside a non-quoted part of a field
+  data = parsed_writer->PushFieldRun(unquoted_finder, data, data_end);
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -290,6 +407,7 @@ InField:
 
 InQuotedField:
   // Inside a quoted part of a field
+  data = parsed_writer->PushFieldRun(quoted_finder, data, data_end);
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -34,6 +34,11 @@ namespace csv {
 // >> For a static/global string constant, use a C style string instead
 const char* one_row = "abc,\"d,f\",12.34,\n";
 const char* one_row_escaped = "abc,d\\,f,12.34,\n";
+// Rows with long fields benefit the most from bulk scanning of field contents
+const char* one_row_long =
+    "Lorem ipsum dolor sit amet consectetur adipiscing elit,"
+    "\"sed do eiusmod tempor, incididunt ut labore et dolore magna aliqua\","
+    "1234567890123456,Ut enim ad minim veniam quis nostrud exercitation\n";
 
 const auto num_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row));
 
@@ -139,11 +144,23 @@ static void ParseCSVEscapedBlock(benchmark::State& state) {  // NOLINT non-const
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void ParseCSVLongFieldsBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto num_long_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row_long));
+  auto csv = BuildCSVData(one_row_long, num_long_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, num_long_rows, options);
+}
+
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
 BENCHMARK(ParseCSVQuotedBlock);
 BENCHMARK(ParseCSVEscapedBlock);
+BENCHMARK(ParseCSVLongFieldsBlock);
 
 }  // namespace csv
 }  // namespace arrow
@@ -580,6 +580,44 @@ TEST(BlockParser, Escaping) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Exercise bulk scanning of field contents, with special characters
+  // at all positions relative to the vector width
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+  for (int32_t pos = 0; pos < 70; ++pos) {
+    const std::string a(pos, 'a');
+    const std::string b(70 - pos, 'b');
+    {
+      auto csv = MakeCSVData({a + "," + b + "\n", b + "," + a + "\r\n"});
+      BlockParser parser(options);
+      AssertParseOk(parser, csv);
+      AssertColumnsEq(parser, {{a, b}, {b, a}});
+    }
+    {
+      auto csv = MakeCSVData({"\"" + a + ",\"\"\n" + b + "\"," + b + a + "\n"});
+      BlockParser parser(options);
+      AssertParseOk(parser, csv);
+      AssertColumnsEq(parser, {{a + ",\"\n" + b}, {b + a}}, {{true}, {false}});
+    }
+    {
+      auto csv = MakeCSVData({a + "\\," + b + "," + b + "\\\"" + a + "\n"});
+      BlockParser parser(options);
+      AssertParseOk(parser, csv);
+      AssertColumnsEq(parser, {{a + "," + b}, {b + "\"" + a}});
+    }
+    {
+      // Truncated line
+      BlockParser parser(options);
+      const std::string line = a + "," + b + "\n";
+      AssertParsePartial(parser, line + b + "," + a, static_cast<uint32_t>(line.size()));
+      AssertColumnsEq(parser, {{a}, {b}});
+      AssertParseFinal(parser, b + "," + a);
+      AssertColumnsEq(parser, {{b}, {a}});
+    }
+  }
+}
+
 // Generate test data with the given number of columns.
 std::string MakeLotsOfCsvColumns(int32_t num_columns) {
   std::string values, header;
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -40,6 +41,7 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -716,6 +718,143 @@ class SerialStreamingReader : public BaseStreamingReader {
   std::shared_ptr<SerialBlockReader> block_reader_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Parallel StreamingReader implementation
+
+// Blocks are chunked serially, then parsed and converted on the thread pool.
+// Column decoders hand out converted chunks in block order, so they act as
+// a reorder buffer.  At most `max_blocks_in_flight_` blocks are being
+// processed ahead of the consumer: new blocks are only read from the input
+// when the consumer asks for more batches.
+
+class ThreadedStreamingReader : public BaseStreamingReader {
+ public:
+  ThreadedStreamingReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                          const ReadOptions& read_options,
+                          const ParseOptions& parse_options,
+                          const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : BaseStreamingReader(pool, input, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool),
+        max_blocks_in_flight_(thread_pool->GetCapacity() + 1) {}
+
+  ~ThreadedStreamingReader() override {
+    // Make sure all pending tasks are finished before we start destroying
+    // BaseStreamingReader members
+    for (const auto& future : parse_futures_) {
+      future.Wait();
+    }
+    if (task_group_) {
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  Status Init() override {
+    ARROW_ASSIGN_OR_RAISE(auto istream_it,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+
+    int32_t block_queue_size = thread_pool_->GetCapacity();
+    ARROW_ASSIGN_OR_RAISE(auto rh_it,
+                          MakeReadaheadIterator(std::move(istream_it), block_queue_size));
+    buffer_iterator_ = CSVBufferIterator::Make(std::move(rh_it));
+    task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
+
+    // Read schema from first batch
+    ARROW_ASSIGN_OR_RAISE(pending_batch_, ReadNext());
+    DCHECK_NE(schema_, nullptr);
+    return Status::OK();
+  }
+
+ protected:
+  Result<std::shared_ptr<RecordBatch>> ReadNext() override {
+    if (eof_) {
+      return nullptr;
+    }
+    if (block_reader_ == nullptr) {
+      Status st = SetupReader();
+      if (!st.ok()) {
+        // Can't setup reader => bail out
+        eof_ = true;
+        return st;
+      }
+    }
+    auto batch = std::move(pending_batch_);
+    if (batch != nullptr) {
+      return batch;
+    }
+
+    Status st = ProcessBlocks();
+    if (!st.ok()) {
+      // Parse error => bail out
+      eof_ = true;
+      return st;
+    }
+    ++num_batches_read_;
+    return DecodeNextBatch();
+  }
+
+  Status SetupReader() {
+    ARROW_ASSIGN_OR_RAISE(auto first_buffer, buffer_iterator_.Next());
+    if (first_buffer == nullptr) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(MakeColumnDecoders());
+
+    block_reader_ = std::make_shared<ThreadedBlockReader>(MakeChunker(parse_options_),
+                                                          std::move(buffer_iterator_),
+                                                          std::move(first_buffer));
+    return Status::OK();
+  }
+
+  // Launch parse tasks for new blocks, then hand over parsed blocks to the
+  // column decoders in order.  Only the block needed for the next batch is
+  // waited for.
+  Status ProcessBlocks() {
+    while (!source_eof_ && num_blocks_read_ - num_batches_read_ < max_blocks_in_flight_) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader_->Next());
+      if (!maybe_block.has_value()) {
+        source_eof_ = true;
+        for (auto& decoder : column_decoders_) {
+          decoder->SetEOF(num_blocks_read_);
+        }
+        break;
+      }
+      DCHECK(!maybe_block->consume_bytes);
+      DCHECK_EQ(maybe_block->block_index, num_blocks_read_);
+
+      ARROW_ASSIGN_OR_RAISE(auto future, thread_pool_->Submit([this, maybe_block] {
+        return Parse(maybe_block->partial, maybe_block->completion, maybe_block->buffer,
+                     maybe_block->block_index, maybe_block->is_final);
+      }));
+      parse_futures_.push_back(std::move(future));
+      ++num_blocks_read_;
+    }
+
+    while (!parse_futures_.empty()) {
+      const auto& future = parse_futures_.front();
+      // Parse errors are only reported when reaching the failed block
+      if (num_blocks_inserted_ > num_batches_read_ &&
+          future.state() != FutureState::SUCCESS) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto result, future.result());
+      parse_futures_.pop_front();
+      RETURN_NOT_OK(ProcessData(result.parser, num_blocks_inserted_++));
+    }
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+  const int64_t max_blocks_in_flight_;
+
+  bool source_eof_ = false;
+  int64_t num_blocks_read_ = 0;
+  int64_t num_blocks_inserted_ = 0;
+  int64_t num_batches_read_ = 0;
+  std::deque<Future<ParseResult>> parse_futures_;
+  std::shared_ptr<ThreadedBlockReader> block_reader_;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
@@ -864,8 +1003,13 @@ Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
     const ReadOptions& read_options, const ParseOptions& parse_options,
     const ConvertOptions& convert_options) {
   std::shared_ptr<BaseStreamingReader> reader;
-  reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
-                                                   parse_options, convert_options);
+  if (read_options.use_threads) {
+    reader = std::make_shared<ThreadedStreamingReader>(
+        pool, input, read_options, parse_options, convert_options, GetCpuThreadPool());
+  } else {
+    reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
+                                                     parse_options, convert_options);
+  }
   RETURN_NOT_OK(reader->Init());
   return reader;
 }
@@ -56,8 +56,10 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
 
   /// Create a StreamingReader instance
   ///
-  /// Currently, the StreamingReader is always single-threaded (parallel
-  /// readahead is not supported).
+  /// If ReadOptions::use_threads is true, blocks are parsed and converted in
+  /// parallel on the global CPU thread pool.  Batches are still delivered in
+  /// file order, and only a bounded number of blocks is processed ahead of
+  /// the consumer.
   static Result<std::shared_ptr<StreamingReader>> Make(
       MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
       const ParseOptions&, const ConvertOptions&);
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace csv {
+
+// Make CSV data with a header and num_rows rows, the row at bad_row (if any)
+// having a missing field
+static std::string MakeMultiBlockCSV(int num_rows, int bad_row = -1) {
+  std::string csv = "int,str,float\n";
+  for (int i = 0; i < num_rows; ++i) {
+    csv += std::to_string(i) + ",";
+    if (i == bad_row) {
+      csv += "bad\n";
+      continue;
+    }
+    csv += (i % 7 == 0) ? "" : "s" + std::to_string(i * 31 % 1000);
+    csv += "," + ((i % 11 == 0) ? "" : std::to_string(i) + ".5") + "\n";
+  }
+  return csv;
+}
+
+// Read all the batches of a StreamingReader, until the end or the first error
+static Status ReadStreaming(const std::string& csv, bool use_threads,
+                            std::vector<std::shared_ptr<RecordBatch>>* batches) {
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = use_threads;
+  // Make sure the input spans many blocks
+  read_options.block_size = 1000;
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+  ARROW_ASSIGN_OR_RAISE(
+      auto reader,
+      StreamingReader::Make(default_memory_pool(), input, read_options,
+                            ParseOptions::Defaults(), ConvertOptions::Defaults()));
+  for (;;) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(batch->ValidateFull());
+    batches->push_back(std::move(batch));
+  }
+}
+
+TEST(StreamingReaderTest, ThreadedMatchesSerial) {
+  const std::string csv = MakeMultiBlockCSV(5000);
+
+  std::vector<std::shared_ptr<RecordBatch>> serial, threaded;
+  ASSERT_OK(ReadStreaming(csv, /*use_threads=*/false, &serial));
+  ASSERT_OK(ReadStreaming(csv, /*use_threads=*/true, &threaded));
+  ASSERT_GT(serial.size(), 10);
+
+  // Batches come out in file order, one per block
+  ASSERT_EQ(serial.size(), threaded.size());
+  for (size_t i = 0; i < serial.size(); ++i) {
+    AssertBatchesEqual(*serial[i], *threaded[i]);
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(threaded));
+  ASSERT_EQ(table->num_rows(), 5000);
+}
+
+TEST(StreamingReaderTest, ThreadedParseErrorMatchesSerial) {
+  const std::string csv = MakeMultiBlockCSV(5000, /*bad_row=*/3000);
+
+  std::vector<std::shared_ptr<RecordBatch>> serial, threaded;
+  ASSERT_RAISES(Invalid, ReadStreaming(csv, /*use_threads=*/false, &serial));
+  ASSERT_RAISES(Invalid, ReadStreaming(csv, /*use_threads=*/true, &threaded));
+
+  // The batches before the failing block are delivered
+  ASSERT_GT(serial.size(), 0);
+  ASSERT_EQ(serial.size(), threaded.size());
+  for (size_t i = 0; i < serial.size(); ++i) {
+    AssertBatchesEqual(*serial[i], *threaded[i]);
+  }
+}
+
+}  // namespace csv
+}  // namespace arrow
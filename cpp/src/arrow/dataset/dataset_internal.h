@@ -22,11 +22,14 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/type_fwd.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/type.h"
+#include "arrow/util/delimiting.h"
 #include "arrow/util/iterator.h"
 
 namespace arrow {
@@ -69,5 +72,62 @@ static inline std::shared_ptr<Schema> SchemaFromColumnNames(
   return schema(std::move(columns));
 }
 
+/// \brief An iterator of Buffers containing only whole delimited objects
+/// (for example CSV rows or JSON lines), read from an input stream in blocks
+/// of approximately `block_size` bytes.
+///
+/// Each yielded Buffer can be parsed independently of the others, which lets
+/// text formats emit one ScanTask per block.
+class DelimitedBlockIterator {
+ public:
+  static Result<Iterator<std::shared_ptr<Buffer>>> Make(
+      std::shared_ptr<io::InputStream> input, std::unique_ptr<Chunker> chunker,
+      int64_t block_size, MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer_it,
+                          io::MakeInputStreamIterator(std::move(input), block_size));
+    return Iterator<std::shared_ptr<Buffer>>(DelimitedBlockIterator(
+        std::move(buffer_it), std::shared_ptr<Chunker>(std::move(chunker)), pool));
+  }
+
+  Result<std::shared_ptr<Buffer>> Next() {
+    while (!eof_) {
+      ARROW_ASSIGN_OR_RAISE(auto buffer, buffer_it_.Next());
+      if (buffer == nullptr) {
+        eof_ = true;
+        // The last object may lack a trailing delimiter
+        if (partial_->size() > 0) {
+          return std::move(partial_);
+        }
+        break;
+      }
+
+      if (partial_->size() > 0) {
+        ARROW_ASSIGN_OR_RAISE(buffer, ConcatenateBuffers({partial_, buffer}, pool_));
+      }
+      std::shared_ptr<Buffer> whole;
+      RETURN_NOT_OK(chunker_->Process(std::move(buffer), &whole, &partial_));
+      if (whole->size() > 0) {
+        return whole;
+      }
+      // No delimiter found in the block: accumulate until one appears
+    }
+    return nullptr;
+  }
+
+ private:
+  DelimitedBlockIterator(Iterator<std::shared_ptr<Buffer>> buffer_it,
+                         std::shared_ptr<Chunker> chunker, MemoryPool* pool)
+      : buffer_it_(std::move(buffer_it)),
+        chunker_(std::move(chunker)),
+        pool_(pool),
+        partial_(std::make_shared<Buffer>("")) {}
+
+  Iterator<std::shared_ptr<Buffer>> buffer_it_;
+  std::shared_ptr<Chunker> chunker_;
+  MemoryPool* pool_;
+  std::shared_ptr<Buffer> partial_;
+  bool eof_ = false;
+};
+
 }  // namespace dataset
 }  // namespace arrow
@@ -299,6 +299,42 @@ TEST(TestProjector, AugmentWithScalar) {
   AssertBatchesEqual(*expected_batch, *reconciled_batch);
 }
 
+TEST(TestProjector, AugmentWithDictionary) {
+  static constexpr int64_t kBatchSize = 1024;
+
+  auto from_schema = schema({field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, from_schema);
+  auto to_schema =
+      schema({field("f64", float64()), field("a", dictionary(int32(), utf8())),
+              field("b", dictionary(int8(), utf8()))});
+
+  RecordBatchProjector projector(to_schema);
+  // default values for dictionary fields may be given as their value type
+  ASSERT_OK(projector.SetDefaultValue(to_schema->GetFieldIndex("a"),
+                                      std::make_shared<StringScalar>("hello")));
+  ASSERT_OK(projector.SetDefaultValue(to_schema->GetFieldIndex("b"),
+                                      std::make_shared<StringScalar>("world")));
+  ASSERT_RAISES(TypeError, projector.SetDefaultValue(to_schema->GetFieldIndex("a"),
+                                                     std::make_shared<Int32Scalar>(3)));
+
+  ASSERT_OK_AND_ASSIGN(auto reconciled_batch, projector.Project(*batch));
+  ASSERT_OK(reconciled_batch->ValidateFull());
+
+  const auto& a = checked_cast<const DictionaryArray&>(*reconciled_batch->column(1));
+  const auto& b = checked_cast<const DictionaryArray&>(*reconciled_batch->column(2));
+  ASSERT_EQ(a.length(), kBatchSize);
+  ASSERT_EQ(a.dictionary()->length(), 1);
+  ASSERT_EQ(checked_cast<const StringArray&>(*a.dictionary()).GetString(0), "hello");
+  ASSERT_EQ(checked_cast<const StringArray&>(*b.dictionary()).GetString(0), "world");
+
+  // every index is 0, and all dictionary columns share a single buffer of zeroes
+  ASSERT_EQ(a.indices()->null_count(), 0);
+  ASSERT_EQ(checked_cast<const Int32Array&>(*a.indices()).Value(kBatchSize - 1), 0);
+  ASSERT_EQ(checked_cast<const Int8Array&>(*b.indices()).Value(kBatchSize - 1), 0);
+  ASSERT_EQ(a.indices()->data()->buffers[1]->data(),
+            b.indices()->data()->buffers[1]->data());
+}
+
 TEST(TestProjector, NonTrivial) {
   static constexpr int64_t kBatchSize = 1024;
 
@@ -18,7 +18,10 @@
 #include "arrow/dataset/discovery.h"
 
 #include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -30,6 +33,9 @@
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/task_group.h"
 
 namespace arrow {
 namespace dataset {
@@ -153,6 +159,78 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
       std::move(filesystem), std::move(forest), std::move(format), std::move(options)));
 }
 
+namespace {
+
+/// \brief List a recursive selector with one task per directory, so that sibling
+/// directories are listed concurrently. Directories matching ignore_prefixes are
+/// returned but not descended into.
+class ConcurrentCrawler {
+ public:
+  ConcurrentCrawler(fs::FileSystem* filesystem, const fs::FileSelector& selector,
+                    const std::vector<std::string>& ignore_prefixes)
+      : filesystem_(filesystem),
+        allow_not_found_(selector.allow_not_found),
+        ignore_prefixes_(ignore_prefixes),
+        task_group_(internal::TaskGroup::MakeThreaded(io::internal::GetIOThreadPool())) {}
+
+  Status Crawl(const std::string& base_dir, int32_t max_recursion) {
+    List(base_dir, max_recursion);
+    return task_group_->Finish();
+  }
+
+  std::vector<fs::FileInfo> infos() && { return std::move(infos_); }
+
+  int64_t directories_listed() const { return directories_listed_.load(); }
+
+ private:
+  void List(std::string dir, int32_t remaining_recursion) {
+    task_group_->Append([this, dir, remaining_recursion]() -> Status {
+      fs::FileSelector selector;
+      selector.base_dir = dir;
+      selector.allow_not_found = allow_not_found_;
+      ARROW_ASSIGN_OR_RAISE(auto children, filesystem_->GetFileInfo(selector));
+
+      std::vector<std::string> subdirs;
+      for (const auto& child : children) {
+        if (child.IsDirectory() && remaining_recursion > 0 &&
+            !StartsWithAnyOf(ignore_prefixes_, child.path())) {
+          subdirs.push_back(child.path());
+        }
+      }
+      ++directories_listed_;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::move(children.begin(), children.end(), std::back_inserter(infos_));
+      }
+
+      for (auto& subdir : subdirs) {
+        List(std::move(subdir), remaining_recursion - 1);
+      }
+      return Status::OK();
+    });
+  }
+
+  fs::FileSystem* filesystem_;
+  bool allow_not_found_;
+  const std::vector<std::string>& ignore_prefixes_;
+  std::shared_ptr<internal::TaskGroup> task_group_;
+
+  std::atomic<int64_t> directories_listed_{0};
+  std::mutex mutex_;
+  std::vector<fs::FileInfo> infos_;
+};
+
+Result<std::vector<fs::FileInfo>> CrawlConcurrently(
+    fs::FileSystem* filesystem, const fs::FileSelector& selector,
+    const std::vector<std::string>& ignore_prefixes, int64_t* directories_listed) {
+  ConcurrentCrawler crawler(filesystem, selector, ignore_prefixes);
+  RETURN_NOT_OK(crawler.Crawl(selector.base_dir, selector.max_recursion));
+  *directories_listed = crawler.directories_listed();
+  return std::move(crawler).infos();
+}
+
+}  // namespace
+
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
@@ -163,9 +241,44 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     options.partition_base_dir = selector.base_dir;
   }
 
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
+  DiscoveryStatistics statistics;
+  internal::StopWatch watch;
+  watch.Start();
+
+  std::vector<fs::FileInfo> files;
+  if (options.use_threads && selector.recursive) {
+    ARROW_ASSIGN_OR_RAISE(files, CrawlConcurrently(filesystem.get(), selector,
+                                                   options.selector_ignore_prefixes,
+                                                   &statistics.directories_listed));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(files, filesystem->GetFileInfo(selector));
+    statistics.directories_listed = 1;
+  }
+  statistics.files_listed = static_cast<int64_t>(files.size());
   ARROW_ASSIGN_OR_RAISE(auto forest, fs::PathForest::Make(std::move(files)));
 
+  // When requested, check every file for support up front so that the checks can run
+  // concurrently. supported[i] is then consulted when visiting forest.infos()[i].
+  std::vector<char> supported;
+  if (options.exclude_invalid_files && options.use_threads) {
+    supported.resize(forest.size(), true);
+    auto task_group = internal::TaskGroup::MakeThreaded(io::internal::GetIOThreadPool());
+    for (int i = 0; i < forest.size(); ++i) {
+      const auto& info = forest.infos()[i];
+      if (!info.IsFile() ||
+          StartsWithAnyOf(options.selector_ignore_prefixes, info.path())) {
+        continue;
+      }
+      task_group->Append([&, i]() -> Status {
+        FileSource source(forest.infos()[i], filesystem.get());
+        ARROW_ASSIGN_OR_RAISE(auto is_supported, format->IsSupported(source));
+        supported[i] = is_supported;
+        return Status::OK();
+      });
+    }
+    RETURN_NOT_OK(task_group->Finish());
+  }
+
   std::vector<fs::FileInfo> filtered_files;
 
   RETURN_NOT_OK(forest.Visit([&](fs::PathForest::Ref ref) -> fs::PathForest::MaybePrune {
@@ -176,9 +289,14 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     }
 
     if (ref.info().IsFile() && options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(path, filesystem.get())));
-      if (!supported) {
+      bool is_supported;
+      if (supported.empty()) {
+        ARROW_ASSIGN_OR_RAISE(is_supported,
+                              format->IsSupported(FileSource(path, filesystem.get())));
+      } else {
+        is_supported = supported[ref.i];
+      }
+      if (!is_supported) {
         return fs::PathForest::Continue;
       }
     }
@@ -189,9 +307,19 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
 
   ARROW_ASSIGN_OR_RAISE(forest,
                         fs::PathForest::MakeFromPreSorted(std::move(filtered_files)));
+  statistics.listing_time = static_cast<int64_t>(watch.Stop());
 
-  return std::shared_ptr<DatasetFactory>(new FileSystemDatasetFactory(
+  std::shared_ptr<FileSystemDatasetFactory> factory(new FileSystemDatasetFactory(
       filesystem, std::move(forest), std::move(format), std::move(options)));
+  factory->listing_statistics_ = statistics;
+  return std::move(factory);
+}
+
+DiscoveryStatistics FileSystemDatasetFactory::statistics() const {
+  auto statistics = listing_statistics_;
+  statistics.files_inspected = files_inspected_.load();
+  statistics.inspect_time = inspect_time_.load();
+  return statistics;
 }
 
 Result<std::shared_ptr<Schema>> FileSystemDatasetFactory::PartitionSchema() {
@@ -212,18 +340,34 @@ Result<std::shared_ptr<Schema>> FileSystemDatasetFactory::PartitionSchema() {
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
     InspectOptions options) {
-  std::vector<std::shared_ptr<Schema>> schemas;
+  internal::StopWatch watch;
+  watch.Start();
 
+  std::vector<std::string> paths;
   const bool has_fragments_limit = options.fragments >= 0;
   int fragments = options.fragments;
   for (const auto& f : forest_.infos()) {
     if (!f.IsFile()) continue;
     if (has_fragments_limit && fragments-- == 0) break;
-    FileSource src(f.path(), fs_.get());
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect(src));
-    schemas.push_back(schema);
+    paths.push_back(f.path());
   }
 
+  std::vector<std::shared_ptr<Schema>> schemas(paths.size());
+  auto task_group =
+      options_.use_threads
+          ? internal::TaskGroup::MakeThreaded(io::internal::GetIOThreadPool())
+          : internal::TaskGroup::MakeSerial();
+  for (size_t i = 0; i < paths.size(); ++i) {
+    task_group->Append([&, i]() -> Status {
+      FileSource src(paths[i], fs_.get());
+      return format_->Inspect(src).Value(&schemas[i]);
+    });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  files_inspected_ += static_cast<int64_t>(paths.size());
+  inspect_time_ += static_cast<int64_t>(watch.Stop());
+
   ARROW_ASSIGN_OR_RAISE(auto partition_schema, PartitionSchema());
   schemas.push_back(partition_schema);
 
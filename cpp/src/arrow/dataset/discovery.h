@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -160,9 +162,9 @@ struct FileSystemFactoryOptions {
 
   // Invalid files (via selector or explicitly) will be excluded by checking
   // with the FileFormat::IsSupported method.  This will incur IO for each files
-  // in a serial and single threaded fashion. Disabling this feature will skip the
-  // IO, but unsupported files may be present in the Dataset
-  // (resulting in an error at scan time).
+  // in a serial and single threaded fashion (concurrently if use_threads is set).
+  // Disabling this feature will skip the IO, but unsupported files may be present
+  // in the Dataset (resulting in an error at scan time).
   bool exclude_invalid_files = false;
 
   // When discovering from a Selector (and not from an explicit file list), ignore
@@ -180,6 +182,28 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  // Perform discovery IO concurrently on the IO thread pool: directories under a
+  // recursive selector are listed one task per directory (instead of a single
+  // recursive GetFileInfo call), and the files checked by exclude_invalid_files or
+  // inspected by InspectSchemas are opened in parallel. This is worthwhile on high
+  // latency filesystems such as S3, where each listing or read is a round trip.
+  bool use_threads = false;
+};
+
+/// \brief Counts and wall clock times of the IO performed by a
+/// FileSystemDatasetFactory, for diagnosing slow dataset construction.
+struct ARROW_DS_EXPORT DiscoveryStatistics {
+  /// The number of directory listings, 1 for a recursive listing done serially
+  int64_t directories_listed = 0;
+  /// The number of files and directories found by the listing
+  int64_t files_listed = 0;
+  /// The time spent listing and filtering files, in nanoseconds
+  int64_t listing_time = 0;
+  /// The number of files opened by InspectSchemas, over all calls
+  int64_t files_inspected = 0;
+  /// The time spent in InspectSchemas, over all calls, in nanoseconds
+  int64_t inspect_time = 0;
 };
 
 /// \brief FileSystemDatasetFactory creates a Dataset from a vector of
@@ -219,6 +243,10 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
 
   Result<std::shared_ptr<Dataset>> Finish(FinishOptions options) override;
 
+  /// \brief The IO performed so far during discovery. Safe to call concurrently with
+  /// InspectSchemas.
+  DiscoveryStatistics statistics() const;
+
  protected:
   FileSystemDatasetFactory(std::shared_ptr<fs::FileSystem> filesystem,
                            fs::PathForest forest, std::shared_ptr<FileFormat> format,
@@ -230,6 +258,11 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
   fs::PathForest forest_;
   std::shared_ptr<FileFormat> format_;
   FileSystemFactoryOptions options_;
+  // The listing statistics, fixed once Make returns
+  DiscoveryStatistics listing_statistics_;
+  // Accumulated by InspectSchemas, which may be called from several threads
+  std::atomic<int64_t> files_inspected_{0};
+  std::atomic<int64_t> inspect_time_{0};
 };
 
 class ARROW_DS_EXPORT SingleFileDatasetFactory : public DatasetFactory {
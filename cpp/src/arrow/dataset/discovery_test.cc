@@ -18,7 +18,9 @@
 #include "arrow/dataset/discovery.h"
 
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -28,12 +30,15 @@
 #include "arrow/filesystem/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/checked_cast.h"
 
 using testing::SizeIs;
 
 namespace arrow {
 namespace dataset {
 
+using internal::checked_cast;
+
 void AssertSchemasAre(std::vector<std::shared_ptr<Schema>> actual,
                       std::vector<std::shared_ptr<Schema>> expected) {
   EXPECT_EQ(actual.size(), expected.size());
@@ -291,6 +296,63 @@ TEST_F(FileSystemDatasetFactoryTest, OptionsIgnoredNoPrefixes) {
                          "not_ignored_by_default_either/dat"});
 }
 
+TEST_F(FileSystemDatasetFactoryTest, UseThreads) {
+  selector_.recursive = true;
+  factory_options_.use_threads = true;
+  factory_options_.exclude_invalid_files = true;
+  MakeFactory({
+      fs::File("a/b/c"),
+      fs::File("a/b/d"),
+      fs::File("a/e"),
+      fs::File("f/g"),
+      fs::File("_ignored/h"),
+      fs::File("i"),
+  });
+
+  AssertFinishWithPaths({"a/b/c", "a/b/d", "a/e", "f/g", "i"});
+
+  auto statistics = checked_cast<const FileSystemDatasetFactory&>(*factory_).statistics();
+  // "", "a", "a/b" and "f" are listed, "_ignored" is not descended into
+  ASSERT_EQ(statistics.directories_listed, 4);
+  ASSERT_EQ(statistics.files_listed, 9);
+  ASSERT_EQ(statistics.files_inspected, 1);
+
+  // bounded by max_recursion
+  selector_.max_recursion = 1;
+  MakeFactory({fs::File("a/b/c"), fs::File("a/e"), fs::File("i")});
+  AssertFinishWithPaths({"a/e", "i"});
+}
+
+TEST_F(FileSystemDatasetFactoryTest, InspectUseThreads) {
+  auto s = schema({field("f64", float64())});
+  format_ = std::make_shared<DummyFileFormat>(s);
+  factory_options_.use_threads = true;
+
+  MakeFactory({fs::File("a"), fs::File("b"), fs::File("c")});
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+  ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(options));
+  // one per file and the partition schema
+  ASSERT_EQ(schemas.size(), 4);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(*schemas[i], *s);
+  }
+
+  auto statistics = checked_cast<const FileSystemDatasetFactory&>(*factory_).statistics();
+  ASSERT_EQ(statistics.files_inspected, 3);
+
+  // concurrent calls are all accounted for
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&] { ASSERT_OK(factory_->InspectSchemas(options).status()); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  statistics = checked_cast<const FileSystemDatasetFactory&>(*factory_).statistics();
+  ASSERT_EQ(statistics.files_inspected, 3 + 4 * 3);
+}
+
 TEST_F(FileSystemDatasetFactoryTest, Inspect) {
   auto s = schema({field("f64", float64())});
   format_ = std::make_shared<DummyFileFormat>(s);
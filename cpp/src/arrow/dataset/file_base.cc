@@ -18,7 +18,15 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -30,6 +38,7 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/task_group.h"
 
@@ -81,6 +90,12 @@ Result<std::shared_ptr<WriteTask>> FileFormat::WriteFragment(
   return Status::NotImplemented("writing fragment of format ", type_name());
 }
 
+Result<std::unique_ptr<FileWriter>> FileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    MemoryPool* pool) {
+  return Status::NotImplemented("writing files of format ", type_name());
+}
+
 Result<ScanTaskIterator> FileFragment::Scan(std::shared_ptr<ScanContext> context) {
   return format_->ScanFile(source_, scan_options_, std::move(context));
 }
@@ -211,7 +226,7 @@ FragmentIterator FileSystemDataset::GetFragmentsImpl(
 
     if (ref.info().IsFile()) {
       // generate a fragment for this file
-      FileSource src(ref.info().path(), filesystem_.get());
+      FileSource src(ref.info(), filesystem_.get());
       ARROW_ASSIGN_OR_RAISE(auto fragment,
                             format_->MakeFragment(std::move(src), options[ref.i],
                                                   std::move(fragment_partitions[ref.i])));
@@ -276,6 +291,299 @@ Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Write(
               std::move(forest), std::move(partition_expressions));
 }
 
+namespace {
+
+// State shared by the writers of all partitions during a streaming Write.
+struct DatasetWriteState {
+  explicit DatasetWriteState(const FileSystemDatasetWriteOptions& options)
+      : options(options), max_queued_batches(std::max(options.max_queued_batches, 1)) {}
+
+  // Wait for room to queue another batch. Returns false once a writer has failed,
+  // since the task group will not run the tasks which would drain the queues.
+  bool AcquireQueueSlot() {
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    queue_cv.wait(lock,
+                  [this] { return failed || queued_batches < max_queued_batches; });
+    if (failed) {
+      return false;
+    }
+    ++queued_batches;
+    return true;
+  }
+
+  void ReleaseQueueSlot() {
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      --queued_batches;
+    }
+    queue_cv.notify_one();
+  }
+
+  void Fail() {
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      failed = true;
+    }
+    queue_cv.notify_all();
+  }
+
+  const FileSystemDatasetWriteOptions& options;
+  std::shared_ptr<fs::FileSystem> filesystem;
+  std::string base_dir;
+  std::string basename_prefix;
+  std::shared_ptr<internal::TaskGroup> task_group;
+  MemoryPool* pool;
+
+  std::atomic<int> file_counter{0};
+
+  const int max_queued_batches;
+  std::mutex queue_mutex;
+  std::condition_variable queue_cv;
+  int queued_batches = 0;
+  bool failed = false;
+
+  std::mutex mutex;
+  std::vector<fs::FileInfo> files;
+  ExpressionVector partition_expressions;
+};
+
+// Writes the rows of one partition directory. Batches are queued by the producer and
+// drained by at most one task at a time, so each file receives its batches in order
+// while files of different partitions are written concurrently. The producer blocks
+// while max_queued_batches are queued across all partitions.
+class PartitionWriter {
+ public:
+  PartitionWriter(DatasetWriteState* state, std::string directory,
+                  std::shared_ptr<Expression> partition_expression)
+      : state_(state),
+        directory_(std::move(directory)),
+        partition_expression_(std::move(partition_expression)) {}
+
+  /// Queue a batch for writing. A null batch closes the current file.
+  void Push(std::shared_ptr<RecordBatch> batch) {
+    if (!state_->AcquireQueueSlot()) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(std::move(batch));
+      if (draining_) {
+        return;
+      }
+      draining_ = true;
+    }
+    state_->task_group->Append([this] { return Drain(); });
+  }
+
+  /// Producer side bookkeeping of the writers which (will) have an open file.
+  bool open = false;
+  std::list<PartitionWriter*>::iterator lru_position;
+
+ private:
+  Status Drain() {
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) {
+          draining_ = false;
+          return status_;
+        }
+        batch = std::move(queue_.front());
+        queue_.pop_front();
+      }
+
+      if (status_.ok()) {
+        status_ = batch == nullptr ? CloseFile() : Write(std::move(batch));
+        if (!status_.ok()) {
+          state_->Fail();
+        }
+      }
+      state_->ReleaseQueueSlot();
+    }
+  }
+
+  Status Write(std::shared_ptr<RecordBatch> batch) {
+    const auto& options = state_->options;
+    while (batch->num_rows() > 0) {
+      if (writer_ == nullptr) {
+        RETURN_NOT_OK(OpenFile(*batch->schema()));
+      }
+
+      auto to_write = batch;
+      if (options.max_rows_per_file > 0) {
+        auto capacity = options.max_rows_per_file - rows_in_file_;
+        if (batch->num_rows() > capacity) {
+          to_write = batch->Slice(0, capacity);
+        }
+      }
+      RETURN_NOT_OK(writer_->Write(*to_write));
+      rows_in_file_ += to_write->num_rows();
+      batch = batch->Slice(to_write->num_rows());
+
+      bool file_is_full =
+          options.max_rows_per_file > 0 && rows_in_file_ >= options.max_rows_per_file;
+      if (options.max_bytes_per_file > 0) {
+        ARROW_ASSIGN_OR_RAISE(auto bytes_in_file, stream_->Tell());
+        file_is_full |= bytes_in_file >= options.max_bytes_per_file;
+      }
+      if (file_is_full) {
+        RETURN_NOT_OK(CloseFile());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status OpenFile(const Schema& schema) {
+    auto dir = state_->base_dir + directory_;
+    if (!created_directory_ && !dir.empty()) {
+      RETURN_NOT_OK(state_->filesystem->CreateDir(
+          fs::internal::RemoveTrailingSlash(dir).to_string(), /* recursive = */ true));
+      created_directory_ = true;
+    }
+
+    auto path = dir + state_->basename_prefix + std::to_string(state_->file_counter++) +
+                "." + state_->options.format->type_name();
+    ARROW_ASSIGN_OR_RAISE(stream_, state_->filesystem->OpenOutputStream(path));
+    ARROW_ASSIGN_OR_RAISE(writer_,
+                          state_->options.format->MakeWriter(
+                              stream_, std::make_shared<Schema>(schema), state_->pool));
+
+    fs::FileInfo info;
+    info.set_path(std::move(path));
+    info.set_type(fs::FileType::File);
+
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->files.push_back(std::move(info));
+    state_->partition_expressions.push_back(partition_expression_);
+    return Status::OK();
+  }
+
+  Status CloseFile() {
+    if (writer_ == nullptr) {
+      return Status::OK();
+    }
+    auto status = writer_->Finish();
+    writer_.reset();
+    stream_.reset();
+    rows_in_file_ = 0;
+    return status;
+  }
+
+  DatasetWriteState* state_;
+  std::string directory_;
+  std::shared_ptr<Expression> partition_expression_;
+
+  std::mutex mutex_;
+  std::deque<std::shared_ptr<RecordBatch>> queue_;
+  bool draining_ = false;
+
+  // only accessed by the draining task
+  Status status_;
+  bool created_directory_ = false;
+  std::shared_ptr<io::OutputStream> stream_;
+  std::unique_ptr<FileWriter> writer_;
+  int64_t rows_in_file_ = 0;
+};
+
+// Split each batch by partition and hand the pieces to their PartitionWriters, closing
+// the least recently written partition's file to stay within max_open_files.
+Status PartitionBatches(DatasetWriteState* state, const Partitioning& partitioning,
+                        RecordBatchReader* batches, MemoryPool* pool,
+                        std::unordered_map<std::string, std::unique_ptr<PartitionWriter>>*
+                            writers) {
+  const int max_open_files = std::max(state->options.max_open_files, 1);
+  std::list<PartitionWriter*> open_writers;
+
+  while (state->task_group->ok()) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(batches->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto partitioned, partitioning.Partition(batch, pool));
+    for (size_t i = 0; i < partitioned.batches.size(); ++i) {
+      const auto& expression = partitioned.expressions[i];
+      ARROW_ASSIGN_OR_RAISE(auto directory, partitioning.FormatPath(*expression));
+
+      auto& writer = (*writers)[directory];
+      if (writer == nullptr) {
+        writer.reset(new PartitionWriter(state, directory, expression));
+      }
+
+      if (writer->open) {
+        open_writers.erase(writer->lru_position);
+      } else {
+        if (static_cast<int>(open_writers.size()) == max_open_files) {
+          auto evicted = open_writers.back();
+          open_writers.pop_back();
+          evicted->open = false;
+          evicted->Push(nullptr);
+        }
+        writer->open = true;
+      }
+      open_writers.push_front(writer.get());
+      writer->lru_position = open_writers.begin();
+
+      writer->Push(std::move(partitioned.batches[i]));
+    }
+  }
+
+  for (auto writer : open_writers) {
+    writer->Push(nullptr);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Write(
+    const FileSystemDatasetWriteOptions& options,
+    std::shared_ptr<RecordBatchReader> batches,
+    std::shared_ptr<ScanContext> scan_context) {
+  if (options.format == nullptr) {
+    return Status::Invalid("a format is required for writing a FileSystemDataset");
+  }
+
+  auto partitioning = options.partitioning;
+  if (partitioning == nullptr) {
+    partitioning = Partitioning::Default();
+  }
+
+  DatasetWriteState state(options);
+  state.filesystem = options.filesystem;
+  if (state.filesystem == nullptr) {
+    state.filesystem = std::make_shared<fs::LocalFileSystem>();
+  }
+  state.base_dir = fs::internal::EnsureTrailingSlash(options.base_dir);
+  state.pool = scan_context->pool;
+
+  // distinguish files of this write from those already present (see MakeWritePlan)
+  auto milliseconds_since_epoch = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                      std::chrono::steady_clock::now().time_since_epoch())
+                                      .count();
+  state.basename_prefix = std::to_string(milliseconds_since_epoch) + "_";
+
+  if (scan_context->use_threads) {
+    state.task_group = internal::TaskGroup::MakeThreaded(io::internal::GetIOThreadPool());
+  } else {
+    state.task_group = internal::TaskGroup::MakeSerial();
+  }
+
+  std::unordered_map<std::string, std::unique_ptr<PartitionWriter>> writers;
+  auto status = PartitionBatches(&state, *partitioning, batches.get(),
+                                 scan_context->pool, &writers);
+
+  // writers must outlive their drain tasks, even if partitioning failed
+  auto write_status = state.task_group->Finish();
+  RETURN_NOT_OK(status);
+  RETURN_NOT_OK(write_status);
+
+  return Make(batches->schema(), scalar(true), options.format, state.filesystem,
+              std::move(state.files), std::move(state.partition_expressions));
+}
+
 Status WriteTask::CreateDestinationParentDir() const {
   if (auto filesystem = destination_.filesystem()) {
     auto parent = fs::internal::GetAbstractPathParent(destination_.path()).first;
@@ -49,7 +49,16 @@ class ARROW_DS_EXPORT FileSource {
   FileSource(std::string path, fs::FileSystem* filesystem,
              Compression::type compression = Compression::UNCOMPRESSED,
              bool writable = true)
-      : impl_(PathAndFileSystem{std::move(path), -1L, -1L, filesystem}),
+      : impl_(PathAndFileSystem{MakeInfo(std::move(path)), -1L, -1L, filesystem}),
+        compression_(compression),
+        writable_(writable) {}
+
+  /// \brief A file whose FileInfo is already known, e.g. from a directory listing.
+  /// Its size and modification time spare users of the source a GetFileInfo call.
+  FileSource(fs::FileInfo info, fs::FileSystem* filesystem,
+             Compression::type compression = Compression::UNCOMPRESSED,
+             bool writable = true)
+      : impl_(PathAndFileSystem{std::move(info), -1L, -1L, filesystem}),
         compression_(compression),
         writable_(writable) {}
 
@@ -57,7 +66,8 @@ class ARROW_DS_EXPORT FileSource {
              fs::FileSystem* filesystem,
              Compression::type compression = Compression::UNCOMPRESSED,
              bool writable = true)
-      : impl_(PathAndFileSystem{std::move(path), start_offset, length, filesystem}),
+      : impl_(PathAndFileSystem{MakeInfo(std::move(path)), start_offset, length,
+                                filesystem}),
         compression_(compression),
         writable_(writable) {}
 
@@ -95,7 +105,14 @@ class ARROW_DS_EXPORT FileSource {
   /// type is PATH
   const std::string& path() const {
     static std::string buffer_path = "<Buffer>";
-    return type() == PATH ? util::get<PATH>(impl_).path : buffer_path;
+    return type() == PATH ? util::get<PATH>(impl_).info.path() : buffer_path;
+  }
+
+  /// \brief Return the FileInfo of the file. Only its path is known unless the
+  /// source was constructed from a FileInfo.
+  const fs::FileInfo& info() const {
+    static fs::FileInfo buffer_info = MakeInfo("<Buffer>");
+    return type() == PATH ? util::get<PATH>(impl_).info : buffer_info;
   }
 
   int64_t start_offset() const {
@@ -126,8 +143,14 @@ class ARROW_DS_EXPORT FileSource {
   Result<std::shared_ptr<arrow::io::OutputStream>> OpenWritable() const;
 
  private:
+  static fs::FileInfo MakeInfo(std::string path) {
+    fs::FileInfo info;
+    info.set_path(std::move(path));
+    return info;
+  }
+
   struct PathAndFileSystem {
-    std::string path;
+    fs::FileInfo info;
     int64_t start_offset;
     int64_t length;
     fs::FileSystem* filesystem;
@@ -175,6 +198,24 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   virtual Result<std::shared_ptr<WriteTask>> WriteFragment(
       FileSource destination, std::shared_ptr<Fragment> fragment,
       std::shared_ptr<ScanContext> scan_context);  // FIXME(bkietz) make this pure virtual
+
+  /// \brief Open a FileWriter which writes batches of the given schema to destination.
+  /// Buffers of the writer are allocated from pool.
+  virtual Result<std::unique_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      MemoryPool* pool);
+};
+
+/// \brief Incrementally write record batches of a single schema to one file.
+class ARROW_DS_EXPORT FileWriter {
+ public:
+  virtual ~FileWriter() = default;
+
+  /// \brief Append a batch to the file.
+  virtual Status Write(const RecordBatch& batch) = 0;
+
+  /// \brief Write any trailing metadata and close the destination stream.
+  virtual Status Finish() = 0;
 };
 
 /// \brief A Fragment that is stored in a file with a known format
@@ -262,6 +303,21 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
   static Result<std::shared_ptr<FileSystemDataset>> Write(
       const WritePlan& plan, std::shared_ptr<ScanContext> scan_context);
 
+  /// \brief Write a stream of record batches to a new partitioned directory.
+  ///
+  /// Rows of each batch are split by the values of the partitioning's fields and
+  /// appended to one open file per partition directory. Files of distinct
+  /// partitions are flushed concurrently on the IO thread pool if
+  /// scan_context->use_threads is set.
+  ///
+  /// \param[in] options where and how files will be written.
+  /// \param[in] batches the record batches to write.
+  /// \param[in] scan_context provides the memory pool and use_threads.
+  static Result<std::shared_ptr<FileSystemDataset>> Write(
+      const FileSystemDatasetWriteOptions& options,
+      std::shared_ptr<RecordBatchReader> batches,
+      std::shared_ptr<ScanContext> scan_context);
+
   std::string type_name() const override { return "filesystem"; }
 
   Result<std::shared_ptr<Dataset>> ReplaceSchema(
@@ -336,6 +392,39 @@ class ARROW_DS_EXPORT WritePlan {
   std::vector<std::string> paths;
 };
 
+/// \brief Options for streaming record batches into a partitioned FileSystemDataset.
+struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
+  /// The format into which batches will be written
+  std::shared_ptr<FileFormat> format;
+
+  /// The FileSystem and base directory into which files will be written. If
+  /// filesystem is null, the local filesystem is used.
+  std::shared_ptr<fs::FileSystem> filesystem;
+  std::string base_dir;
+
+  /// The partitioning which determines the directory of each row. Partition fields
+  /// are implicit in the directory and are not written to files. If null, all rows
+  /// are written to base_dir.
+  std::shared_ptr<Partitioning> partitioning;
+
+  /// Start a new file once the current file of a partition holds this many rows.
+  /// Zero means no limit.
+  int64_t max_rows_per_file = 0;
+
+  /// Start a new file once the current file of a partition has grown to at least
+  /// this many bytes. Zero means no limit.
+  int64_t max_bytes_per_file = 0;
+
+  /// The maximum number of files open at once. When a new partition would exceed
+  /// this, the file of the least recently written partition is closed; any further
+  /// rows for that partition will go to a new file.
+  int max_open_files = 1024;
+
+  /// The maximum number of batches waiting to be written, across all partitions.
+  /// Once reached, no further batches are read until the writers catch up.
+  int max_queued_batches = 64;
+};
+
 class ARROW_DS_EXPORT SingleFileDataset : public Dataset {
  public:
   SingleFileDataset(std::shared_ptr<Schema> schema,
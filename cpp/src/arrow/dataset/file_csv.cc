@@ -0,0 +1,224 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/csv/chunker.h"
+#include "arrow/csv/parser.h"
+#include "arrow/csv/reader.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/io/memory.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/utf8.h"
+
+namespace arrow {
+namespace dataset {
+
+static Result<std::shared_ptr<csv::StreamingReader>> OpenReader(
+    const FileSource& source, const CsvFileFormat& format,
+    const csv::ReadOptions& read_options, const csv::ConvertOptions& convert_options,
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input = nullptr) {
+  if (input == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(input, source.Open());
+  }
+
+  auto maybe_reader = csv::StreamingReader::Make(
+      pool, std::move(input), read_options, format.parse_options, convert_options);
+  if (!maybe_reader.ok()) {
+    return maybe_reader.status().WithMessage("Could not open CSV input source '",
+                                             source.path(),
+                                             "': ", maybe_reader.status().message());
+  }
+  return maybe_reader;
+}
+
+static csv::ReadOptions default_read_options() {
+  auto options = csv::ReadOptions::Defaults();
+  // Parallelism is obtained by scanning blocks concurrently
+  options.use_threads = false;
+  return options;
+}
+
+// Read the header row of a CSV file from its first block, return the column
+// names and the rest of the block.
+static Status ReadHeader(const FileSource& source, const CsvFileFormat& format,
+                         const std::shared_ptr<Buffer>& first_block, MemoryPool* pool,
+                         std::vector<std::string>* column_names,
+                         std::shared_ptr<Buffer>* rest) {
+  ARROW_ASSIGN_OR_RAISE(auto data,
+                        util::SkipUTF8BOM(first_block->data(), first_block->size()));
+  const int64_t size = first_block->size() - (data - first_block->data());
+
+  csv::BlockParser parser(pool, format.parse_options, /*num_cols=*/-1,
+                          /*max_num_rows=*/1);
+  uint32_t parsed_size = 0;
+  RETURN_NOT_OK(parser.ParseFinal(
+      util::string_view(reinterpret_cast<const char*>(data), size), &parsed_size));
+  if (parser.num_rows() != 1) {
+    return Status::Invalid("Could not read header row of CSV file '", source.path(),
+                           "'");
+  }
+  RETURN_NOT_OK(
+      parser.VisitLastRow([&](const uint8_t* data, uint32_t size, bool quoted) {
+        column_names->emplace_back(reinterpret_cast<const char*>(data), size);
+        return Status::OK();
+      }));
+
+  *rest = SliceBuffer(first_block, (data - first_block->data()) + parsed_size);
+  return Status::OK();
+}
+
+/// \brief A ScanTask parsing and converting a single block of a CSV file.
+class CsvScanTask : public ScanTask {
+ public:
+  CsvScanTask(std::shared_ptr<const CsvFileFormat> format,
+              std::shared_ptr<std::vector<std::string>> column_names,
+              std::shared_ptr<Buffer> block, std::shared_ptr<ScanOptions> options,
+              std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        format_(std::move(format)),
+        column_names_(std::move(column_names)),
+        block_(std::move(block)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    auto read_options = default_read_options();
+    read_options.column_names = *column_names_;
+
+    // Only convert the materialized columns, with the types from the scan schema
+    auto convert_options = csv::ConvertOptions::Defaults();
+    for (const auto& name : options_->MaterializedFields()) {
+      if (std::find(column_names_->begin(), column_names_->end(), name) ==
+              column_names_->end() ||
+          std::find(convert_options.include_columns.begin(),
+                    convert_options.include_columns.end(),
+                    name) != convert_options.include_columns.end()) {
+        continue;
+      }
+      convert_options.include_columns.push_back(name);
+      if (auto field = options_->schema()->GetFieldByName(name)) {
+        convert_options.column_types[name] = field->type();
+      }
+    }
+    if (convert_options.include_columns.empty()) {
+      // Still convert one column to produce the right number of rows
+      convert_options.include_columns.push_back(column_names_->front());
+    }
+
+    FileSource source(block_);
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, *format_, read_options,
+                                                  convert_options, context_->pool));
+    return IteratorFromReader(std::move(reader));
+  }
+
+ private:
+  std::shared_ptr<const CsvFileFormat> format_;
+  std::shared_ptr<std::vector<std::string>> column_names_;
+  std::shared_ptr<Buffer> block_;
+};
+
+class CsvScanTaskIterator {
+ public:
+  static Result<ScanTaskIterator> Make(std::shared_ptr<const CsvFileFormat> format,
+                                       const FileSource& source,
+                                       std::shared_ptr<ScanOptions> options,
+                                       std::shared_ptr<ScanContext> context) {
+    ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+    ARROW_ASSIGN_OR_RAISE(
+        auto block_it,
+        DelimitedBlockIterator::Make(std::move(input),
+                                     csv::MakeChunker(format->parse_options),
+                                     format->block_size, context->pool));
+
+    ARROW_ASSIGN_OR_RAISE(auto first_block, block_it.Next());
+    if (first_block == nullptr) {
+      return Status::Invalid("Empty CSV file '", source.path(), "'");
+    }
+    auto column_names = std::make_shared<std::vector<std::string>>();
+    std::shared_ptr<Buffer> rest;
+    RETURN_NOT_OK(ReadHeader(source, *format, first_block, context->pool,
+                             column_names.get(), &rest));
+
+    return ScanTaskIterator(CsvScanTaskIterator(
+        std::move(format), std::move(column_names), std::move(block_it),
+        std::move(rest), std::move(options), std::move(context)));
+  }
+
+  Result<std::shared_ptr<ScanTask>> Next() {
+    std::shared_ptr<Buffer> block = std::move(pending_block_);
+    while (block == nullptr || block->size() == 0) {
+      ARROW_ASSIGN_OR_RAISE(block, block_it_.Next());
+      if (block == nullptr) {
+        // Iteration is done.
+        return nullptr;
+      }
+    }
+    return std::make_shared<CsvScanTask>(format_, column_names_, std::move(block),
+                                         options_, context_);
+  }
+
+ private:
+  CsvScanTaskIterator(std::shared_ptr<const CsvFileFormat> format,
+                      std::shared_ptr<std::vector<std::string>> column_names,
+                      Iterator<std::shared_ptr<Buffer>> block_it,
+                      std::shared_ptr<Buffer> pending_block,
+                      std::shared_ptr<ScanOptions> options,
+                      std::shared_ptr<ScanContext> context)
+      : format_(std::move(format)),
+        column_names_(std::move(column_names)),
+        block_it_(std::move(block_it)),
+        pending_block_(std::move(pending_block)),
+        options_(std::move(options)),
+        context_(std::move(context)) {}
+
+  std::shared_ptr<const CsvFileFormat> format_;
+  std::shared_ptr<std::vector<std::string>> column_names_;
+  Iterator<std::shared_ptr<Buffer>> block_it_;
+  std::shared_ptr<Buffer> pending_block_;
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+};
+
+Result<bool> CsvFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return Inspect(source).ok();
+}
+
+Result<std::shared_ptr<Schema>> CsvFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(
+      auto reader, OpenReader(source, *this, default_read_options(),
+                              csv::ConvertOptions::Defaults(), default_memory_pool()));
+  return reader->schema();
+}
+
+Result<ScanTaskIterator> CsvFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  auto format = internal::checked_pointer_cast<const CsvFileFormat>(shared_from_this());
+  return CsvScanTaskIterator::Make(std::move(format), source, std::move(options),
+                                   std::move(context));
+}
+
+}  // namespace dataset
+}  // namespace arrow
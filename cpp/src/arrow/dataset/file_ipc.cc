@@ -39,10 +39,8 @@ static ipc::IpcReadOptions default_read_options() {
 }
 
 Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
-    const FileSource& source,
+    const FileSource& source, std::shared_ptr<io::RandomAccessFile> input,
     const ipc::IpcReadOptions& options = default_read_options()) {
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
-
   std::shared_ptr<ipc::RecordBatchFileReader> reader;
 
   auto status =
@@ -54,6 +52,13 @@ Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
   return reader;
 }
 
+Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
+    const FileSource& source,
+    const ipc::IpcReadOptions& options = default_read_options()) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  return OpenReader(source, std::move(input), options);
+}
+
 Result<std::vector<int>> GetIncludedFields(
     const Schema& schema, const std::vector<std::string>& materialized_fields) {
   std::vector<int> included_fields;
@@ -80,13 +85,15 @@ class IpcScanTask : public ScanTask {
       static Result<RecordBatchIterator> Make(
           const FileSource& source, std::vector<std::string> materialized_fields,
           MemoryPool* pool) {
-        ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+        ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+        ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, input));
 
+        // Only the buffers of the materialized fields are read from the file
         auto options = default_read_options();
         ARROW_ASSIGN_OR_RAISE(options.included_fields,
                               GetIncludedFields(*reader->schema(), materialized_fields));
 
-        ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, options));
+        ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, std::move(input), options));
         return RecordBatchIterator(Impl{std::move(reader), pool, 0});
       }
 
@@ -198,5 +205,36 @@ Result<std::shared_ptr<WriteTask>> IpcFileFormat::WriteFragment(
                                 std::move(fragment), std::move(scan_context));
 }
 
+Result<std::unique_ptr<FileWriter>> IpcFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    MemoryPool* pool) {
+  class Writer : public FileWriter {
+   public:
+    Writer(std::shared_ptr<io::OutputStream> destination,
+           std::shared_ptr<ipc::RecordBatchWriter> writer)
+        : destination_(std::move(destination)), writer_(std::move(writer)) {}
+
+    Status Write(const RecordBatch& batch) override {
+      return writer_->WriteRecordBatch(batch);
+    }
+
+    Status Finish() override {
+      RETURN_NOT_OK(writer_->Close());
+      return destination_->Close();
+    }
+
+   private:
+    std::shared_ptr<io::OutputStream> destination_;
+    std::shared_ptr<ipc::RecordBatchWriter> writer_;
+  };
+
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.memory_pool = pool;
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::NewFileWriter(destination.get(), schema, options));
+  return std::unique_ptr<FileWriter>(
+      new Writer(std::move(destination), std::move(writer)));
+}
+
 }  // namespace dataset
 }  // namespace arrow
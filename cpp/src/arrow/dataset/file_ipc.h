@@ -48,6 +48,10 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
   Result<std::shared_ptr<WriteTask>> WriteFragment(
       FileSource destination, std::shared_ptr<Fragment> fragment,
       std::shared_ptr<ScanContext> context) override;
+
+  Result<std::unique_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      MemoryPool* pool) override;
 };
 
 }  // namespace dataset
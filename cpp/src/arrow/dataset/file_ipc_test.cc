@@ -221,6 +221,81 @@ TEST_F(TestIpcFileSystemDataset, Write) {
                                    "new_root/bbb/1", "new_root/ccc/0", "new_root/ccc/1"));
 }
 
+TEST_F(TestIpcFileSystemDataset, WriteRecordBatchStream) {
+  // 3 batches of 10 rows; row i has value i and belongs to partition i % 3
+  auto schema = arrow::schema({field("part", int32()), field("value", int64())});
+  RecordBatchVector batches;
+  for (int64_t offset = 0; offset < 30; offset += 10) {
+    std::vector<int32_t> parts;
+    std::vector<int64_t> values;
+    for (int64_t i = offset; i < offset + 10; ++i) {
+      parts.push_back(static_cast<int32_t>(i % 3));
+      values.push_back(i);
+    }
+    std::shared_ptr<Array> part_array, value_array;
+    ArrayFromVector<Int32Type>(parts, &part_array);
+    ArrayFromVector<Int64Type>(values, &value_array);
+    batches.push_back(RecordBatch::Make(schema, 10, {part_array, value_array}));
+  }
+
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "threaded" : "serial");
+    MakeFileSystem(std::vector<fs::FileInfo>{});
+
+    FileSystemDatasetWriteOptions write_options;
+    write_options.format = format_;
+    write_options.filesystem = fs_;
+    write_options.base_dir = "new_root";
+    write_options.partitioning =
+        std::make_shared<HivePartitioning>(arrow::schema({field("part", int32())}));
+    write_options.max_rows_per_file = 4;
+    write_options.max_open_files = 2;
+    // the producer must wait for each batch to be written before queueing another
+    write_options.max_queued_batches = 1;
+
+    ctx_->use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto reader, MakeRecordBatchReader(batches, schema));
+    ASSERT_OK_AND_ASSIGN(auto written,
+                         FileSystemDataset::Write(write_options, reader, ctx_));
+    ASSERT_EQ(*written->schema(), *schema);
+
+    // each partition holds 10 rows in at least 3 files
+    EXPECT_GE(written->files().size(), 9);
+    for (const auto& path : written->files()) {
+      EXPECT_EQ(fs::internal::GetAbstractPathExtension(path), "ipc");
+    }
+
+    opts_ = ScanOptions::Make(arrow::schema({field("value", int64())}));
+    int64_t row_count = 0;
+    for (auto maybe_fragment : written->GetFragments(opts_)) {
+      ASSERT_OK_AND_ASSIGN(auto fragment, std::move(maybe_fragment));
+
+      int32_t part = -1;
+      ASSERT_OK(KeyValuePartitioning::VisitKeys(
+          *fragment->partition_expression(),
+          [&](const std::string& name, const std::shared_ptr<Scalar>& value) {
+            part = checked_pointer_cast<Int32Scalar>(value)->value;
+            return Status::OK();
+          }));
+
+      int64_t file_row_count = 0, last_value = -1;
+      for (auto maybe_batch : Batches(fragment.get())) {
+        ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        auto values = checked_pointer_cast<Int64Array>(batch->column(0));
+        for (int64_t i = 0; i < values->length(); ++i) {
+          EXPECT_EQ(values->Value(i) % 3, part);
+          EXPECT_GT(values->Value(i), last_value);
+          last_value = values->Value(i);
+        }
+        file_row_count += batch->num_rows();
+      }
+      EXPECT_LE(file_row_count, 4);
+      row_count += file_row_count;
+    }
+    EXPECT_EQ(row_count, 30);
+  }
+}
+
 TEST_F(TestIpcFileFormat, OpenFailureWithRelevantError) {
   std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
   auto result = format_->Inspect(FileSource(buf));
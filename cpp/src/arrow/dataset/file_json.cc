@@ -0,0 +1,192 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_json.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/chunker.h"
+#include "arrow/json/reader.h"
+#include "arrow/table.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+static json::ReadOptions default_read_options(int32_t block_size) {
+  auto options = json::ReadOptions::Defaults();
+  // Parallelism is obtained by scanning blocks concurrently
+  options.use_threads = false;
+  options.block_size = block_size;
+  return options;
+}
+
+static Result<std::shared_ptr<Table>> ReadBlock(const FileSource& source,
+                                                const std::shared_ptr<Buffer>& block,
+                                                const json::ReadOptions& read_options,
+                                                const json::ParseOptions& parse_options,
+                                                MemoryPool* pool) {
+  std::shared_ptr<json::TableReader> reader;
+  std::shared_ptr<Table> table;
+  auto status = json::TableReader::Make(pool, std::make_shared<io::BufferReader>(block),
+                                        read_options, parse_options, &reader);
+  if (status.ok()) {
+    status = reader->Read(&table);
+  }
+  if (!status.ok()) {
+    return status.WithMessage("Could not read JSON input source '", source.path(),
+                              "': ", status.message());
+  }
+  return table;
+}
+
+/// \brief A ScanTask parsing and converting a single block of a JSON file.
+class JsonScanTask : public ScanTask {
+ public:
+  JsonScanTask(std::shared_ptr<const JsonFileFormat> format, FileSource source,
+               std::shared_ptr<Buffer> block, std::shared_ptr<ScanOptions> options,
+               std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        format_(std::move(format)),
+        source_(std::move(source)),
+        block_(std::move(block)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // Only convert the materialized fields, with the types from the scan schema
+    std::vector<std::shared_ptr<Field>> fields;
+    for (const auto& name : options_->MaterializedFields()) {
+      auto field = options_->schema()->GetFieldByName(name);
+      if (field != nullptr && GetFieldIndex(fields, name) == -1) {
+        fields.push_back(std::move(field));
+      }
+    }
+
+    auto parse_options = format_->parse_options;
+    parse_options.explicit_schema = schema(std::move(fields));
+    parse_options.unexpected_field_behavior = json::UnexpectedFieldBehavior::Ignore;
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto table,
+        ReadBlock(source_, block_, default_read_options(format_->block_size),
+                  parse_options, context_->pool));
+    RecordBatchVector batches;
+    RETURN_NOT_OK(TableBatchReader(*table).ReadAll(&batches));
+    return MakeVectorIterator(std::move(batches));
+  }
+
+ private:
+  static int GetFieldIndex(const std::vector<std::shared_ptr<Field>>& fields,
+                           const std::string& name) {
+    for (size_t i = 0; i < fields.size(); ++i) {
+      if (fields[i]->name() == name) return static_cast<int>(i);
+    }
+    return -1;
+  }
+
+  std::shared_ptr<const JsonFileFormat> format_;
+  FileSource source_;
+  std::shared_ptr<Buffer> block_;
+};
+
+class JsonScanTaskIterator {
+ public:
+  static Result<ScanTaskIterator> Make(std::shared_ptr<const JsonFileFormat> format,
+                                       FileSource source,
+                                       std::shared_ptr<ScanOptions> options,
+                                       std::shared_ptr<ScanContext> context) {
+    ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+    ARROW_ASSIGN_OR_RAISE(
+        auto block_it,
+        DelimitedBlockIterator::Make(std::move(input),
+                                     json::MakeChunker(format->parse_options),
+                                     format->block_size, context->pool));
+
+    return ScanTaskIterator(JsonScanTaskIterator(std::move(format), std::move(source),
+                                                 std::move(block_it), std::move(options),
+                                                 std::move(context)));
+  }
+
+  Result<std::shared_ptr<ScanTask>> Next() {
+    std::shared_ptr<Buffer> block;
+    while (block == nullptr || block->size() == 0) {
+      ARROW_ASSIGN_OR_RAISE(block, block_it_.Next());
+      if (block == nullptr) {
+        // Iteration is done.
+        return nullptr;
+      }
+    }
+    return std::make_shared<JsonScanTask>(format_, source_, std::move(block), options_,
+                                          context_);
+  }
+
+ private:
+  JsonScanTaskIterator(std::shared_ptr<const JsonFileFormat> format, FileSource source,
+                       Iterator<std::shared_ptr<Buffer>> block_it,
+                       std::shared_ptr<ScanOptions> options,
+                       std::shared_ptr<ScanContext> context)
+      : format_(std::move(format)),
+        source_(std::move(source)),
+        block_it_(std::move(block_it)),
+        options_(std::move(options)),
+        context_(std::move(context)) {}
+
+  std::shared_ptr<const JsonFileFormat> format_;
+  FileSource source_;
+  Iterator<std::shared_ptr<Buffer>> block_it_;
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+};
+
+Result<bool> JsonFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return Inspect(source).ok();
+}
+
+Result<std::shared_ptr<Schema>> JsonFileFormat::Inspect(const FileSource& source) const {
+  auto pool = default_memory_pool();
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  ARROW_ASSIGN_OR_RAISE(
+      auto block_it,
+      DelimitedBlockIterator::Make(std::move(input), json::MakeChunker(parse_options),
+                                   block_size, pool));
+  ARROW_ASSIGN_OR_RAISE(auto first_block, block_it.Next());
+  if (first_block == nullptr) {
+    return Status::Invalid("Empty JSON file '", source.path(), "'");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto table, ReadBlock(source, first_block,
+                                              default_read_options(block_size),
+                                              parse_options, pool));
+  return table->schema();
+}
+
+Result<ScanTaskIterator> JsonFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  auto format = internal::checked_pointer_cast<const JsonFileFormat>(shared_from_this());
+  return JsonScanTaskIterator::Make(std::move(format), source, std::move(options),
+                                    std::move(context));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_json.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t kNumRows = 1 << 10;
+
+class TestJsonFileFormat : public ::testing::Test {
+ public:
+  std::unique_ptr<FileSource> GetFileSource(int64_t num_rows = kNumRows) {
+    std::string json;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      json += "{\"f64\": " + std::to_string(i) + ".5, \"str\": \"row " +
+              std::to_string(i) + "\"}\n";
+    }
+    return internal::make_unique<FileSource>(Buffer::FromString(std::move(json)));
+  }
+
+  RecordBatchIterator Batches(ScanTaskIterator scan_task_it) {
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> scan_task) { return scan_task->Execute(); },
+        std::move(scan_task_it)));
+  }
+
+  RecordBatchIterator Batches(Fragment* fragment) {
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+    return Batches(std::move(scan_task_it));
+  }
+
+ protected:
+  std::shared_ptr<JsonFileFormat> format_ = std::make_shared<JsonFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+  std::shared_ptr<Schema> schema_ =
+      schema({field("f64", float64()), field("str", utf8())});
+};
+
+TEST_F(TestJsonFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource();
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  int64_t row_count = 0;
+
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    AssertSchemaEqual(*batch->schema(), *schema_);
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestJsonFileFormat, ScanBlocks) {
+  auto source = GetFileSource();
+  format_->block_size = 1 << 10;
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+  int64_t row_count = 0, task_count = 0;
+
+  for (auto maybe_task : scan_task_it) {
+    ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+    ++task_count;
+    ASSERT_OK_AND_ASSIGN(auto batch_it, task->Execute());
+    for (auto maybe_batch : batch_it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+    }
+  }
+
+  ASSERT_GT(task_count, 1);
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestJsonFileFormat, ScanRecordBatchReaderProjected) {
+  auto source = GetFileSource();
+
+  opts_ = ScanOptions::Make(schema({field("str", utf8())}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  int64_t row_count = 0;
+
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    AssertSchemaEqual(*batch->schema(), *opts_->schema());
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestJsonFileFormat, Inspect) {
+  auto source = GetFileSource();
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source.get()));
+  EXPECT_EQ(*actual, *schema_);
+}
+
+TEST_F(TestJsonFileFormat, IsSupported) {
+  bool supported;
+
+  auto source = FileSource(Buffer::FromString("not json\n"));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(source));
+  ASSERT_EQ(supported, false);
+
+  source = FileSource(Buffer::FromString("{\"f64\": 1.5, \"str\": \"hello\"}\n"));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(source));
+  EXPECT_EQ(supported, true);
+}
+
+}  // namespace dataset
+}  // namespace arrow
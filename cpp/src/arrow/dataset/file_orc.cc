@@ -0,0 +1,317 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/optional.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+using adapters::orc::ORCSearchArgument;
+
+static Result<std::unique_ptr<adapters::orc::ORCFileReader>> OpenReader(
+    const FileSource& source, MemoryPool* pool = default_memory_pool()) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  auto status = adapters::orc::ORCFileReader::Open(std::move(input), pool, &reader);
+  if (!status.ok()) {
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
+  }
+  return std::move(reader);
+}
+
+static bool IsSearchableColumn(const Schema& file_schema, const std::string& name) {
+  auto field = file_schema.GetFieldByName(name);
+  if (field == nullptr) {
+    // e.g. a partition field
+    return false;
+  }
+  switch (field->type()->id()) {
+    case Type::BOOL:
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::STRING:
+    case Type::DATE32:
+    case Type::TIMESTAMP:
+    case Type::DECIMAL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static util::optional<ORCSearchArgument> ComparisonToSearchArgument(
+    const ComparisonExpression& expr, const Schema& file_schema) {
+  const Expression* field = expr.left_operand().get();
+  const Expression* literal = expr.right_operand().get();
+  auto op = expr.op();
+  if (field->type() != ExpressionType::FIELD) {
+    // normalize `literal op field` to `field op' literal`
+    std::swap(field, literal);
+    switch (op) {
+      case compute::CompareOperator::LESS:
+        op = compute::CompareOperator::GREATER;
+        break;
+      case compute::CompareOperator::LESS_EQUAL:
+        op = compute::CompareOperator::GREATER_EQUAL;
+        break;
+      case compute::CompareOperator::GREATER:
+        op = compute::CompareOperator::LESS;
+        break;
+      case compute::CompareOperator::GREATER_EQUAL:
+        op = compute::CompareOperator::LESS_EQUAL;
+        break;
+      default:
+        break;
+    }
+  }
+  if (field->type() != ExpressionType::FIELD ||
+      literal->type() != ExpressionType::SCALAR) {
+    return util::nullopt;
+  }
+
+  const auto& name = checked_cast<const FieldExpression&>(*field).name();
+  const auto& literal_value = checked_cast<const ScalarExpression&>(*literal).value();
+  if (!IsSearchableColumn(file_schema, name) || !literal_value->is_valid) {
+    return util::nullopt;
+  }
+  // e.g. an int64 literal outside of the range of an int32 column
+  auto maybe_value = ORCSearchArgument::CastLiteral(
+      literal_value, file_schema.GetFieldByName(name)->type());
+  if (!maybe_value.ok()) {
+    return util::nullopt;
+  }
+  auto value = maybe_value.MoveValueUnsafe();
+
+  switch (op) {
+    case compute::CompareOperator::EQUAL:
+      return ORCSearchArgument::Equal(name, value);
+    case compute::CompareOperator::NOT_EQUAL:
+      return ORCSearchArgument::Not(ORCSearchArgument::Equal(name, value));
+    case compute::CompareOperator::LESS:
+      return ORCSearchArgument::LessThan(name, value);
+    case compute::CompareOperator::LESS_EQUAL:
+      return ORCSearchArgument::LessThanEqual(name, value);
+    case compute::CompareOperator::GREATER:
+      return ORCSearchArgument::Not(ORCSearchArgument::LessThanEqual(name, value));
+    case compute::CompareOperator::GREATER_EQUAL:
+      return ORCSearchArgument::Not(ORCSearchArgument::LessThan(name, value));
+  }
+  return util::nullopt;
+}
+
+util::optional<ORCSearchArgument> ToOrcSearchArgument(const Expression& expr,
+                                                      const Schema& file_schema) {
+  switch (expr.type()) {
+    case ExpressionType::AND: {
+      const auto& and_expr = checked_cast<const AndExpression&>(expr);
+      auto left = ToOrcSearchArgument(*and_expr.left_operand(), file_schema);
+      auto right = ToOrcSearchArgument(*and_expr.right_operand(), file_schema);
+      if (left.has_value() && right.has_value()) {
+        return ORCSearchArgument::And({std::move(*left), std::move(*right)});
+      }
+      // a conjunction implies each of its operands
+      return left.has_value() ? left : right;
+    }
+    case ExpressionType::OR: {
+      const auto& or_expr = checked_cast<const OrExpression&>(expr);
+      auto left = ToOrcSearchArgument(*or_expr.left_operand(), file_schema);
+      auto right = ToOrcSearchArgument(*or_expr.right_operand(), file_schema);
+      if (left.has_value() && right.has_value()) {
+        return ORCSearchArgument::Or({std::move(*left), std::move(*right)});
+      }
+      return util::nullopt;
+    }
+    case ExpressionType::NOT: {
+      const auto& operand = *checked_cast<const NotExpression&>(expr).operand();
+      // only leaves translate exactly, so only they may be negated
+      if (operand.type() == ExpressionType::COMPARISON) {
+        auto child = ToOrcSearchArgument(operand, file_schema);
+        if (child.has_value()) {
+          return ORCSearchArgument::Not(std::move(*child));
+        }
+      }
+      return util::nullopt;
+    }
+    case ExpressionType::IS_VALID: {
+      const auto& operand = *checked_cast<const IsValidExpression&>(expr).operand();
+      if (operand.type() != ExpressionType::FIELD) {
+        return util::nullopt;
+      }
+      const auto& name = checked_cast<const FieldExpression&>(operand).name();
+      if (!IsSearchableColumn(file_schema, name)) {
+        return util::nullopt;
+      }
+      return ORCSearchArgument::Not(ORCSearchArgument::IsNull(name));
+    }
+    case ExpressionType::COMPARISON:
+      return ComparisonToSearchArgument(checked_cast<const ComparisonExpression&>(expr),
+                                        file_schema);
+    default:
+      return util::nullopt;
+  }
+}
+
+/// \brief A ScanTask reading a single stripe of an ORC file.
+class OrcScanTask : public ScanTask {
+ public:
+  OrcScanTask(FileSource source, int64_t stripe,
+              std::shared_ptr<std::vector<std::string>> included_names,
+              std::shared_ptr<ORCSearchArgument> sarg,
+              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        source_(std::move(source)),
+        stripe_(stripe),
+        included_names_(std::move(included_names)),
+        sarg_(std::move(sarg)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // Each task opens its own reader so that stripes can be decoded concurrently
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source_, context_->pool));
+    if (sarg_ != nullptr) {
+      RETURN_NOT_OK(reader->SetSearchArgument(*sarg_));
+    }
+
+    // Yield each run of selected row groups as it was decoded, rather than
+    // concatenating them
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(reader->ReadStripe(stripe_, *included_names_, &table));
+    RecordBatchVector batches;
+    RETURN_NOT_OK(TableBatchReader(*table).ReadAll(&batches));
+    return MakeVectorIterator(std::move(batches));
+  }
+
+ private:
+  FileSource source_;
+  int64_t stripe_;
+  std::shared_ptr<std::vector<std::string>> included_names_;
+  std::shared_ptr<ORCSearchArgument> sarg_;
+};
+
+class OrcScanTaskIterator {
+ public:
+  static Result<ScanTaskIterator> Make(FileSource source,
+                                       std::shared_ptr<ScanOptions> options,
+                                       std::shared_ptr<ScanContext> context) {
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, context->pool));
+    std::shared_ptr<Schema> file_schema;
+    RETURN_NOT_OK(reader->ReadSchema(&file_schema));
+
+    // liborc rejects unknown column names, select only those present in the file
+    auto included_names = std::make_shared<std::vector<std::string>>();
+    for (const auto& name : options->MaterializedFields()) {
+      if (file_schema->GetFieldIndex(name) != -1 &&
+          std::find(included_names->begin(), included_names->end(), name) ==
+              included_names->end()) {
+        included_names->push_back(name);
+      }
+    }
+    if (included_names->empty() && file_schema->num_fields() > 0) {
+      // Still decode one column to produce the right number of rows
+      included_names->push_back(file_schema->field(0)->name());
+    }
+
+    // Skip stripes and row groups which cannot satisfy the filter
+    std::shared_ptr<ORCSearchArgument> sarg;
+    if (options->filter != nullptr) {
+      auto maybe_sarg = ToOrcSearchArgument(*options->filter, *file_schema);
+      if (maybe_sarg.has_value()) {
+        sarg = std::make_shared<ORCSearchArgument>(std::move(*maybe_sarg));
+      }
+    }
+
+    return ScanTaskIterator(OrcScanTaskIterator(
+        std::move(source), reader->NumberOfStripes(), std::move(included_names),
+        std::move(sarg), std::move(options), std::move(context)));
+  }
+
+  Result<std::shared_ptr<ScanTask>> Next() {
+    if (stripe_ == num_stripes_) {
+      // Iteration is done.
+      return nullptr;
+    }
+
+    return std::make_shared<OrcScanTask>(source_, stripe_++, included_names_, sarg_,
+                                         options_, context_);
+  }
+
+ private:
+  OrcScanTaskIterator(FileSource source, int64_t num_stripes,
+                      std::shared_ptr<std::vector<std::string>> included_names,
+                      std::shared_ptr<ORCSearchArgument> sarg,
+                      std::shared_ptr<ScanOptions> options,
+                      std::shared_ptr<ScanContext> context)
+      : source_(std::move(source)),
+        num_stripes_(num_stripes),
+        included_names_(std::move(included_names)),
+        sarg_(std::move(sarg)),
+        options_(std::move(options)),
+        context_(std::move(context)) {}
+
+  FileSource source_;
+  int64_t stripe_ = 0;
+  int64_t num_stripes_;
+  std::shared_ptr<std::vector<std::string>> included_names_;
+  std::shared_ptr<ORCSearchArgument> sarg_;
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+};
+
+Result<bool> OrcFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return OpenReader(source).ok();
+}
+
+Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+  return schema;
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  return OrcScanTaskIterator::Make(source, std::move(options), std::move(context));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+#include "arrow/util/optional.h"
+
+namespace arrow {
+namespace adapters {
+namespace orc {
+struct ORCSearchArgument;
+}  // namespace orc
+}  // namespace adapters
+
+namespace dataset {
+
+/// \brief A FileFormat implementation that reads from ORC files
+///
+/// Each stripe of a file yields its own ScanTask. Only the materialized
+/// columns are decoded.
+class ARROW_DS_EXPORT OrcFileFormat : public FileFormat {
+ public:
+  std::string type_name() const override { return "orc"; }
+
+  bool splittable() const override { return true; }
+
+  Result<bool> IsSupported(const FileSource& source) const override;
+
+  /// \brief Return the schema of the file if possible.
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
+
+  /// \brief Open a file for scanning
+  Result<ScanTaskIterator> ScanFile(const FileSource& source,
+                                    std::shared_ptr<ScanOptions> options,
+                                    std::shared_ptr<ScanContext> context) const override;
+};
+
+/// \brief Translate as much of a filter as ORC can evaluate against row group
+/// statistics. The result may select more rows than the filter, never fewer; nullopt
+/// means no row group can be ruled out.
+ARROW_DS_EXPORT util::optional<adapters::orc::ORCSearchArgument> ToOrcSearchArgument(
+    const Expression& filter, const Schema& file_schema);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,335 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t kBatchSize = 1UL << 12;
+constexpr int64_t kBatchRepetitions = 1 << 3;
+constexpr int64_t kNumRows = kBatchSize * kBatchRepetitions;
+
+class TestOrcFileFormat : public ::testing::Test {
+ public:
+  // Write the batches of reader, each batch in its own stripe
+  std::shared_ptr<Buffer> Write(RecordBatchReader* reader) {
+    EXPECT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+
+    adapters::orc::ORCWriterOptions options;
+    options.batch_size = kBatchSize;
+    options.stripe_size = 1;
+    std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+    ARROW_EXPECT_OK(adapters::orc::ORCFileWriter::Open(reader->schema(), sink.get(),
+                                                       options, &writer));
+    ARROW_EXPECT_OK(MakeFunctionIterator([reader] { return reader->Next(); })
+                        .Visit([&](std::shared_ptr<RecordBatch> batch) {
+                          return writer->Write(*batch);
+                        }));
+    ARROW_EXPECT_OK(writer->Close());
+
+    // XXX the rest of the test may crash if this fails, since out will be nullptr
+    EXPECT_OK_AND_ASSIGN(auto out, sink->Finish());
+    return out;
+  }
+
+  std::unique_ptr<FileSource> GetFileSource(RecordBatchReader* reader) {
+    return internal::make_unique<FileSource>(Write(reader));
+  }
+
+  std::unique_ptr<RecordBatchReader> GetRecordBatchReader(
+      std::shared_ptr<Schema> schema = nullptr) {
+    return MakeGeneratedRecordBatch(schema ? schema : schema_, kBatchSize,
+                                    kBatchRepetitions);
+  }
+
+  RecordBatchIterator Batches(ScanTaskIterator scan_task_it) {
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> scan_task) { return scan_task->Execute(); },
+        std::move(scan_task_it)));
+  }
+
+  RecordBatchIterator Batches(Fragment* fragment) {
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+    return Batches(std::move(scan_task_it));
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ = schema({field("f64", float64())});
+  std::shared_ptr<OrcFileFormat> format_ = std::make_shared<OrcFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestOrcFileFormat, ScanRecordBatchReader) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  // One ScanTask per stripe
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+  int64_t row_count = 0, task_count = 0;
+
+  for (auto maybe_task : scan_task_it) {
+    ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+    ++task_count;
+    ASSERT_OK_AND_ASSIGN(auto batch_it, task->Execute());
+    for (auto maybe_batch : batch_it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      AssertSchemaEqual(*batch->schema(), *schema_);
+      row_count += batch->num_rows();
+    }
+  }
+
+  ASSERT_EQ(task_count, kBatchRepetitions);
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestOrcFileFormat, WriteReadRoundTrip) {
+  schema_ = schema({field("i64", int64()), field("str", utf8())});
+  auto batch = RecordBatchFromJSON(schema_, R"([
+    {"i64": 1, "str": "a"},
+    {"i64": null, "str": "bb"},
+    {"i64": 3, "str": null}
+  ])");
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches({batch, batch}));
+  TableBatchReader table_reader(*expected);
+  auto source = GetFileSource(&table_reader);
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    batches.push_back(std::move(batch));
+  }
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(schema_, batches));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestOrcFileFormat, OpenFailureWithRelevantError) {
+  std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
+  auto result = format_->Inspect(FileSource(buf));
+  ASSERT_FALSE(result.ok());
+  EXPECT_THAT(result.status().message(), testing::HasSubstr("<Buffer>"));
+
+  constexpr auto file_name = "herp/derp";
+  ASSERT_OK_AND_ASSIGN(
+      auto fs, fs::internal::MockFileSystem::Make(fs::kNoTime, {fs::File(file_name)}));
+  result = format_->Inspect({file_name, fs.get()});
+  ASSERT_FALSE(result.ok());
+  EXPECT_THAT(result.status().message(), testing::HasSubstr(file_name));
+}
+
+TEST_F(TestOrcFileFormat, ScanRecordBatchReaderProjected) {
+  schema_ = schema({field("f64", float64()), field("i64", int64()),
+                    field("f32", float32()), field("i32", int32())});
+
+  opts_ = ScanOptions::Make(schema_);
+  opts_->projector = RecordBatchProjector(SchemaFromColumnNames(schema_, {"f64"}));
+  opts_->filter = equal(field_ref("i32"), scalar(0));
+
+  // NB: projector is applied by the scanner; FileFragment does not evaluate it so
+  // we will not drop "i32" even though it is not in the projector's schema
+  auto expected_schema = schema({field("f64", float64()), field("i32", int32())});
+
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  int64_t row_count = 0;
+
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    row_count += batch->num_rows();
+    AssertSchemaEqual(*batch->schema(), *expected_schema,
+                      /*check_metadata=*/false);
+  }
+
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestOrcFileFormat, ScanRecordBatchReaderProjectedMissingCols) {
+  auto reader_without_i32 = GetRecordBatchReader(
+      schema({field("f64", float64()), field("i64", int64()), field("f32", float32())}));
+
+  auto reader_without_f64 = GetRecordBatchReader(
+      schema({field("i64", int64()), field("f32", float32()), field("i32", int32())}));
+
+  auto reader =
+      GetRecordBatchReader(schema({field("f64", float64()), field("i64", int64()),
+                                   field("f32", float32()), field("i32", int32())}));
+
+  schema_ = reader->schema();
+  opts_ = ScanOptions::Make(schema_);
+  opts_->projector = RecordBatchProjector(SchemaFromColumnNames(schema_, {"f64"}));
+  opts_->filter = equal(field_ref("i32"), scalar(0));
+
+  auto readers = {reader.get(), reader_without_i32.get(), reader_without_f64.get()};
+  for (auto reader : readers) {
+    auto source = GetFileSource(reader);
+    ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+    // in the case where a file doesn't contain a referenced field, we won't
+    // materialize it (the filter/projector will populate it with nulls later)
+    std::shared_ptr<Schema> expected_schema;
+    if (reader == reader_without_i32.get()) {
+      expected_schema = schema({field("f64", float64())});
+    } else if (reader == reader_without_f64.get()) {
+      expected_schema = schema({field("i32", int32())});
+    } else {
+      expected_schema = schema({field("f64", float64()), field("i32", int32())});
+    }
+
+    int64_t row_count = 0;
+
+    for (auto maybe_batch : Batches(fragment.get())) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+      AssertSchemaEqual(*batch->schema(), *expected_schema,
+                        /*check_metadata=*/false);
+    }
+
+    ASSERT_EQ(row_count, kNumRows);
+  }
+}
+
+TEST_F(TestOrcFileFormat, Inspect) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source.get()));
+  EXPECT_EQ(*actual, *schema_);
+}
+
+TEST_F(TestOrcFileFormat, IsSupported) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  bool supported = false;
+
+  std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(FileSource(buf)));
+  ASSERT_EQ(supported, false);
+
+  buf = std::make_shared<Buffer>(util::string_view("corrupted"));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(FileSource(buf)));
+  ASSERT_EQ(supported, false);
+
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(*source));
+  EXPECT_EQ(supported, true);
+}
+
+class TestOrcSearchArgument : public ::testing::Test {
+ public:
+  void AssertConvertsTo(const Expression& filter, const std::string& expected) {
+    auto sarg = ToOrcSearchArgument(filter, *schema_);
+    ASSERT_TRUE(sarg.has_value()) << filter.ToString();
+    EXPECT_EQ(sarg->ToString(), expected) << filter.ToString();
+  }
+
+  void AssertNotConverted(const Expression& filter) {
+    auto sarg = ToOrcSearchArgument(filter, *schema_);
+    EXPECT_FALSE(sarg.has_value()) << filter.ToString() << " became "
+                                   << sarg->ToString();
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ =
+      schema({field("i32", int32()), field("str", utf8()), field("f64", float64()),
+              field("list", list(int32()))});
+};
+
+TEST_F(TestOrcSearchArgument, Comparisons) {
+  AssertConvertsTo("i32"_ == 1, "i32 == 1");
+  AssertConvertsTo("i32"_ != 1, "not(i32 == 1)");
+  AssertConvertsTo("i32"_ < 1, "i32 < 1");
+  AssertConvertsTo("i32"_ <= 1, "i32 <= 1");
+  AssertConvertsTo("i32"_ > 1, "not(i32 <= 1)");
+  AssertConvertsTo("i32"_ >= 1, "not(i32 < 1)");
+  AssertConvertsTo("str"_ == "hello", "str == hello");
+  AssertConvertsTo("f64"_ < 0.5, "f64 < 0.5");
+
+  // a literal on the left is moved to the right
+  AssertConvertsTo(*less(scalar(1), field_ref("i32")), "not(i32 <= 1)");
+  AssertConvertsTo(*greater_equal(scalar(1), field_ref("i32")), "i32 <= 1");
+}
+
+TEST_F(TestOrcSearchArgument, Logical) {
+  AssertConvertsTo("i32"_ == 1 and "str"_ == "a", "and(i32 == 1, str == a)");
+  AssertConvertsTo("i32"_ == 1 or "str"_ == "a", "or(i32 == 1, str == a)");
+  AssertConvertsTo(not("i32"_ < 1), "not(i32 < 1)");
+  AssertConvertsTo("i32"_.IsValid(), "not(i32 is null)");
+
+  // a conjunction implies each of its operands, a disjunction doesn't
+  AssertConvertsTo("i32"_ == 1 and "absent"_ == 1, "i32 == 1");
+  AssertNotConverted("i32"_ == 1 or "absent"_ == 1);
+
+  // negations of anything but a single comparison might select too few rows
+  AssertNotConverted(not("i32"_ == 1 and "absent"_ == 1));
+  AssertNotConverted(not("i32"_ == 1 or "str"_ == "a"));
+}
+
+TEST_F(TestOrcSearchArgument, Unsupported) {
+  // columns which are absent from the file (e.g. partition fields) or whose type
+  // ORC can't compare
+  AssertNotConverted("absent"_ == 1);
+  AssertNotConverted("list"_.IsValid());
+  AssertNotConverted(*equal(field_ref("list"), scalar(1)));
+
+  // comparisons other than between a column and a literal
+  AssertNotConverted("i32"_ == "f64"_);
+  AssertNotConverted(*equal(scalar(1), scalar(1)));
+
+  // comparisons with null select nothing, which row group statistics can't express
+  AssertNotConverted(*equal(field_ref("i32"), scalar(MakeNullScalar(int32()))));
+
+  AssertNotConverted("i32"_.In(ArrayFromJSON(int32(), "[1, 2]")));
+  AssertNotConverted(*scalar(true));
+}
+
+TEST_F(TestOrcSearchArgument, LiteralsOutOfRange) {
+  // literals are cast to the type of the column in the file
+  AssertConvertsTo(*less(field_ref("i32"), scalar(int64_t(5))), "i32 < 5");
+
+  // ... unless that would wrap or truncate them
+  AssertNotConverted(*less(field_ref("i32"), scalar(int64_t(1) << 40)));
+  AssertNotConverted(*equal(field_ref("i32"), scalar(1.5)));
+  AssertNotConverted(*greater(field_ref("i32"), scalar(1e300)));
+}
+
+}  // namespace dataset
+}  // namespace arrow
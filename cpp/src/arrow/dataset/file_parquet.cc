@@ -18,18 +18,23 @@
 #include "arrow/dataset/file_parquet.h"
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
+#include "arrow/dataset/projector.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/arrow/writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
@@ -75,11 +80,44 @@ class ParquetScanTask : public ScanTask {
   std::shared_ptr<parquet::arrow::FileReader> reader_;
 };
 
-static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
-    const FileSource& source, parquet::ReaderProperties properties) {
+static constexpr char kFooterCacheKind[] = "parquet/footer";
+
+static Result<util::optional<MetadataCache::Key>> MakeFooterCacheKey(
+    const FileSource& source, const parquet::ReaderProperties& properties,
+    const MetadataCache* cache) {
+  if (cache == nullptr || properties.file_decryption_properties() != nullptr) {
+    return util::optional<MetadataCache::Key>();
+  }
+  return MetadataCache::Key::Make(source, kFooterCacheKind);
+}
+
+/// \brief Open a parquet file, reusing its parsed footer if cache holds it and caching
+/// the footer otherwise. Parse errors are propagated as parquet::ParquetException.
+static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReaderUnsafe(
+    const FileSource& source, parquet::ReaderProperties properties,
+    MetadataCache* cache) {
+  ARROW_ASSIGN_OR_RAISE(auto key, MakeFooterCacheKey(source, properties, cache));
+  std::shared_ptr<parquet::FileMetaData> metadata;
+  if (key.has_value()) {
+    metadata = cache->Get<parquet::FileMetaData>(*key);
+  }
+
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  auto reader =
+      parquet::ParquetFileReader::Open(std::move(input), std::move(properties), metadata);
+
+  if (key.has_value() && metadata == nullptr) {
+    metadata = reader->metadata();
+    cache->Put(*key, metadata, metadata->size());
+  }
+  return std::move(reader);
+}
+
+static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
+    const FileSource& source, parquet::ReaderProperties properties,
+    MetadataCache* cache) {
   try {
-    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    return OpenReaderUnsafe(source, std::move(properties), cache);
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
@@ -356,10 +394,10 @@ ParquetFileFormat::ParquetFileFormat(const parquet::ReaderProperties& reader_pro
 
 Result<bool> ParquetFileFormat::IsSupported(const FileSource& source) const {
   try {
-    ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
     auto properties = MakeReaderProperties(*this);
-    auto reader =
-        parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          OpenReaderUnsafe(source, std::move(properties),
+                                           reader_options.metadata_cache.get()));
     auto metadata = reader->metadata();
     return metadata != nullptr && metadata->can_decompress();
   } catch (const ::parquet::ParquetInvalidOrCorruptedFileException& e) {
@@ -376,7 +414,8 @@ Result<bool> ParquetFileFormat::IsSupported(const FileSource& source) const {
 Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
     const FileSource& source) const {
   auto properties = MakeReaderProperties(*this);
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties)));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties),
+                                                reader_options.metadata_cache.get()));
 
   auto arrow_properties =
       MakeArrowReaderProperties(*this, parquet::kArrowDefaultBatchSize, *reader);
@@ -401,7 +440,8 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
     std::shared_ptr<ScanContext> context, const std::vector<int>& row_groups) const {
   auto properties = MakeReaderProperties(*this, context->pool);
   std::vector<int> row_groups_to_scan = std::vector<int>();
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties)));
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties),
+                                                reader_options.metadata_cache.get()));
   if (row_groups.empty()) {
     int maximum = reader->metadata()->num_row_groups();
     for (int i = 0; i < maximum; i++) {
@@ -471,7 +511,8 @@ Result<FragmentIterator> ParquetFileFormat::GetRowGroupFragments(
     const ParquetFileFragment& fragment, std::shared_ptr<Expression> extra_filter) {
   auto properties = MakeReaderProperties(*this);
   ARROW_ASSIGN_OR_RAISE(auto reader,
-                        OpenReader(fragment.source(), std::move(properties)));
+                        OpenReader(fragment.source(), std::move(properties),
+                                   reader_options.metadata_cache.get()));
 
   auto arrow_properties =
       MakeArrowReaderProperties(*this, parquet::kArrowDefaultBatchSize, *reader);
@@ -501,6 +542,50 @@ Result<FragmentIterator> ParquetFileFormat::GetRowGroupFragments(
   return MakeVectorIterator(std::move(fragments));
 }
 
+Result<std::unique_ptr<FileWriter>> ParquetFileFormat::MakeWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    MemoryPool* pool) {
+  class Writer : public FileWriter {
+   public:
+    Writer(std::shared_ptr<io::OutputStream> destination,
+           std::unique_ptr<parquet::arrow::FileWriter> writer)
+        : destination_(std::move(destination)), writer_(std::move(writer)) {}
+
+    Status Write(const RecordBatch& batch) override {
+      RETURN_NOT_OK(writer_->NewRowGroup(batch.num_rows()));
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        RETURN_NOT_OK(writer_->WriteColumnChunk(*batch.column(i)));
+      }
+      return Status::OK();
+    }
+
+    Status Finish() override {
+      RETURN_NOT_OK(writer_->Close());
+      return destination_->Close();
+    }
+
+   private:
+    std::shared_ptr<io::OutputStream> destination_;
+    std::unique_ptr<parquet::arrow::FileWriter> writer_;
+  };
+
+  auto properties = writer_properties;
+  if (properties == nullptr) {
+    properties = parquet::default_writer_properties();
+  }
+  auto arrow_properties = arrow_writer_properties;
+  if (arrow_properties == nullptr) {
+    arrow_properties = parquet::default_arrow_writer_properties();
+  }
+
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(*schema, pool, destination,
+                                                 std::move(properties),
+                                                 std::move(arrow_properties), &writer));
+  return std::unique_ptr<FileWriter>(
+      new Writer(std::move(destination), std::move(writer)));
+}
+
 Result<ScanTaskIterator> ParquetFileFragment::Scan(std::shared_ptr<ScanContext> context) {
   return parquet_format().ScanFile(source_, scan_options_, std::move(context),
                                    row_groups_);
@@ -510,5 +595,190 @@ const ParquetFileFormat& ParquetFileFragment::parquet_format() const {
   return internal::checked_cast<const ParquetFileFormat&>(*format_);
 }
 
+/// \brief A Dataset of the row groups recorded in a parquet summary file
+class ParquetSummaryDataset : public Dataset {
+ public:
+  struct RowGroup {
+    std::string path;
+    int index;
+    std::shared_ptr<Expression> partition;
+    std::shared_ptr<Expression> statistics;
+  };
+
+  ParquetSummaryDataset(std::shared_ptr<Schema> schema,
+                        std::shared_ptr<Expression> partition_expression,
+                        std::shared_ptr<ParquetFileFormat> format,
+                        std::shared_ptr<fs::FileSystem> filesystem,
+                        std::shared_ptr<std::vector<RowGroup>> row_groups)
+      : Dataset(std::move(schema), std::move(partition_expression)),
+        format_(std::move(format)),
+        filesystem_(std::move(filesystem)),
+        row_groups_(std::move(row_groups)) {}
+
+  std::string type_name() const override { return "parquet_summary"; }
+
+  Result<std::shared_ptr<Dataset>> ReplaceSchema(
+      std::shared_ptr<Schema> schema) const override {
+    RETURN_NOT_OK(CheckProjectable(*schema_, *schema));
+    return std::make_shared<ParquetSummaryDataset>(std::move(schema),
+                                                   partition_expression_, format_,
+                                                   filesystem_, row_groups_);
+  }
+
+ protected:
+  FragmentIterator GetFragmentsImpl(std::shared_ptr<ScanOptions> options) override {
+    FragmentVector fragments;
+    for (const auto& row_group : *row_groups_) {
+      auto filter = options->filter->Assume(row_group.partition);
+      auto pruned = filter->Assume(row_group.statistics);
+      if (pruned->IsNull() || pruned->Equals(false)) {
+        continue;
+      }
+
+      auto fragment_options = std::make_shared<ScanOptions>(*options);
+      fragment_options->filter = std::move(filter);
+      auto status = KeyValuePartitioning::SetDefaultValuesFromKeys(
+          *row_group.partition, &fragment_options->projector);
+      if (!status.ok()) {
+        return MakeErrorIterator<std::shared_ptr<Fragment>>(std::move(status));
+      }
+
+      auto fragment_partition =
+          partition_expression_ == nullptr || partition_expression_->Equals(true)
+              ? row_group.partition
+              : and_(partition_expression_, row_group.partition);
+      // The summary doesn't record the files' size or modification time. Give
+      // the source a FileInfo anyway so that its footer isn't cached, rather
+      // than have every scan look the file up.
+      fs::FileInfo info;
+      info.set_path(row_group.path);
+      info.set_type(fs::FileType::File);
+      auto maybe_fragment = format_->MakeFragment(
+          FileSource(std::move(info), filesystem_.get()), std::move(fragment_options),
+          std::move(fragment_partition), {row_group.index});
+      if (!maybe_fragment.ok()) {
+        return MakeErrorIterator<std::shared_ptr<Fragment>>(maybe_fragment.status());
+      }
+      fragments.push_back(std::move(maybe_fragment).ValueOrDie());
+    }
+
+    return MakeVectorIterator(std::move(fragments));
+  }
+
+ private:
+  std::shared_ptr<ParquetFileFormat> format_;
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  std::shared_ptr<std::vector<RowGroup>> row_groups_;
+};
+
+ParquetDatasetFactory::ParquetDatasetFactory(
+    std::shared_ptr<fs::FileSystem> filesystem, std::shared_ptr<ParquetFileFormat> format,
+    std::shared_ptr<parquet::FileMetaData> metadata,
+    std::shared_ptr<Schema> physical_schema, std::vector<std::string> paths,
+    ParquetFactoryOptions options)
+    : filesystem_(std::move(filesystem)),
+      format_(std::move(format)),
+      metadata_(std::move(metadata)),
+      physical_schema_(std::move(physical_schema)),
+      paths_(std::move(paths)),
+      options_(std::move(options)) {}
+
+Result<std::shared_ptr<DatasetFactory>> ParquetDatasetFactory::Make(
+    const std::string& metadata_path, std::shared_ptr<fs::FileSystem> filesystem,
+    std::shared_ptr<ParquetFileFormat> format, ParquetFactoryOptions options) {
+  auto base_dir = fs::internal::GetAbstractPathParent(metadata_path).first;
+  if (options.partition_base_dir.empty()) {
+    options.partition_base_dir = base_dir;
+  }
+
+  // The summary is itself a parquet file without data
+  FileSource source(metadata_path, filesystem.get());
+  ARROW_ASSIGN_OR_RAISE(auto physical_schema, format->Inspect(source));
+  auto properties = MakeReaderProperties(*format);
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        OpenReader(source, std::move(properties),
+                                   format->reader_options.metadata_cache.get()));
+  auto metadata = reader->metadata();
+
+  std::vector<std::string> paths(metadata->num_row_groups());
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    auto row_group = metadata->RowGroup(i);
+    const auto& file_path =
+        row_group->num_columns() > 0 ? row_group->ColumnChunk(0)->file_path() : "";
+    if (file_path.empty()) {
+      return Status::Invalid("Row group ", i, " of parquet summary file '",
+                             metadata_path, "' does not record the path of its file");
+    }
+    paths[i] = fs::internal::ConcatAbstractPath(base_dir, file_path);
+  }
+
+  return std::shared_ptr<DatasetFactory>(new ParquetDatasetFactory(
+      std::move(filesystem), std::move(format), std::move(metadata),
+      std::move(physical_schema), std::move(paths), std::move(options)));
+}
+
+Result<std::shared_ptr<Schema>> ParquetDatasetFactory::PartitionSchema() {
+  if (auto partitioning = options_.partitioning.partitioning()) {
+    return partitioning->schema();
+  }
+
+  std::vector<util::string_view> paths;
+  for (const auto& path : paths_) {
+    if (auto relative = fs::internal::RemoveAncestor(options_.partition_base_dir, path)) {
+      paths.push_back(*relative);
+    }
+  }
+
+  return options_.partitioning.factory()->Inspect(paths);
+}
+
+Result<std::vector<std::shared_ptr<Schema>>> ParquetDatasetFactory::InspectSchemas(
+    InspectOptions options) {
+  ARROW_ASSIGN_OR_RAISE(auto partition_schema, PartitionSchema());
+  return std::vector<std::shared_ptr<Schema>>{physical_schema_,
+                                              std::move(partition_schema)};
+}
+
+Result<std::shared_ptr<Dataset>> ParquetDatasetFactory::Finish(FinishOptions options) {
+  std::shared_ptr<Schema> schema = options.schema;
+  if (schema == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(schema, Inspect(options.inspect_options));
+  } else if (options.validate_fragments) {
+    RETURN_NOT_OK(SchemaBuilder::AreCompatible({schema, physical_schema_}));
+  }
+
+  std::shared_ptr<Partitioning> partitioning = options_.partitioning.partitioning();
+  if (partitioning == nullptr) {
+    auto factory = options_.partitioning.factory();
+    ARROW_ASSIGN_OR_RAISE(partitioning, factory->Finish(schema));
+  }
+
+  parquet::ArrowReaderProperties arrow_properties(/* use_threads = */ false);
+  // The summary lists the row groups of each file contiguously and in order
+  std::unordered_map<std::string, int> row_groups_per_path;
+  auto row_groups = std::make_shared<std::vector<ParquetSummaryDataset::RowGroup>>(
+      metadata_->num_row_groups());
+  for (int i = 0; i < metadata_->num_row_groups(); ++i) {
+    auto& row_group = (*row_groups)[i];
+    row_group.path = paths_[i];
+    row_group.index = row_groups_per_path[paths_[i]]++;
+    row_group.partition = scalar(true);
+    if (auto relative =
+            fs::internal::RemoveAncestor(options_.partition_base_dir, paths_[i])) {
+      ARROW_ASSIGN_OR_RAISE(row_group.partition,
+                            partitioning->Parse(relative->to_string()));
+    }
+
+    // Errors with statistics are ignored and post-filtering will apply
+    row_group.statistics =
+        RowGroupStatisticsAsExpression(*metadata_->RowGroup(i), arrow_properties)
+            .ValueOr(scalar(true));
+  }
+
+  return std::make_shared<ParquetSummaryDataset>(std::move(schema), root_partition_,
+                                                 format_, filesystem_,
+                                                 std::move(row_groups));
+}
+
 }  // namespace dataset
 }  // namespace arrow
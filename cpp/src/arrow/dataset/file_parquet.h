@@ -23,7 +23,10 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/dataset/discovery.h"
 #include "arrow/dataset/file_base.h"
+#include "arrow/dataset/metadata_cache.h"
+#include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 
@@ -34,6 +37,8 @@ class FileMetaData;
 class FileDecryptionProperties;
 class ReaderProperties;
 class ArrowReaderProperties;
+class WriterProperties;
+class ArrowWriterProperties;
 }  // namespace parquet
 
 namespace arrow {
@@ -81,8 +86,18 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     /// @{
     std::unordered_set<std::string> dict_columns;
     /// @}
+
+    /// Cache of parsed footers, shared by every fragment of every dataset which uses
+    /// it so that a file's footer is read and parsed once rather than once per
+    /// Inspect, fragment and scan. If null, footers are not cached. Footers of
+    /// encrypted files are never cached.
+    std::shared_ptr<MetadataCache> metadata_cache = MetadataCache::Default();
   } reader_options;
 
+  /// Properties of files written by MakeWriter. If null, parquet's defaults are used.
+  std::shared_ptr<parquet::WriterProperties> writer_properties;
+  std::shared_ptr<parquet::ArrowWriterProperties> arrow_writer_properties;
+
   Result<bool> IsSupported(const FileSource& source) const override;
 
   /// \brief Return the schema of the file if possible.
@@ -110,6 +125,11 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
       FileSource source, std::shared_ptr<ScanOptions> options,
       std::shared_ptr<Expression> partition_expression, std::vector<int> row_groups);
 
+  /// \brief Open a FileWriter which writes one row group per batch.
+  Result<std::unique_ptr<FileWriter>> MakeWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      MemoryPool* pool) override;
+
   /// \brief Split a ParquetFileFragment into a Fragment for each row group.
   /// Row groups whose metadata contradicts the fragment's filter or the extra_filter
   /// will be excluded.
@@ -142,5 +162,61 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   friend class ParquetFileFormat;
 };
 
+struct ParquetFactoryOptions {
+  // Either an explicit Partitioning or a PartitioningFactory to discover one, applied
+  // to the paths of the data files recorded in the summary file. See
+  // FileSystemFactoryOptions::partitioning.
+  PartitioningOrFactory partitioning{Partitioning::Default()};
+
+  // For the purposes of applying the partitioning, paths will be stripped of the
+  // partition_base_dir. If empty, the directory containing the summary file is used.
+  std::string partition_base_dir;
+};
+
+/// \brief Create a Dataset from a Parquet `_metadata` summary file, such as one written
+/// by parquet::WriteMetaDataFile with the result of parquet::FileMetaData::MakeSummary.
+///
+/// The summary holds the footers of every file of the dataset, so the Dataset yields
+/// a ParquetFileFragment per row group and prunes row groups whose partition or
+/// statistics contradict a scan's filter without opening any data file.
+class ARROW_DS_EXPORT ParquetDatasetFactory : public DatasetFactory {
+ public:
+  /// \brief Build a ParquetDatasetFactory from a summary file.
+  ///
+  /// \param[in] metadata_path the path of the summary file. The file paths recorded in
+  /// its column chunks are resolved relative to the directory containing it.
+  /// \param[in] filesystem from which the summary and data files are read
+  /// \param[in] format used to read the data files
+  /// \param[in] options see ParquetFactoryOptions for more information.
+  static Result<std::shared_ptr<DatasetFactory>> Make(
+      const std::string& metadata_path, std::shared_ptr<fs::FileSystem> filesystem,
+      std::shared_ptr<ParquetFileFormat> format, ParquetFactoryOptions options);
+
+  /// \brief Get the schema of the summary file and of the partitioning.
+  ///
+  /// The summary's schema is the schema of every data file, so options are ignored.
+  Result<std::vector<std::shared_ptr<Schema>>> InspectSchemas(
+      InspectOptions options) override;
+
+  Result<std::shared_ptr<Dataset>> Finish(FinishOptions options) override;
+
+ protected:
+  ParquetDatasetFactory(std::shared_ptr<fs::FileSystem> filesystem,
+                        std::shared_ptr<ParquetFileFormat> format,
+                        std::shared_ptr<parquet::FileMetaData> metadata,
+                        std::shared_ptr<Schema> physical_schema,
+                        std::vector<std::string> paths, ParquetFactoryOptions options);
+
+  Result<std::shared_ptr<Schema>> PartitionSchema();
+
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  std::shared_ptr<ParquetFileFormat> format_;
+  std::shared_ptr<parquet::FileMetaData> metadata_;
+  std::shared_ptr<Schema> physical_schema_;
+  /// The path of the data file of each row group of metadata_
+  std::vector<std::string> paths_;
+  ParquetFactoryOptions options_;
+};
+
 }  // namespace dataset
 }  // namespace arrow
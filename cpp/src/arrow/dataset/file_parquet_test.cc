@@ -24,6 +24,8 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -31,6 +33,8 @@
 #include "arrow/type_fwd.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
 #include "parquet/metadata.h"
 
 namespace arrow {
@@ -47,7 +51,6 @@ using parquet::default_writer_properties;
 using parquet::WriterProperties;
 
 using parquet::CreateOutputStream;
-using parquet::arrow::FileWriter;
 using parquet::arrow::WriteTable;
 
 using testing::Pointee;
@@ -56,7 +59,7 @@ using internal::checked_pointer_cast;
 
 class ArrowParquetWriterMixin : public ::testing::Test {
  public:
-  Status WriteRecordBatch(const RecordBatch& batch, FileWriter* writer) {
+  Status WriteRecordBatch(const RecordBatch& batch, parquet::arrow::FileWriter* writer) {
     auto schema = batch.schema();
     auto size = batch.num_rows();
 
@@ -74,7 +77,8 @@ class ArrowParquetWriterMixin : public ::testing::Test {
     return Status::OK();
   }
 
-  Status WriteRecordBatchReader(RecordBatchReader* reader, FileWriter* writer) {
+  Status WriteRecordBatchReader(RecordBatchReader* reader,
+                                parquet::arrow::FileWriter* writer) {
     auto schema = reader->schema();
 
     if (!schema->Equals(*writer->schema(), false)) {
@@ -95,9 +99,9 @@ class ArrowParquetWriterMixin : public ::testing::Test {
       const std::shared_ptr<WriterProperties>& properties = default_writer_properties(),
       const std::shared_ptr<ArrowWriterProperties>& arrow_properties =
           default_arrow_writer_properties()) {
-    std::unique_ptr<FileWriter> writer;
-    RETURN_NOT_OK(FileWriter::Open(*reader->schema(), pool, sink, properties,
-                                   arrow_properties, &writer));
+    std::unique_ptr<parquet::arrow::FileWriter> writer;
+    RETURN_NOT_OK(parquet::arrow::FileWriter::Open(
+        *reader->schema(), pool, sink, properties, arrow_properties, &writer));
     RETURN_NOT_OK(WriteRecordBatchReader(reader, writer.get()));
     return writer->Close();
   }
@@ -366,6 +370,29 @@ TEST_F(TestParquetFileFormat, InspectDictEncoded) {
   AssertSchemaEqual(*actual, expected_schema, /* check_metadata = */ false);
 }
 
+TEST_F(TestParquetFileFormat, InspectCachesFooter) {
+  auto reader = GetRecordBatchReader();
+  auto buffer = Write(reader.get());
+
+  auto mockfs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(42)));
+  ASSERT_OK(mockfs->CreateFile("a.parquet", buffer->ToString()));
+  FileSource source("a.parquet", mockfs.get());
+
+  auto cache = std::make_shared<MetadataCache>();
+  format_->reader_options.metadata_cache = cache;
+
+  ASSERT_OK_AND_ASSIGN(auto first, format_->Inspect(source));
+  ASSERT_EQ(cache->stats().misses, 1);
+  ASSERT_EQ(cache->stats().entries, 1);
+
+  ASSERT_OK_AND_ASSIGN(auto second, format_->Inspect(source));
+  ASSERT_OK_AND_ASSIGN(auto supported, format_->IsSupported(source));
+  ASSERT_TRUE(supported);
+  ASSERT_EQ(cache->stats().hits, 2);
+  AssertSchemaEqual(*first, *second);
+}
+
 TEST_F(TestParquetFileFormat, IsSupported) {
   auto reader = GetRecordBatchReader();
   auto source = GetFileSource(reader.get());
@@ -436,6 +463,66 @@ TEST_F(TestParquetFileFormat, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormat, DatasetFromSummaryFile) {
+  constexpr int64_t kNumRowGroups = 4;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto mockfs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(42)));
+  std::vector<std::string> paths = {"part=a/0.parquet", "part=b/0.parquet"};
+  std::vector<std::shared_ptr<parquet::FileMetaData>> footers;
+  for (const auto& path : paths) {
+    auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+    auto buffer = Write(reader.get());
+    ASSERT_OK(mockfs->CreateFile("dataset/" + path, buffer->ToString()));
+    footers.push_back(
+        parquet::ParquetFileReader::Open(std::make_shared<io::BufferReader>(buffer))
+            ->metadata());
+  }
+
+  auto summary = parquet::FileMetaData::MakeSummary(footers, paths);
+  ASSERT_OK_AND_ASSIGN(auto sink, mockfs->OpenOutputStream("dataset/_metadata"));
+  parquet::WriteMetaDataFile(*summary, sink.get());
+  ASSERT_OK(sink->Close());
+
+  ParquetFactoryOptions options;
+  options.partitioning = HivePartitioning::MakeFactory();
+  ASSERT_OK_AND_ASSIGN(auto factory, ParquetDatasetFactory::Make(
+                                         "dataset/_metadata", mockfs, format_, options));
+  ASSERT_OK_AND_ASSIGN(auto dataset, factory->Finish());
+  ASSERT_NE(dataset->schema()->GetFieldByName("part"), nullptr);
+
+  using Counts = std::pair<int64_t, int64_t>;
+  auto CountFragments = [&](std::shared_ptr<Expression> filter) {
+    opts_ = ScanOptions::Make(dataset->schema());
+    opts_->filter = std::move(filter);
+    int64_t rows = 0;
+    FragmentVector fragments;
+    for (auto maybe_fragment : dataset->GetFragments(opts_)) {
+      EXPECT_OK_AND_ASSIGN(auto fragment, std::move(maybe_fragment));
+      auto parquet_fragment = checked_pointer_cast<ParquetFileFragment>(fragment);
+      EXPECT_EQ(parquet_fragment->row_groups().size(), 1);
+      for (auto maybe_batch : Batches(fragment.get())) {
+        EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        rows += batch->num_rows();
+      }
+      fragments.push_back(std::move(fragment));
+    }
+    return Counts(static_cast<int64_t>(fragments.size()), rows);
+  };
+
+  // one fragment per row group of every file
+  ASSERT_EQ(CountFragments(scalar(true)),
+            Counts(2 * kNumRowGroups, 2 * kTotalNumRows));
+  // pruned by partition
+  ASSERT_EQ(CountFragments(("part"_ == "b").Copy()),
+            Counts(kNumRowGroups, kTotalNumRows));
+  // pruned by statistics, without opening the data files
+  ASSERT_EQ(CountFragments(("i64"_ == int64_t(2)).Copy()), Counts(2, 2 + 2));
+  ASSERT_EQ(CountFragments(("part"_ == "a" and "i64"_ >= int64_t(3)).Copy()),
+            Counts(2, 3 + 4));
+}
+
 TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
   constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
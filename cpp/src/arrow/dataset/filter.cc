@@ -34,11 +34,14 @@
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
 #include "arrow/compute/kernels/isin.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/type_fwd.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -68,6 +71,14 @@ bool IsNullDatum(const Datum& datum) {
   return array_data->GetNullCount() == array_data->length;
 }
 
+// Dictionary encoded operands are compared by their decoded values.
+inline std::shared_ptr<DataType> DecodedType(const std::shared_ptr<DataType>& type) {
+  if (type->id() == Type::DICTIONARY) {
+    return checked_cast<const DictionaryType&>(*type).value_type();
+  }
+  return type;
+}
+
 struct Comparison {
   enum type {
     LESS,
@@ -832,7 +843,7 @@ Result<std::shared_ptr<DataType>> ComparisonExpression::Validate(
     return boolean();
   }
 
-  if (!lhs_type->Equals(rhs_type)) {
+  if (!DecodedType(lhs_type)->Equals(DecodedType(rhs_type))) {
     return Status::TypeError("cannot compare expressions of differing type, ", *lhs_type,
                              " vs ", *rhs_type);
   }
@@ -949,12 +960,13 @@ struct InsertImplicitCastsImpl {
   Result<std::shared_ptr<Expression>> operator()(const InExpression& expr) {
     ARROW_ASSIGN_OR_RAISE(auto op, InsertCastsAndValidate(*expr.operand()));
     auto set = expr.set();
+    auto op_type = DecodedType(op.type);
 
-    if (!op.type->Equals(set->type())) {
+    if (!op_type->Equals(set->type())) {
       // cast the set (which we assume to be small) to match op.type
       compute::FunctionContext ctx;
       const auto options = compute::CastOptions::Safe();
-      RETURN_NOT_OK(arrow::compute::Cast(&ctx, *set, op.type, options, &set));
+      RETURN_NOT_OK(arrow::compute::Cast(&ctx, *set, op_type, options, &set));
     }
 
     return std::make_shared<InExpression>(std::move(op.expr), std::move(set));
@@ -999,14 +1011,15 @@ struct InsertImplicitCastsImpl {
     ARROW_ASSIGN_OR_RAISE(auto lhs, InsertCastsAndValidate(*expr.left_operand()));
     ARROW_ASSIGN_OR_RAISE(auto rhs, InsertCastsAndValidate(*expr.right_operand()));
 
-    if (lhs.type->Equals(rhs.type)) {
+    auto lhs_type = DecodedType(lhs.type), rhs_type = DecodedType(rhs.type);
+    if (lhs_type->Equals(rhs_type)) {
       return expr.Copy();
     }
 
     if (lhs.expr->type() == ExpressionType::SCALAR) {
-      ARROW_ASSIGN_OR_RAISE(lhs.expr, Cast(rhs.type, *lhs.expr));
+      ARROW_ASSIGN_OR_RAISE(lhs.expr, Cast(rhs_type, *lhs.expr));
     } else {
-      ARROW_ASSIGN_OR_RAISE(rhs.expr, Cast(lhs.type, *rhs.expr));
+      ARROW_ASSIGN_OR_RAISE(rhs.expr, Cast(lhs_type, *rhs.expr));
     }
     return std::make_shared<ComparisonExpression>(expr.op(), std::move(lhs.expr),
                                                   std::move(rhs.expr));
@@ -1093,6 +1106,457 @@ std::shared_ptr<ExpressionEvaluator> ExpressionEvaluator::Null() {
   return std::make_shared<Impl>();
 }
 
+namespace {
+
+// A compound boolean expression (a tree of AND/OR/NOT over leaf predicates) flattened
+// into a program which is run over the batch one 64-row word at a time.
+//
+// Every intermediate value is a pair of words holding the rows known to be true and
+// the rows known to be false; rows in neither are null. This makes Kleene logic a
+// couple of bitwise operations per word, and allows the right operand of an AND (OR)
+// to be skipped for words in which the left operand is already all false (all true).
+// Comparisons of primitive columns, boolean columns and validity checks are evaluated
+// directly into those words. Other leaves are evaluated up front by the recursive
+// TreeEvaluator.
+class FusedBooleanProgram {
+ public:
+  static bool IsCompound(const Expression& expr) {
+    return expr.type() == ExpressionType::AND || expr.type() == ExpressionType::OR ||
+           expr.type() == ExpressionType::NOT;
+  }
+
+  // Programs are recycled per thread so that, once warm, evaluation only allocates
+  // the output bitmaps. A nested evaluation gets a fresh program.
+  static std::unique_ptr<FusedBooleanProgram> Acquire() {
+    if (recycled_ != nullptr) {
+      return std::move(recycled_);
+    }
+    return std::unique_ptr<FusedBooleanProgram>(new FusedBooleanProgram);
+  }
+
+  static void Release(std::unique_ptr<FusedBooleanProgram> program) {
+    program->instructions_.clear();
+    program->leaves_.clear();
+    program->keep_alive_.clear();
+    recycled_ = std::move(program);
+  }
+
+  Status Compile(const Expression& expr, const RecordBatch& batch,
+                 const TreeEvaluator& evaluator, MemoryPool* pool) {
+    switch (expr.type()) {
+      case ExpressionType::AND:
+      case ExpressionType::OR: {
+        const auto& binary = checked_cast<const BinaryExpression&>(expr);
+        bool is_and = expr.type() == ExpressionType::AND;
+        RETURN_NOT_OK(Compile(*binary.left_operand(), batch, evaluator, pool));
+        size_t skip = instructions_.size();
+        instructions_.push_back({is_and ? SKIP_IF_FALSE : SKIP_IF_TRUE, 0});
+        RETURN_NOT_OK(Compile(*binary.right_operand(), batch, evaluator, pool));
+        instructions_.push_back({is_and ? AND : OR, 0});
+        instructions_[skip].arg = static_cast<int>(instructions_.size());
+        return Status::OK();
+      }
+      case ExpressionType::NOT: {
+        const auto& operand = *checked_cast<const NotExpression&>(expr).operand();
+        RETURN_NOT_OK(Compile(operand, batch, evaluator, pool));
+        instructions_.push_back({NOT, 0});
+        return Status::OK();
+      }
+      default:
+        break;
+    }
+
+    Leaf leaf;
+    RETURN_NOT_OK(MakeLeaf(expr, batch, evaluator, pool, &leaf));
+    instructions_.push_back({LEAF, static_cast<int>(leaves_.size())});
+    leaves_.push_back(leaf);
+    return Status::OK();
+  }
+
+  Result<Datum> Execute(int64_t length, MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(auto values, AllocateBitmap(length, pool));
+    ARROW_ASSIGN_OR_RAISE(auto validity, AllocateBitmap(length, pool));
+    auto values_words = reinterpret_cast<uint64_t*>(values->mutable_data());
+    auto validity_words = reinterpret_cast<uint64_t*>(validity->mutable_data());
+
+    stack_.resize(instructions_.size());
+
+    for (int64_t start = 0; start < length; start += 64) {
+      const int64_t n = std::min<int64_t>(64, length - start);
+      const uint64_t mask = n == 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+
+      Word* top = stack_.data() - 1;
+      for (size_t pc = 0; pc < instructions_.size(); ++pc) {
+        const Instruction& instruction = instructions_[pc];
+        switch (instruction.op) {
+          case LEAF:
+            *++top = leaves_[instruction.arg].Evaluate(start, n, mask);
+            break;
+          case SKIP_IF_FALSE:
+            if (top->false_bits == mask) pc = instruction.arg - 1;
+            break;
+          case SKIP_IF_TRUE:
+            if (top->true_bits == mask) pc = instruction.arg - 1;
+            break;
+          case AND:
+            --top;
+            top->true_bits &= top[1].true_bits;
+            top->false_bits |= top[1].false_bits;
+            break;
+          case OR:
+            --top;
+            top->true_bits |= top[1].true_bits;
+            top->false_bits &= top[1].false_bits;
+            break;
+          case NOT:
+            std::swap(top->true_bits, top->false_bits);
+            break;
+        }
+      }
+
+      values_words[start / 64] = BitUtil::ToLittleEndian(top->true_bits);
+      validity_words[start / 64] =
+          BitUtil::ToLittleEndian(top->true_bits | top->false_bits);
+    }
+
+    int64_t null_count = length - internal::CountSetBits(validity->data(), 0, length);
+    if (null_count == 0) {
+      validity = nullptr;
+    }
+    return Datum(std::make_shared<BooleanArray>(length, std::move(values),
+                                                std::move(validity), null_count));
+  }
+
+ private:
+  FusedBooleanProgram() = default;
+
+  struct Word {
+    uint64_t true_bits, false_bits;
+  };
+
+  enum Opcode { LEAF, SKIP_IF_FALSE, SKIP_IF_TRUE, AND, OR, NOT };
+
+  struct Instruction {
+    Opcode op;
+    // leaf index for LEAF, jump target for SKIP_*
+    int arg;
+  };
+
+  struct Leaf;
+  using CompareWordFn = uint64_t (*)(const Leaf&, int64_t start, int64_t n);
+
+  struct Leaf {
+    // constant leaves
+    bool is_constant = false;
+    uint64_t constant_true = 0, constant_false = 0;
+
+    // comparison leaves: left values, right values or scalar
+    CompareWordFn compare = nullptr;
+    const void* left = nullptr;
+    const void* right = nullptr;
+    uint64_t right_scalar = 0;
+
+    // boolean leaves
+    const uint8_t* bits = nullptr;
+    int64_t bits_offset = 0;
+
+    // rows for which either input is null yield null
+    const uint8_t* validity[2] = {nullptr, nullptr};
+    int64_t validity_offset[2] = {0, 0};
+
+    Word Evaluate(int64_t start, int64_t n, uint64_t mask) const {
+      if (is_constant) {
+        return {constant_true & mask, constant_false & mask};
+      }
+      uint64_t holds = compare != nullptr ? compare(*this, start, n)
+                                          : LoadWord(bits, bits_offset + start, n);
+      uint64_t valid = mask;
+      for (int i = 0; i < 2; ++i) {
+        if (validity[i] != nullptr) {
+          valid &= LoadWord(validity[i], validity_offset[i] + start, n);
+        }
+      }
+      return {holds & valid, ~holds & valid};
+    }
+  };
+
+  // Load n <= 64 bits starting at an arbitrary bit offset; bits past n are garbage.
+  static uint64_t LoadWord(const uint8_t* bitmap, int64_t offset, int64_t n) {
+    const uint8_t* bytes = bitmap + offset / 8;
+    const int shift = static_cast<int>(offset % 8);
+    const int64_t num_bytes = BitUtil::BytesForBits(shift + n);
+
+    uint64_t word = 0;
+    std::memcpy(&word, bytes, static_cast<size_t>(std::min<int64_t>(num_bytes, 8)));
+    word = BitUtil::FromLittleEndian(word);
+    if (shift != 0) {
+      word >>= shift;
+      if (num_bytes > 8) {
+        word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+      }
+    }
+    return word;
+  }
+
+  template <typename CType, typename Op>
+  static uint64_t CompareWord(const Leaf& leaf, int64_t start, int64_t n) {
+    const CType* left = static_cast<const CType*>(leaf.left) + start;
+    uint64_t out = 0;
+    if (leaf.right == nullptr) {
+      CType right;
+      std::memcpy(&right, &leaf.right_scalar, sizeof(CType));
+      for (int64_t i = 0; i < n; ++i) {
+        out |= static_cast<uint64_t>(Op::Call(left[i], right)) << i;
+      }
+    } else {
+      const CType* right = static_cast<const CType*>(leaf.right) + start;
+      for (int64_t i = 0; i < n; ++i) {
+        out |= static_cast<uint64_t>(Op::Call(left[i], right[i])) << i;
+      }
+    }
+    return out;
+  }
+
+  struct Equal {
+    template <typename T>
+    static bool Call(T l, T r) {
+      return l == r;
+    }
+  };
+  struct NotEqual {
+    template <typename T>
+    static bool Call(T l, T r) {
+      return l != r;
+    }
+  };
+  struct Less {
+    template <typename T>
+    static bool Call(T l, T r) {
+      return l < r;
+    }
+  };
+  struct LessEqual {
+    template <typename T>
+    static bool Call(T l, T r) {
+      return l <= r;
+    }
+  };
+  struct Greater {
+    template <typename T>
+    static bool Call(T l, T r) {
+      return l > r;
+    }
+  };
+  struct GreaterEqual {
+    template <typename T>
+    static bool Call(T l, T r) {
+      return l >= r;
+    }
+  };
+
+  template <typename CType>
+  static CompareWordFn GetCompareWord(compute::CompareOperator op) {
+    switch (op) {
+      case compute::CompareOperator::EQUAL:
+        return CompareWord<CType, Equal>;
+      case compute::CompareOperator::NOT_EQUAL:
+        return CompareWord<CType, NotEqual>;
+      case compute::CompareOperator::LESS:
+        return CompareWord<CType, Less>;
+      case compute::CompareOperator::LESS_EQUAL:
+        return CompareWord<CType, LessEqual>;
+      case compute::CompareOperator::GREATER:
+        return CompareWord<CType, Greater>;
+      case compute::CompareOperator::GREATER_EQUAL:
+        return CompareWord<CType, GreaterEqual>;
+    }
+    return nullptr;
+  }
+
+  // Set up a comparison leaf of a column against a column or scalar of ArrowType
+  template <typename ArrowType>
+  static CompareWordFn MakeCompareLeaf(compute::CompareOperator op, const ArrayData& left,
+                                       const Datum& right, Leaf* leaf) {
+    using CType = typename TypeTraits<ArrowType>::CType;
+    using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+    leaf->left = left.GetValues<CType>(1);
+    if (right.is_scalar()) {
+      CType value = checked_cast<const ScalarType&>(*right.scalar()).value;
+      std::memcpy(&leaf->right_scalar, &value, sizeof(CType));
+    } else {
+      leaf->right = right.array()->GetValues<CType>(1);
+    }
+    return GetCompareWord<CType>(op);
+  }
+
+  static CompareWordFn MakeCompareLeaf(compute::CompareOperator op, const ArrayData& left,
+                                       const Datum& right, Leaf* leaf) {
+    switch (left.type->id()) {
+      case Type::INT8:
+        return MakeCompareLeaf<Int8Type>(op, left, right, leaf);
+      case Type::INT16:
+        return MakeCompareLeaf<Int16Type>(op, left, right, leaf);
+      case Type::INT32:
+        return MakeCompareLeaf<Int32Type>(op, left, right, leaf);
+      case Type::INT64:
+        return MakeCompareLeaf<Int64Type>(op, left, right, leaf);
+      case Type::UINT8:
+        return MakeCompareLeaf<UInt8Type>(op, left, right, leaf);
+      case Type::UINT16:
+        return MakeCompareLeaf<UInt16Type>(op, left, right, leaf);
+      case Type::UINT32:
+        return MakeCompareLeaf<UInt32Type>(op, left, right, leaf);
+      case Type::UINT64:
+        return MakeCompareLeaf<UInt64Type>(op, left, right, leaf);
+      case Type::FLOAT:
+        return MakeCompareLeaf<FloatType>(op, left, right, leaf);
+      case Type::DOUBLE:
+        return MakeCompareLeaf<DoubleType>(op, left, right, leaf);
+      case Type::DATE32:
+        return MakeCompareLeaf<Date32Type>(op, left, right, leaf);
+      case Type::DATE64:
+        return MakeCompareLeaf<Date64Type>(op, left, right, leaf);
+      case Type::TIMESTAMP:
+        return MakeCompareLeaf<TimestampType>(op, left, right, leaf);
+      default:
+        break;
+    }
+    return nullptr;
+  }
+
+  static void SetValidity(const ArrayData& array, int i, Leaf* leaf) {
+    if (array.GetNullCount() != 0) {
+      leaf->validity[i] = array.buffers[0]->data();
+      leaf->validity_offset[i] = array.offset;
+    }
+  }
+
+  static void SetConstant(const Scalar& scalar, Leaf* leaf) {
+    leaf->is_constant = true;
+    if (scalar.is_valid) {
+      bool value = checked_cast<const BooleanScalar&>(scalar).value;
+      leaf->constant_true = value ? ~uint64_t(0) : 0;
+      leaf->constant_false = ~leaf->constant_true;
+    }
+  }
+
+  // Try to evaluate expr directly; return false if it must be precomputed.
+  bool MakeDirectLeaf(const Expression& expr, const RecordBatch& batch, Leaf* leaf) {
+    if (expr.type() == ExpressionType::COMPARISON) {
+      const auto& comparison = checked_cast<const ComparisonExpression&>(expr);
+      if (comparison.left_operand()->type() != ExpressionType::FIELD) {
+        return false;
+      }
+      const auto& name =
+          checked_cast<const FieldExpression&>(*comparison.left_operand()).name();
+      auto left = batch.GetColumnByName(name);
+
+      Datum right;
+      const auto& right_operand = *comparison.right_operand();
+      if (right_operand.type() == ExpressionType::SCALAR) {
+        right = checked_cast<const ScalarExpression&>(right_operand).value();
+        if (!right.scalar()->is_valid) return false;
+      } else if (right_operand.type() == ExpressionType::FIELD) {
+        const auto& right_field = checked_cast<const FieldExpression&>(right_operand);
+        auto right_column = batch.GetColumnByName(right_field.name());
+        if (right_column == nullptr) return false;
+        right = std::move(right_column);
+      } else {
+        return false;
+      }
+
+      if (left == nullptr || !left->type()->Equals(*right.type())) {
+        return false;
+      }
+
+      leaf->compare = MakeCompareLeaf(comparison.op(), *left->data(), right, leaf);
+      if (leaf->compare == nullptr) {
+        return false;
+      }
+      SetValidity(*left->data(), 0, leaf);
+      if (right.is_array()) {
+        SetValidity(*right.array(), 1, leaf);
+      }
+      keep_alive_.emplace_back(left);
+      keep_alive_.push_back(std::move(right));
+      return true;
+    }
+
+    if (expr.type() == ExpressionType::IS_VALID) {
+      const auto& operand = *checked_cast<const IsValidExpression&>(expr).operand();
+      if (operand.type() != ExpressionType::FIELD) {
+        return false;
+      }
+      const auto& name = checked_cast<const FieldExpression&>(operand).name();
+      auto column = batch.GetColumnByName(name);
+      if (column == nullptr) {
+        return false;
+      }
+      if (column->null_count() == 0) {
+        SetConstant(BooleanScalar(true), leaf);
+      } else {
+        leaf->bits = column->null_bitmap_data();
+        leaf->bits_offset = column->offset();
+        keep_alive_.emplace_back(std::move(column));
+      }
+      return true;
+    }
+
+    if (expr.type() == ExpressionType::FIELD) {
+      const auto& name = checked_cast<const FieldExpression&>(expr).name();
+      auto column = batch.GetColumnByName(name);
+      if (column == nullptr || column->type_id() != Type::BOOL) {
+        return false;
+      }
+      leaf->bits = column->data()->buffers[1]->data();
+      leaf->bits_offset = column->offset();
+      SetValidity(*column->data(), 0, leaf);
+      keep_alive_.emplace_back(std::move(column));
+      return true;
+    }
+
+    return false;
+  }
+
+  Status MakeLeaf(const Expression& expr, const RecordBatch& batch,
+                  const TreeEvaluator& evaluator, MemoryPool* pool, Leaf* leaf) {
+    if (MakeDirectLeaf(expr, batch, leaf)) {
+      return Status::OK();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto result, evaluator.Evaluate(expr, batch, pool));
+    if (result.is_scalar()) {
+      if (result.scalar()->is_valid && result.type()->id() != Type::BOOL) {
+        return Status::TypeError("expected a boolean operand, got ", *result.type());
+      }
+      SetConstant(*result.scalar(), leaf);
+      return Status::OK();
+    }
+
+    if (!result.is_array() || result.type()->id() != Type::BOOL) {
+      return Status::TypeError("expected a boolean operand, got ", *result.type());
+    }
+    const auto& data = *result.array();
+    leaf->bits = data.buffers[1]->data();
+    leaf->bits_offset = data.offset;
+    SetValidity(data, 0, leaf);
+    keep_alive_.push_back(std::move(result));
+    return Status::OK();
+  }
+
+  std::vector<Instruction> instructions_;
+  std::vector<Leaf> leaves_;
+  std::vector<Word> stack_;
+  std::vector<Datum> keep_alive_;
+
+  static thread_local std::unique_ptr<FusedBooleanProgram> recycled_;
+};
+
+thread_local std::unique_ptr<FusedBooleanProgram> FusedBooleanProgram::recycled_;
+
+}  // namespace
+
 struct TreeEvaluator::Impl {
   Result<Datum> operator()(const ScalarExpression& expr) const {
     return Datum(expr.value());
@@ -1165,9 +1629,9 @@ struct TreeEvaluator::Impl {
     }
 
     DCHECK(operand_values.is_array());
-    Datum out;
-    RETURN_NOT_OK(arrow::compute::IsIn(&ctx_, operand_values, expr.set(), &out));
-    return std::move(out);
+    return EvaluateDecoded(operand_values, [&](const Datum& values, Datum* out) {
+      return arrow::compute::IsIn(&ctx_, values, expr.set(), out);
+    });
   }
 
   Result<Datum> operator()(const IsValidExpression& expr) const {
@@ -1185,8 +1649,9 @@ struct TreeEvaluator::Impl {
       return Datum(true);
     }
 
-    return Datum(std::make_shared<BooleanArray>(operand_values.array()->length,
-                                                operand_values.array()->buffers[0]));
+    return Datum(std::make_shared<BooleanArray>(
+        operand_values.array()->length, operand_values.array()->buffers[0],
+        /*null_bitmap=*/nullptr, /*null_count=*/0, operand_values.array()->offset));
   }
 
   Result<Datum> operator()(const CastExpression& expr) const {
@@ -1213,10 +1678,46 @@ struct TreeEvaluator::Impl {
 
     DCHECK(lhs.is_array());
 
+    if (rhs.is_array()) {
+      // comparisons between two arrays are evaluated on decoded values
+      RETURN_NOT_OK(Decode(&lhs));
+      RETURN_NOT_OK(Decode(&rhs));
+    }
+
+    return EvaluateDecoded(lhs, [&](const Datum& values, Datum* out) {
+      return arrow::compute::Compare(&ctx_, values, rhs,
+                                     arrow::compute::CompareOptions(expr.op()), out);
+    });
+  }
+
+  Status Decode(Datum* values) const {
+    if (values->type()->id() != Type::DICTIONARY) {
+      return Status::OK();
+    }
+    Datum decoded;
+    RETURN_NOT_OK(arrow::compute::Cast(&ctx_, *values, DecodedType(values->type()),
+                                       compute::CastOptions::Safe(), &decoded));
+    *values = std::move(decoded);
+    return Status::OK();
+  }
+
+  // Apply a kernel with one array operand. If that operand is dictionary encoded (as
+  // are partition columns whose dictionary holds a single value) the kernel is applied
+  // to the dictionary only and its result is expanded with the indices.
+  template <typename Kernel>
+  Result<Datum> EvaluateDecoded(const Datum& values, Kernel&& kernel) const {
     Datum out;
-    RETURN_NOT_OK(arrow::compute::Compare(
-        &ctx_, lhs, rhs, arrow::compute::CompareOptions(expr.op()), &out));
-    return std::move(out);
+    if (values.type()->id() != Type::DICTIONARY) {
+      RETURN_NOT_OK(kernel(values, &out));
+      return std::move(out);
+    }
+
+    DictionaryArray dict_array(values.array());
+    RETURN_NOT_OK(kernel(Datum(dict_array.dictionary()), &out));
+    std::shared_ptr<Array> expanded;
+    RETURN_NOT_OK(arrow::compute::Take(&ctx_, *out.make_array(), *dict_array.indices(),
+                                       compute::TakeOptions(), &expanded));
+    return Datum(std::move(expanded));
   }
 
   Result<Datum> operator()(const Expression& expr) const {
@@ -1234,6 +1735,15 @@ struct TreeEvaluator::Impl {
 
 Result<Datum> TreeEvaluator::Evaluate(const Expression& expr, const RecordBatch& batch,
                                       MemoryPool* pool) const {
+  if (fuse_boolean_expressions_ && FusedBooleanProgram::IsCompound(expr) &&
+      batch.num_rows() > 0) {
+    auto program = FusedBooleanProgram::Acquire();
+    RETURN_NOT_OK(program->Compile(expr, batch, *this, pool));
+    auto result = program->Execute(batch.num_rows(), pool);
+    FusedBooleanProgram::Release(std::move(program));
+    return result;
+  }
+
   return VisitExpression(expr, Impl{this, batch, compute::FunctionContext{pool}});
 }
 
@@ -569,6 +569,11 @@ class ARROW_DS_EXPORT ExpressionEvaluator {
   /// An return value of SCALAR kind is equivalent to an array of the same type whose
   /// slots contain a single repeated value.
   ///
+  /// An evaluator may instead return the result of a boolean expression as a
+  /// selection vector: an array of unsigned integer indices of the rows for which
+  /// the expression is true. Such a Datum is only meaningful to that evaluator's
+  /// Filter().
+  ///
   /// expr must be validated against the schema of batch before calling this method.
   virtual Result<compute::Datum> Evaluate(const Expression& expr,
                                           const RecordBatch& batch,
@@ -603,8 +608,15 @@ class ARROW_DS_EXPORT ExpressionEvaluator {
 
 /// construct an Evaluator which uses compute kernels to evaluate expressions and
 /// filter record batches in depth first order
+///
+/// Unless disabled, compound boolean expressions (AND/OR/NOT) are instead compiled
+/// into a flat program of bitmap operations which computes the result in a single
+/// pass over the batch without materializing intermediate arrays.
 class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
  public:
+  explicit TreeEvaluator(bool fuse_boolean_expressions = true)
+      : fuse_boolean_expressions_(fuse_boolean_expressions) {}
+
   Result<compute::Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
                                   MemoryPool* pool) const override;
 
@@ -614,6 +626,8 @@ class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
 
  protected:
   struct Impl;
+
+  bool fuse_boolean_expressions_;
 };
 
 }  // namespace dataset
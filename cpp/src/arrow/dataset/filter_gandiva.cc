@@ -0,0 +1,393 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/filter_gandiva.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace arrow {
+namespace dataset {
+
+using compute::Datum;
+using gandiva::NodePtr;
+using gandiva::TreeExprBuilder;
+using internal::checked_cast;
+
+constexpr size_t GandivaEvaluator::kMaxCacheSize;
+
+namespace {
+
+Status Unsupported(const Expression& expr) {
+  return Status::NotImplemented("translation of ", expr.ToString(), " to gandiva");
+}
+
+// Translate an Expression into a Gandiva expression tree. NotImplemented is returned
+// for any subexpression without a Gandiva equivalent.
+struct ToGandivaNode {
+  Result<NodePtr> operator()(const FieldExpression& expr) const {
+    auto field = schema_.GetFieldByName(expr.name());
+    if (field == nullptr) {
+      return Unsupported(expr);
+    }
+    return TreeExprBuilder::MakeField(std::move(field));
+  }
+
+  Result<NodePtr> operator()(const ScalarExpression& expr) const {
+    return MakeLiteral(expr, *expr.value());
+  }
+
+  Result<NodePtr> operator()(const AndExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto lhs, Translate(*expr.left_operand()));
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Translate(*expr.right_operand()));
+    return TreeExprBuilder::MakeAnd({std::move(lhs), std::move(rhs)});
+  }
+
+  Result<NodePtr> operator()(const OrExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto lhs, Translate(*expr.left_operand()));
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Translate(*expr.right_operand()));
+    return TreeExprBuilder::MakeOr({std::move(lhs), std::move(rhs)});
+  }
+
+  Result<NodePtr> operator()(const NotExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    return TreeExprBuilder::MakeFunction("not", {std::move(operand)}, boolean());
+  }
+
+  Result<NodePtr> operator()(const IsValidExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    return TreeExprBuilder::MakeFunction("isnotnull", {std::move(operand)}, boolean());
+  }
+
+  Result<NodePtr> operator()(const ComparisonExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto lhs, Translate(*expr.left_operand()));
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Translate(*expr.right_operand()));
+
+    std::string function;
+    switch (expr.op()) {
+      case compute::CompareOperator::EQUAL:
+        function = "equal";
+        break;
+      case compute::CompareOperator::NOT_EQUAL:
+        function = "not_equal";
+        break;
+      case compute::CompareOperator::LESS:
+        function = "less_than";
+        break;
+      case compute::CompareOperator::LESS_EQUAL:
+        function = "less_than_or_equal_to";
+        break;
+      case compute::CompareOperator::GREATER:
+        function = "greater_than";
+        break;
+      case compute::CompareOperator::GREATER_EQUAL:
+        function = "greater_than_or_equal_to";
+        break;
+    }
+    return TreeExprBuilder::MakeFunction(function, {std::move(lhs), std::move(rhs)},
+                                         boolean());
+  }
+
+  Result<NodePtr> operator()(const InExpression& expr) const {
+    const auto& set = *expr.set();
+    if (set.null_count() != 0) {
+      return Unsupported(expr);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    switch (set.type_id()) {
+      case Type::INT32: {
+        const auto& values = checked_cast<const Int32Array&>(set);
+        std::unordered_set<int32_t> constants(values.raw_values(),
+                                              values.raw_values() + values.length());
+        return TreeExprBuilder::MakeInExpressionInt32(std::move(operand), constants);
+      }
+      case Type::INT64: {
+        const auto& values = checked_cast<const Int64Array&>(set);
+        std::unordered_set<int64_t> constants(values.raw_values(),
+                                              values.raw_values() + values.length());
+        return TreeExprBuilder::MakeInExpressionInt64(std::move(operand), constants);
+      }
+      case Type::STRING: {
+        const auto& values = checked_cast<const StringArray&>(set);
+        std::unordered_set<std::string> constants;
+        for (int64_t i = 0; i < values.length(); ++i) {
+          constants.insert(values.GetString(i));
+        }
+        return TreeExprBuilder::MakeInExpressionString(std::move(operand), constants);
+      }
+      default:
+        break;
+    }
+    return Unsupported(expr);
+  }
+
+  Result<NodePtr> operator()(const CastExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto to_type, expr.Validate(schema_));
+
+    if (expr.operand()->type() == ExpressionType::SCALAR) {
+      // fold casts of literals, as inserted by InsertImplicitCasts
+      const auto& value = *checked_cast<const ScalarExpression&>(*expr.operand()).value();
+      ARROW_ASSIGN_OR_RAISE(auto cast_value, value.CastTo(to_type));
+      return MakeLiteral(expr, *cast_value);
+    }
+
+    std::string function;
+    switch (to_type->id()) {
+      case Type::INT32:
+        function = "castINT";
+        break;
+      case Type::INT64:
+        function = "castBIGINT";
+        break;
+      case Type::FLOAT:
+        function = "castFLOAT4";
+        break;
+      case Type::DOUBLE:
+        function = "castFLOAT8";
+        break;
+      default:
+        return Unsupported(expr);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    return TreeExprBuilder::MakeFunction(function, {std::move(operand)}, to_type);
+  }
+
+  Result<NodePtr> operator()(const Expression& expr) const { return Unsupported(expr); }
+
+  template <typename T>
+  static NodePtr MakePrimitiveLiteral(const Scalar& value) {
+    using ScalarType = typename TypeTraits<T>::ScalarType;
+    return TreeExprBuilder::MakeLiteral(checked_cast<const ScalarType&>(value).value);
+  }
+
+  Result<NodePtr> MakeLiteral(const Expression& expr, const Scalar& value) const {
+    if (!value.is_valid) {
+      return TreeExprBuilder::MakeNull(value.type);
+    }
+
+    switch (value.type->id()) {
+      case Type::BOOL:
+        return MakePrimitiveLiteral<BooleanType>(value);
+      case Type::INT8:
+        return MakePrimitiveLiteral<Int8Type>(value);
+      case Type::INT16:
+        return MakePrimitiveLiteral<Int16Type>(value);
+      case Type::INT32:
+        return MakePrimitiveLiteral<Int32Type>(value);
+      case Type::INT64:
+        return MakePrimitiveLiteral<Int64Type>(value);
+      case Type::UINT8:
+        return MakePrimitiveLiteral<UInt8Type>(value);
+      case Type::UINT16:
+        return MakePrimitiveLiteral<UInt16Type>(value);
+      case Type::UINT32:
+        return MakePrimitiveLiteral<UInt32Type>(value);
+      case Type::UINT64:
+        return MakePrimitiveLiteral<UInt64Type>(value);
+      case Type::FLOAT:
+        return MakePrimitiveLiteral<FloatType>(value);
+      case Type::DOUBLE:
+        return MakePrimitiveLiteral<DoubleType>(value);
+      case Type::STRING:
+        return TreeExprBuilder::MakeStringLiteral(
+            checked_cast<const StringScalar&>(value).value->ToString());
+      case Type::BINARY:
+        return TreeExprBuilder::MakeBinaryLiteral(
+            checked_cast<const BinaryScalar&>(value).value->ToString());
+      default:
+        break;
+    }
+    return Unsupported(expr);
+  }
+
+  Result<NodePtr> Translate(const Expression& expr) const {
+    return VisitExpression(expr, *this);
+  }
+
+  const Schema& schema_;
+};
+
+// Append the types of the constants in an expression to a cache key. ToString()
+// doesn't spell out all of them (the type of an IN set, for example), and constants
+// of differing types compile to different code.
+struct AppendConstantTypes {
+  void operator()(const ScalarExpression& expr) const { Append(*expr.value()->type); }
+
+  void operator()(const InExpression& expr) const {
+    Append(*expr.set()->type());
+    VisitExpression(*expr.operand(), *this);
+  }
+
+  void operator()(const CastExpression& expr) const {
+    VisitExpression(*expr.operand(), *this);
+    if (expr.like_expr() != nullptr) {
+      VisitExpression(*expr.like_expr(), *this);
+    }
+  }
+
+  void operator()(const UnaryExpression& expr) const {
+    VisitExpression(*expr.operand(), *this);
+  }
+
+  void operator()(const BinaryExpression& expr) const {
+    VisitExpression(*expr.left_operand(), *this);
+    VisitExpression(*expr.right_operand(), *this);
+  }
+
+  void operator()(const Expression&) const {}
+
+  void Append(const DataType& type) const {
+    *out_ += "\n";
+    *out_ += type.ToString();
+  }
+
+  std::string* out_;
+};
+
+}  // namespace
+
+GandivaEvaluator::GandivaEvaluator() = default;
+
+GandivaEvaluator::~GandivaEvaluator() = default;
+
+Result<GandivaEvaluator::Compiled> GandivaEvaluator::GetCompiled(
+    const Expression& expr, const std::shared_ptr<Schema>& schema) const {
+  auto key = schema->fingerprint();
+  if (key.empty()) {
+    key = schema->ToString();
+  }
+  key += "\n" + expr.ToString();
+  VisitExpression(expr, AppendConstantTypes{&key});
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+      return it->second;
+    }
+  }
+
+  // Compile outside the lock; concurrent misses on the same key are benign
+  ARROW_ASSIGN_OR_RAISE(auto type, expr.Validate(*schema));
+
+  Compiled compiled;
+  auto maybe_root = VisitExpression(expr, ToGandivaNode{*schema});
+  if (maybe_root.ok()) {
+    auto root = std::move(maybe_root).ValueOrDie();
+    // Expressions which Gandiva fails to compile are left to the fallback evaluator
+    if (type->id() == Type::BOOL) {
+      auto condition = TreeExprBuilder::MakeCondition(std::move(root));
+      if (!gandiva::Filter::Make(schema, std::move(condition), &compiled.filter).ok()) {
+        compiled.filter = nullptr;
+      }
+    } else {
+      auto expression =
+          TreeExprBuilder::MakeExpression(std::move(root), field("out", type));
+      if (!gandiva::Projector::Make(schema, {std::move(expression)}, &compiled.projector)
+               .ok()) {
+        compiled.projector = nullptr;
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (cache_.size() >= kMaxCacheSize) {
+    cache_.clear();
+  }
+  cache_.emplace(std::move(key), compiled);
+  return compiled;
+}
+
+Result<Datum> GandivaEvaluator::Evaluate(const Expression& expr,
+                                         const RecordBatch& batch,
+                                         MemoryPool* pool) const {
+  if (expr.type() == ExpressionType::SCALAR || expr.type() == ExpressionType::FIELD ||
+      batch.num_rows() == 0) {
+    // nothing to compile
+    return fallback_.Evaluate(expr, batch, pool);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto compiled, GetCompiled(expr, batch.schema()));
+
+  if (compiled.filter != nullptr) {
+    std::shared_ptr<gandiva::SelectionVector> selection;
+    if (batch.num_rows() <= std::numeric_limits<uint16_t>::max()) {
+      RETURN_NOT_OK(gandiva::SelectionVector::MakeInt16(batch.num_rows(), pool,
+                                                        &selection));
+    } else {
+      RETURN_NOT_OK(gandiva::SelectionVector::MakeInt32(batch.num_rows(), pool,
+                                                        &selection));
+    }
+    RETURN_NOT_OK(compiled.filter->Evaluate(batch, selection));
+    return Datum(selection->ToArray());
+  }
+
+  if (compiled.projector != nullptr) {
+    ArrayVector out;
+    RETURN_NOT_OK(compiled.projector->Evaluate(batch, pool, &out));
+    return Datum(std::move(out[0]));
+  }
+
+  return fallback_.Evaluate(expr, batch, pool);
+}
+
+Result<std::shared_ptr<RecordBatch>> GandivaEvaluator::Filter(
+    const Datum& selection, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  if (!selection.is_array() || (selection.type()->id() != Type::UINT16 &&
+                                selection.type()->id() != Type::UINT32)) {
+    return fallback_.Filter(selection, batch, pool);
+  }
+
+  // selection vectors hold strictly increasing row indices
+  if (selection.length() == batch->num_rows()) {
+    return batch;
+  }
+  if (selection.length() == 0) {
+    return batch->Slice(0, 0);
+  }
+
+  compute::FunctionContext ctx{pool};
+  std::shared_ptr<RecordBatch> out;
+  RETURN_NOT_OK(
+      compute::Take(&ctx, *batch, *selection.make_array(), compute::TakeOptions{}, &out));
+  return out;
+}
+
+}  // namespace dataset
+}  // namespace arrow
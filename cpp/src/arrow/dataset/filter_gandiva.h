@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+
+namespace gandiva {
+class Filter;
+class Projector;
+}  // namespace gandiva
+
+namespace arrow {
+namespace dataset {
+
+/// construct an Evaluator which compiles expressions to native code with Gandiva
+///
+/// Boolean expressions are compiled into a gandiva::Filter; Evaluate() then returns
+/// a selection vector (an array of unsigned integer indices of the matching rows)
+/// rather than a BooleanArray, which Filter() turns into the filtered batch with
+/// a single Take. Other expressions are compiled into a single-output
+/// gandiva::Projector. Compiled objects are cached per (schema, expression), the key
+/// including the types of the expression's literals and sets.
+///
+/// Translation is all or nothing: if any subexpression cannot be handled by Gandiva
+/// (for example a CustomExpression, or a comparison between differing types) the
+/// whole expression is evaluated by a TreeEvaluator.
+class ARROW_DS_EXPORT GandivaEvaluator : public ExpressionEvaluator {
+ public:
+  GandivaEvaluator();
+  ~GandivaEvaluator() override;
+
+  Result<compute::Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
+                                  MemoryPool* pool) const override;
+
+  Result<std::shared_ptr<RecordBatch>> Filter(const compute::Datum& selection,
+                                              const std::shared_ptr<RecordBatch>& batch,
+                                              MemoryPool* pool) const override;
+
+  /// The maximum number of compiled expressions to cache.
+  static constexpr size_t kMaxCacheSize = 256;
+
+ private:
+  struct Compiled {
+    std::shared_ptr<gandiva::Filter> filter;
+    std::shared_ptr<gandiva::Projector> projector;
+  };
+
+  Result<Compiled> GetCompiled(const Expression& expr,
+                               const std::shared_ptr<Schema>& schema) const;
+
+  TreeEvaluator fallback_;
+
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<std::string, Compiled> cache_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
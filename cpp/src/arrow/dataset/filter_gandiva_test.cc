@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/filter_gandiva.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+using compute::Datum;
+using string_literals::operator"" _;
+
+class GandivaEvaluatorTest : public ::testing::Test {
+ public:
+  // Assert that filtering with a GandivaEvaluator yields the same rows as filtering
+  // with a TreeEvaluator
+  void AssertFilter(const Expression& expr, std::vector<std::shared_ptr<Field>> fields,
+                    const std::string& batch_json) {
+    auto batch = RecordBatchFromJSON(schema(std::move(fields)), batch_json);
+
+    ASSERT_OK_AND_ASSIGN(auto expected_selection, tree_->Evaluate(expr, *batch));
+    ASSERT_OK_AND_ASSIGN(auto expected, tree_->Filter(expected_selection, batch));
+
+    // evaluate twice to exercise the cache of compiled expressions
+    for (int i = 0; i < 2; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto selection, gandiva_->Evaluate(expr, *batch));
+      ASSERT_OK_AND_ASSIGN(auto actual, gandiva_->Filter(selection, batch));
+      AssertBatchesEqual(*expected, *actual);
+    }
+  }
+
+ protected:
+  std::shared_ptr<ExpressionEvaluator> tree_ = std::make_shared<TreeEvaluator>();
+  std::shared_ptr<ExpressionEvaluator> gandiva_ = std::make_shared<GandivaEvaluator>();
+};
+
+TEST_F(GandivaEvaluatorTest, Basics) {
+  AssertFilter("a"_ == 0 and "b"_ > 0.0 and "b"_ < 1.0,
+               {field("a", int32()), field("b", float64())}, R"([
+      {"a": 0, "b": -0.1},
+      {"a": 0, "b":  0.3},
+      {"a": 1, "b":  0.2},
+      {"a": 2, "b": -0.1},
+      {"a": 0, "b":  0.1},
+      {"a": 0, "b": null},
+      {"a": 0, "b":  1.0}
+  ])");
+
+  AssertFilter("a"_ != 0 or not("b"_ > 0.1), {field("a", int32()), field("b", float64())},
+               R"([
+      {"a": 0, "b": -0.1},
+      {"a": 0, "b":  0.3},
+      {"a": 1, "b":  0.2},
+      {"a": 2, "b": -0.1},
+      {"a": 0, "b":  0.1},
+      {"a": 0, "b": null},
+      {"a": 0, "b":  1.0}
+  ])");
+}
+
+TEST_F(GandivaEvaluatorTest, ReturnsSelectionVector) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32())}), R"([
+      {"a": 0}, {"a": 3}, {"a": 1}, {"a": 5}
+  ])");
+
+  ASSERT_OK_AND_ASSIGN(auto selection, gandiva_->Evaluate("a"_ > 1, *batch));
+  ASSERT_TRUE(selection.is_array());
+  AssertArraysEqual(*ArrayFromJSON(uint16(), "[1, 3]"), *selection.make_array());
+}
+
+TEST_F(GandivaEvaluatorTest, Strings) {
+  AssertFilter("s"_ == "hello" or "s"_.In(ArrayFromJSON(utf8(), R"(["world"])")),
+               {field("s", utf8())}, R"([
+      {"s": "hello"},
+      {"s": "world"},
+      {"s": ""},
+      {"s": null},
+      {"s": "foo"},
+      {"s": "hello"}
+  ])");
+}
+
+TEST_F(GandivaEvaluatorTest, IsValidExpression) {
+  AssertFilter("s"_.IsValid(), {field("s", utf8())}, R"([
+      {"s": "hello"},
+      {"s": null},
+      {"s": ""},
+      {"s": null}
+  ])");
+}
+
+TEST_F(GandivaEvaluatorTest, FallbackToTreeEvaluator) {
+  // no gandiva equivalent for an absent field or an IN over doubles
+  AssertFilter("absent"_ == 0 or "b"_.In(ArrayFromJSON(float64(), "[0.5]")),
+               {field("b", float64())}, R"([
+      {"b": 0.5},
+      {"b": null},
+      {"b": 1.5}
+  ])");
+
+  AssertFilter(*scalar(true), {field("b", float64())}, R"([
+      {"b": 0.5},
+      {"b": null}
+  ])");
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -32,6 +32,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/checked_cast.h"
@@ -283,6 +284,30 @@ TEST_F(FilterTest, InExpression) {
   ])");
 }
 
+TEST_F(FilterTest, DictionaryEncodedOperand) {
+  // dictionary encoded columns (such as partition columns) are compared by value
+  auto type = dictionary(int32(), utf8());
+  auto indices = ArrayFromJSON(int32(), "[0, 1, null, 0, 2]");
+  auto dictionary = ArrayFromJSON(utf8(), R"(["hello", "world", ""])");
+  ASSERT_OK_AND_ASSIGN(auto s, DictionaryArray::FromArrays(type, indices, dictionary));
+  auto batch = RecordBatch::Make(schema({field("s", type)}), 5, {s});
+
+  ASSERT_OK_AND_ASSIGN(auto expr_type, ("s"_ == "hello").Validate(*batch->schema()));
+  ASSERT_TRUE(expr_type->Equals(boolean()));
+
+  ASSERT_OK_AND_ASSIGN(auto mask, evaluator_->Evaluate("s"_ == "hello", *batch));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[1, 0, null, 1, 0]"), *mask.make_array());
+
+  auto in_expr = "s"_.In(ArrayFromJSON(utf8(), R"(["world", ""])"));
+  ASSERT_OK_AND_ASSIGN(auto in, InsertImplicitCasts(in_expr, *batch->schema()));
+  ASSERT_OK_AND_ASSIGN(mask, evaluator_->Evaluate(*in, *batch));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[0, 1, null, 0, 1]"), *mask.make_array());
+
+  ASSERT_OK_AND_ASSIGN(mask, evaluator_->Evaluate("s"_ == "hello" or "s"_ == "world",
+                                                  *batch));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[1, 1, null, 1, 0]"), *mask.make_array());
+}
+
 TEST_F(FilterTest, IsValidExpression) {
   AssertFilter("s"_.IsValid(), {field("s", utf8())}, R"([
       {"s": "hello", "in": 1},
@@ -523,6 +548,51 @@ TEST_F(FilterTest, EvaluateTakeExpression) {
   ])");
 }
 
+TEST_F(FilterTest, FusedMatchesRecursive) {
+  constexpr int64_t kLength = 1000;
+  random::RandomArrayGenerator rng(0x5eed);
+  auto batch = RecordBatch::Make(
+      schema({field("i32", int32()), field("f64", float64()), field("b", boolean()),
+              field("s", utf8())}),
+      kLength,
+      {rng.Int32(kLength, 0, 10, 0.1), rng.Float64(kLength, 0, 1, 0.1),
+       rng.Boolean(kLength, 0.5, 0.1), rng.String(kLength, 0, 2, 0.1)});
+
+  TreeEvaluator fused, recursive(/*fuse_boolean_expressions=*/false);
+  std::shared_ptr<Array> i32_set;
+  ArrayFromVector<Int32Type, int32_t>({1, 4, 7}, &i32_set);
+
+  std::vector<std::shared_ptr<Expression>> exprs = {
+      ("i32"_ > 3 and "f64"_ < 0.5).Copy(),
+      ("i32"_ == 2 or not "b"_).Copy(),
+      (("i32"_ < 9 and "f64"_ >= 0.1) or ("s"_ == "a" and "i32"_ != 0)).Copy(),
+      (not("i32"_ == "i32"_) or "f64"_.IsValid()).Copy(),
+      ("absent"_ == 1 or "i32"_ <= 5).Copy(),
+      ("i32"_.In(i32_set) and not("f64"_ > 0.25)).Copy(),
+      (*scalar(true) and "b"_).Copy(),
+      (*scalar(false) or "i32"_ > 100).Copy(),
+  };
+
+  for (const auto& expr : exprs) {
+    for (int64_t offset : {0, 3, 64, 999}) {
+      SCOPED_TRACE(expr->ToString() + " at offset " + std::to_string(offset));
+      auto sliced = batch->Slice(offset);
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           recursive.Evaluate(*expr, *sliced, default_memory_pool()));
+      ASSERT_OK_AND_ASSIGN(auto actual,
+                           fused.Evaluate(*expr, *sliced, default_memory_pool()));
+      ASSERT_TRUE(actual.is_array());
+
+      if (expected.is_scalar()) {
+        ASSERT_OK_AND_ASSIGN(auto expected_array,
+                             MakeArrayFromScalar(*expected.scalar(), sliced->num_rows()));
+        expected = Datum(expected_array);
+      }
+      ASSERT_ARRAYS_EQUAL(*expected.make_array(), *actual.make_array());
+    }
+  }
+}
+
 void AssertFieldsInExpression(std::shared_ptr<Expression> expr,
                               std::vector<std::string> expected) {
   EXPECT_THAT(FieldsInExpression(expr), testing::ContainerEq(expected));
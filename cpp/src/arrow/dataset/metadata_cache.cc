@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/metadata_cache.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "arrow/dataset/file_base.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t MetadataCache::kDefaultCapacity;
+
+util::optional<MetadataCache::Key> MetadataCache::Key::Make(
+    const fs::FileSystem& filesystem, const fs::FileInfo& info,
+    const std::string& kind) {
+  if (!info.IsFile() || info.size() == fs::kNoSize || info.mtime() == fs::kNoTime) {
+    return util::nullopt;
+  }
+
+  // NUL cannot occur in paths, so the fields can't run into each other. The
+  // filesystem is identified by the store it accesses rather than by instance,
+  // so that equal filesystems made for successive queries share entries.
+  std::string repr = filesystem.identity();
+  repr += '\0';
+  repr += info.path();
+  repr += '\0';
+  repr += std::to_string(info.size());
+  repr += '\0';
+  repr += std::to_string(info.mtime().time_since_epoch().count());
+  repr += '\0';
+  repr += kind;
+  return Key(std::move(repr));
+}
+
+Result<util::optional<MetadataCache::Key>> MetadataCache::Key::Make(
+    const FileSource& source, const std::string& kind) {
+  if (source.type() != FileSource::PATH || source.filesystem() == nullptr) {
+    return util::optional<Key>();
+  }
+  if (source.info().type() != fs::FileType::Unknown) {
+    // The FileInfo was given by the caller: don't look the file up, even if
+    // the info lacks a size or modification time
+    return Make(*source.filesystem(), source.info(), kind);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto info, source.filesystem()->GetFileInfo(source.path()));
+  return Make(*source.filesystem(), info, kind);
+}
+
+MetadataCache::MetadataCache(int64_t capacity) : capacity_(capacity) {}
+
+const std::shared_ptr<MetadataCache>& MetadataCache::Default() {
+  static std::shared_ptr<MetadataCache> cache = std::make_shared<MetadataCache>();
+  return cache;
+}
+
+std::shared_ptr<void> MetadataCache::GetImpl(const Key& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key.ToString());
+  if (it == index_.end()) {
+    ++stats_.misses;
+    return nullptr;
+  }
+
+  ++stats_.hits;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->value;
+}
+
+void MetadataCache::PutImpl(const Key& key, std::shared_ptr<void> value, int64_t size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key.ToString());
+  if (it != index_.end()) {
+    stats_.size -= it->second->size;
+    --stats_.entries;
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+  if (size > capacity_) {
+    return;
+  }
+
+  entries_.push_front(Entry{key.ToString(), std::move(value), size});
+  index_.emplace(key.ToString(), entries_.begin());
+  stats_.size += size;
+  ++stats_.entries;
+  EvictUnlocked();
+}
+
+void MetadataCache::EvictUnlocked() {
+  while (stats_.size > capacity_) {
+    const auto& lru = entries_.back();
+    stats_.size -= lru.size;
+    --stats_.entries;
+    ++stats_.evictions;
+    index_.erase(lru.key);
+    entries_.pop_back();
+  }
+}
+
+void MetadataCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  stats_.size = 0;
+  stats_.entries = 0;
+}
+
+void MetadataCache::SetCapacity(int64_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  EvictUnlocked();
+}
+
+MetadataCache::Stats MetadataCache::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+}  // namespace dataset
+}  // namespace arrow
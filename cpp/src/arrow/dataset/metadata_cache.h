@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/result.h"
+#include "arrow/util/optional.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A thread safe, size bounded LRU cache of metadata parsed from files, such as
+/// Parquet footers or inspected schemas.
+///
+/// Entries are keyed by the filesystem's identity and the file's path, size and
+/// modification time, so a file which is rewritten misses instead of returning stale
+/// metadata, and equal paths of distinct stores (e.g. two S3 endpoints) don't
+/// collide, while equal filesystem instances share entries. Files whose filesystem
+/// doesn't report a modification time are never cached.
+class ARROW_DS_EXPORT MetadataCache {
+ public:
+  /// \brief The default capacity of Default(), in bytes
+  static constexpr int64_t kDefaultCapacity = 256 << 20;
+
+  /// \brief Identifies one kind of metadata of one version of a file
+  class ARROW_DS_EXPORT Key {
+   public:
+    /// \brief Make a key from an already known FileInfo, sparing a GetFileInfo call.
+    ///
+    /// Returns nullopt if info lacks a size or modification time.
+    static util::optional<Key> Make(const fs::FileSystem& filesystem,
+                                    const fs::FileInfo& info, const std::string& kind);
+
+    /// \brief Make a key for a FileSource.
+    ///
+    /// Sources made from a path only are looked up with GetFileInfo on their
+    /// filesystem. Sources made from a FileInfo are keyed on that info as is, so
+    /// they are never looked up.
+    ///
+    /// Returns nullopt for sources which aren't files of a filesystem, or whose
+    /// FileInfo lacks a size or modification time.
+    static Result<util::optional<Key>> Make(const FileSource& source,
+                                            const std::string& kind);
+
+    const std::string& ToString() const { return repr_; }
+
+    bool operator==(const Key& other) const { return repr_ == other.repr_; }
+
+   private:
+    explicit Key(std::string repr) : repr_(std::move(repr)) {}
+
+    std::string repr_;
+  };
+
+  explicit MetadataCache(int64_t capacity = kDefaultCapacity);
+
+  /// \brief The process wide cache used by file formats unless configured otherwise
+  static const std::shared_ptr<MetadataCache>& Default();
+
+  /// \brief Look up an entry, returning null on a miss
+  ///
+  /// The caller must request the type which was inserted under key's kind.
+  template <typename T>
+  std::shared_ptr<T> Get(const Key& key) {
+    return std::static_pointer_cast<T>(GetImpl(key));
+  }
+
+  /// \brief Insert or replace an entry, charged at size bytes against the capacity
+  ///
+  /// Least recently used entries are evicted to make room. Entries larger than the
+  /// capacity are not inserted.
+  template <typename T>
+  void Put(const Key& key, std::shared_ptr<T> value, int64_t size) {
+    PutImpl(key, std::static_pointer_cast<void>(std::move(value)), size);
+  }
+
+  /// \brief Remove all entries
+  void Clear();
+
+  /// \brief Change the capacity, evicting entries as necessary
+  void SetCapacity(int64_t capacity);
+
+  struct Stats {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t evictions = 0;
+    /// \brief The current number and total size of entries
+    int64_t entries = 0;
+    int64_t size = 0;
+  };
+
+  Stats stats() const;
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<void> value;
+    int64_t size;
+  };
+  using EntryList = std::list<Entry>;
+
+  std::shared_ptr<void> GetImpl(const Key& key);
+  void PutImpl(const Key& key, std::shared_ptr<void> value, int64_t size);
+  void EvictUnlocked();
+
+  mutable std::mutex mutex_;
+  int64_t capacity_;
+  Stats stats_;
+  // Most recently used first
+  EntryList entries_;
+  std::unordered_map<std::string, EntryList::iterator> index_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
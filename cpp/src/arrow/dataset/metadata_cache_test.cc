@@ -0,0 +1,216 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/metadata_cache.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestMetadataCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<fs::internal::MockFileSystem>(
+        fs::TimePoint(fs::TimePoint::duration(42)));
+    ASSERT_OK(fs_->CreateFile("a", "aaa"));
+    ASSERT_OK(fs_->CreateFile("b", "bbb"));
+    ASSERT_OK(fs_->CreateFile("c", "ccc"));
+  }
+
+  MetadataCache::Key MakeKey(const std::string& path,
+                             const std::string& kind = "test") {
+    util::optional<MetadataCache::Key> key;
+    ARROW_EXPECT_OK(MetadataCache::Key::Make(FileSource(path, fs_.get()), kind)
+                        .Value(&key));
+    EXPECT_TRUE(key.has_value());
+    return *key;
+  }
+
+ protected:
+  std::shared_ptr<fs::internal::MockFileSystem> fs_;
+};
+
+TEST_F(TestMetadataCache, GetPut) {
+  MetadataCache cache(100);
+  auto a = MakeKey("a");
+
+  ASSERT_EQ(cache.Get<std::string>(a), nullptr);
+  cache.Put(a, std::make_shared<std::string>("metadata of a"), 10);
+  auto value = cache.Get<std::string>(a);
+  ASSERT_NE(value, nullptr);
+  ASSERT_EQ(*value, "metadata of a");
+
+  // kinds are cached independently
+  ASSERT_EQ(cache.Get<std::string>(MakeKey("a", "other")), nullptr);
+
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.hits, 1);
+  ASSERT_EQ(stats.misses, 2);
+  ASSERT_EQ(stats.entries, 1);
+  ASSERT_EQ(stats.size, 10);
+
+  cache.Clear();
+  ASSERT_EQ(cache.Get<std::string>(a), nullptr);
+  ASSERT_EQ(cache.stats().entries, 0);
+  ASSERT_EQ(cache.stats().size, 0);
+}
+
+TEST_F(TestMetadataCache, EvictsLeastRecentlyUsed) {
+  MetadataCache cache(20);
+  auto a = MakeKey("a"), b = MakeKey("b"), c = MakeKey("c");
+
+  cache.Put(a, std::make_shared<int>(1), 10);
+  cache.Put(b, std::make_shared<int>(2), 10);
+  // a is now more recently used than b
+  ASSERT_NE(cache.Get<int>(a), nullptr);
+  cache.Put(c, std::make_shared<int>(3), 10);
+
+  ASSERT_NE(cache.Get<int>(a), nullptr);
+  ASSERT_EQ(cache.Get<int>(b), nullptr);
+  ASSERT_NE(cache.Get<int>(c), nullptr);
+  ASSERT_EQ(cache.stats().evictions, 1);
+  ASSERT_EQ(cache.stats().size, 20);
+
+  // entries larger than the capacity are not inserted
+  cache.Put(b, std::make_shared<int>(2), 21);
+  ASSERT_EQ(cache.Get<int>(b), nullptr);
+  ASSERT_EQ(cache.stats().entries, 2);
+
+  cache.SetCapacity(10);
+  ASSERT_EQ(cache.stats().entries, 1);
+  ASSERT_NE(cache.Get<int>(c), nullptr);
+}
+
+TEST_F(TestMetadataCache, ReplaceEntry) {
+  MetadataCache cache(100);
+  auto a = MakeKey("a");
+
+  cache.Put(a, std::make_shared<int>(1), 10);
+  cache.Put(a, std::make_shared<int>(2), 30);
+  ASSERT_EQ(*cache.Get<int>(a), 2);
+  ASSERT_EQ(cache.stats().entries, 1);
+  ASSERT_EQ(cache.stats().size, 30);
+}
+
+TEST_F(TestMetadataCache, KeyChangesWithFile) {
+  auto before = MakeKey("a");
+  ASSERT_TRUE(MakeKey("a") == before);
+
+  // a rewritten file of a different size is a different key
+  ASSERT_OK(fs_->CreateFile("a", "a longer content"));
+  ASSERT_FALSE(MakeKey("a") == before);
+
+  // ... and so is one with a different modification time
+  fs::FileInfo info;
+  info.set_path("a");
+  info.set_type(fs::FileType::File);
+  info.set_size(3);
+  info.set_mtime(fs::TimePoint(fs::TimePoint::duration(1)));
+  auto key = MetadataCache::Key::Make(*fs_, info, "test");
+  ASSERT_TRUE(key.has_value());
+  info.set_mtime(fs::TimePoint(fs::TimePoint::duration(2)));
+  ASSERT_FALSE(MetadataCache::Key::Make(*fs_, info, "test") == key);
+}
+
+TEST_F(TestMetadataCache, KeyOfFilesystemIdentity) {
+  ASSERT_OK(fs_->CreateDir("x"));
+  ASSERT_OK(fs_->CreateFile("x/a", "aaa"));
+  ASSERT_OK(fs_->CreateDir("y"));
+  ASSERT_OK(fs_->CreateFile("y/a", "aaa"));
+  auto key_of = [](const std::shared_ptr<fs::FileSystem>& fs) {
+    util::optional<MetadataCache::Key> key;
+    ARROW_EXPECT_OK(MetadataCache::Key::Make(FileSource("a", fs.get()), "test")
+                        .Value(&key));
+    EXPECT_TRUE(key.has_value());
+    return *key;
+  };
+
+  // separately made but equal filesystems share entries
+  auto x = std::make_shared<fs::SubTreeFileSystem>("x", fs_);
+  auto same_x = std::make_shared<fs::SubTreeFileSystem>("x", fs_);
+  ASSERT_TRUE(x->Equals(*same_x));
+  MetadataCache cache(100);
+  cache.Put(key_of(x), std::make_shared<std::string>("metadata of x/a"), 10);
+  auto got = cache.Get<std::string>(key_of(same_x));
+  ASSERT_NE(got, nullptr);
+  ASSERT_EQ(*got, "metadata of x/a");
+
+  // the same path of a different filesystem may be another file
+  auto y = std::make_shared<fs::SubTreeFileSystem>("y", fs_);
+  ASSERT_EQ(cache.Get<std::string>(key_of(y)), nullptr);
+
+  auto other_mock = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(42)));
+  ASSERT_OK(other_mock->CreateDir("x"));
+  ASSERT_OK(other_mock->CreateFile("x/a", "aaa"));
+  auto other_x = std::make_shared<fs::SubTreeFileSystem>("x", other_mock);
+  ASSERT_FALSE(x->Equals(*other_x));
+  ASSERT_EQ(cache.Get<std::string>(key_of(other_x)), nullptr);
+}
+
+TEST_F(TestMetadataCache, KeyFromKnownFileInfo) {
+  ASSERT_OK_AND_ASSIGN(auto info, fs_->GetFileInfo("a"));
+
+  // a source made from a complete FileInfo is keyed without calling GetFileInfo, so
+  // the key is unaffected by the file having been removed since
+  ASSERT_OK(fs_->DeleteFile("a"));
+  util::optional<MetadataCache::Key> key;
+  ASSERT_OK(MetadataCache::Key::Make(FileSource(info, fs_.get()), "test").Value(&key));
+  ASSERT_TRUE(key.has_value());
+  ASSERT_TRUE(MetadataCache::Key::Make(*fs_, info, "test") == key);
+
+  // ... while one with only a path must look the file up
+  ASSERT_OK(MetadataCache::Key::Make(FileSource("a", fs_.get()), "test").Value(&key));
+  ASSERT_FALSE(key.has_value());
+
+  // a source whose FileInfo lacks a modification time is not cached, rather than
+  // looked up
+  ASSERT_OK_AND_ASSIGN(info, fs_->GetFileInfo("b"));
+  info.set_mtime(fs::kNoTime);
+  ASSERT_OK(MetadataCache::Key::Make(FileSource(info, fs_.get()), "test").Value(&key));
+  ASSERT_FALSE(key.has_value());
+}
+
+TEST_F(TestMetadataCache, UncacheableSources) {
+  // a file whose modification time is unknown
+  fs::FileInfo info;
+  info.set_path("a");
+  info.set_type(fs::FileType::File);
+  info.set_size(3);
+  ASSERT_FALSE(MetadataCache::Key::Make(*fs_, info, "test").has_value());
+
+  // a buffer
+  util::optional<MetadataCache::Key> key;
+  ASSERT_OK(MetadataCache::Key::Make(FileSource(std::make_shared<Buffer>("aaa")), "test")
+                .Value(&key));
+  ASSERT_FALSE(key.has_value());
+
+  // a missing file
+  ASSERT_OK(MetadataCache::Key::Make(FileSource("z", fs_.get()), "test").Value(&key));
+  ASSERT_FALSE(key.has_value());
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -21,10 +21,16 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <stack>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/filter.h"
@@ -36,6 +42,7 @@
 #include "arrow/util/range.h"
 #include "arrow/util/sort.h"
 #include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 namespace dataset {
@@ -43,6 +50,7 @@ namespace dataset {
 using util::string_view;
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 
 Result<std::shared_ptr<Expression>> Partitioning::Parse(const std::string& path) const {
   ExpressionVector expressions;
@@ -64,6 +72,27 @@ std::shared_ptr<Partitioning> Partitioning::Default() {
   return std::make_shared<DefaultPartitioning>();
 }
 
+Result<std::string> Partitioning::FormatPath(const Expression& expr) const {
+  if (expr.Equals(true)) {
+    return "";
+  }
+
+  return Status::NotImplemented("formatting paths from ", type_name(), " Partitioning");
+}
+
+Result<Partitioning::PartitionedBatches> Partitioning::Partition(
+    const std::shared_ptr<RecordBatch>& batch, MemoryPool* pool) const {
+  if (schema_->num_fields() != 0) {
+    return Status::NotImplemented("partitioning batches with ", type_name(),
+                                  " Partitioning");
+  }
+
+  PartitionedBatches out;
+  out.batches.push_back(batch);
+  out.expressions.push_back(scalar(true));
+  return out;
+}
+
 Result<WritePlan> PartitioningFactory::MakeWritePlan(FragmentIterator fragment_it) {
   return Status::NotImplemented("MakeWritePlan from PartitioningFactory of type ",
                                 type_name());
@@ -139,7 +168,13 @@ Result<std::shared_ptr<Expression>> KeyValuePartitioning::ConvertKey(
     return scalar(true);
   }
 
-  ARROW_ASSIGN_OR_RAISE(auto converted, Scalar::Parse(field->type(), key.value));
+  auto type = field->type();
+  if (type->id() == Type::DICTIONARY) {
+    // partition expressions refer to dictionary encoded fields by their decoded values
+    type = checked_cast<const DictionaryType&>(*type).value_type();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto converted, Scalar::Parse(type, key.value));
   return equal(field_ref(field->name()), scalar(converted));
 }
 
@@ -173,6 +208,9 @@ Result<std::string> KeyValuePartitioning::Format(const Expression& expr, int i)
   const auto& rhs = checked_cast<const ScalarExpression&>(*cmp.right_operand());
 
   auto expected_type = schema_->GetFieldByName(lhs.name())->type();
+  if (expected_type->id() == Type::DICTIONARY) {
+    expected_type = checked_cast<const DictionaryType&>(*expected_type).value_type();
+  }
   if (!rhs.value()->type->Equals(expected_type)) {
     return Status::TypeError(expr.ToString(), " expected RHS to have type ",
                              *expected_type);
@@ -181,6 +219,183 @@ Result<std::string> KeyValuePartitioning::Format(const Expression& expr, int i)
   return FormatKey({lhs.name(), rhs.value()->ToString()}, i);
 }
 
+Result<std::string> KeyValuePartitioning::FormatPath(const Expression& expr) const {
+  std::vector<std::shared_ptr<Scalar>> values(schema_->num_fields());
+  RETURN_NOT_OK(VisitKeys(expr, [&](const std::string& name,
+                                    const std::shared_ptr<Scalar>& value) {
+    auto field_index = schema_->GetFieldIndex(name);
+    if (field_index != -1) {
+      values[field_index] = value;
+    }
+    return Status::OK();
+  }));
+
+  std::string path;
+  for (int i = 0; i < schema_->num_fields(); ++i) {
+    const auto& name = schema_->field(i)->name();
+    if (values[i] == nullptr) {
+      return Status::Invalid(expr.ToString(), " has no key for partition field ", name);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto segment,
+                          Format(*equal(field_ref(name), scalar(values[i])), i));
+    path += segment;
+    path.push_back(fs::internal::kSep);
+  }
+  return path;
+}
+
+namespace {
+
+// Extract the value of a non-null slot of an array as a Scalar.
+struct GetScalarImpl {
+  template <typename T>
+  enable_if_t<has_c_type<T>::value && !std::is_same<T, DayTimeIntervalType>::value,
+              Status>
+  Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    auto value = checked_cast<const ArrayType&>(array).Value(index);
+    return MakeScalar(array.type(), value).Value(&out);
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& binary_array = checked_cast<const ArrayType&>(array);
+    auto value = Buffer::FromString(binary_array.GetString(index));
+    return MakeScalar(array.type(), std::move(value)).Value(&out);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("partitioning on a field of type ", type);
+  }
+
+  const Array& array;
+  int64_t index;
+  std::shared_ptr<Scalar> out;
+};
+
+// Refine each row's group id by a dictionary index, renumbering the resulting
+// (group id, index) pairs densely in order of first appearance. get_slot maps a pair's
+// combined key to its (initially -1) new group id.
+template <typename GetSlot>
+void RefineGroups(const int32_t* indices, int64_t cardinality, GetSlot&& get_slot,
+                  std::vector<int32_t>* group_ids, std::vector<int64_t>* first_rows) {
+  first_rows->clear();
+  for (size_t row = 0; row < group_ids->size(); ++row) {
+    auto key = (*group_ids)[row] * cardinality + indices[row];
+    int32_t& group_id = get_slot(key);
+    if (group_id == -1) {
+      group_id = static_cast<int32_t>(first_rows->size());
+      first_rows->push_back(static_cast<int64_t>(row));
+    }
+    (*group_ids)[row] = group_id;
+  }
+}
+
+}  // namespace
+
+Result<Partitioning::PartitionedBatches> KeyValuePartitioning::Partition(
+    const std::shared_ptr<RecordBatch>& batch, MemoryPool* pool) const {
+  PartitionedBatches out;
+  const int64_t num_rows = batch->num_rows();
+  if (num_rows == 0) {
+    return out;
+  }
+
+  compute::FunctionContext ctx(pool);
+
+  // Assign each row a dense group id by dictionary encoding the partition fields one
+  // at a time. The first row of each group provides the group's partition key.
+  std::vector<int32_t> group_ids(num_rows, 0);
+  std::vector<int64_t> first_rows{0};
+  std::vector<int> key_columns;
+
+  for (const auto& field : schema_->fields()) {
+    auto column_index = batch->schema()->GetFieldIndex(field->name());
+    if (column_index == -1) {
+      return Status::Invalid("partition field ", field->name(),
+                             " is missing from batch with schema ", *batch->schema());
+    }
+    key_columns.push_back(column_index);
+
+    compute::Datum encoded;
+    RETURN_NOT_OK(compute::DictionaryEncode(&ctx, batch->column(column_index), &encoded));
+    auto dict_array = checked_pointer_cast<DictionaryArray>(encoded.make_array());
+    const auto& indices = checked_cast<const Int32Array&>(*dict_array->indices());
+    if (indices.null_count() != 0) {
+      return Status::Invalid("partition field ", field->name(), " contains nulls");
+    }
+
+    const int64_t cardinality = dict_array->dictionary()->length();
+    const int64_t num_groups = static_cast<int64_t>(first_rows.size());
+    const int64_t num_combinations = num_groups * cardinality;
+    if (num_combinations <= 4 * num_rows) {
+      std::vector<int32_t> slots(num_combinations, -1);
+      RefineGroups(
+          indices.raw_values(), cardinality,
+          [&](int64_t key) -> int32_t& { return slots[key]; }, &group_ids, &first_rows);
+    } else {
+      std::unordered_map<int64_t, int32_t> slots;
+      RefineGroups(
+          indices.raw_values(), cardinality,
+          [&](int64_t key) -> int32_t& { return slots.emplace(key, -1).first->second; },
+          &group_ids, &first_rows);
+    }
+  }
+
+  const auto num_groups = static_cast<int32_t>(first_rows.size());
+  for (int32_t group = 0; group < num_groups; ++group) {
+    ExpressionVector keys;
+    for (int column_index : key_columns) {
+      const auto& column = batch->column(column_index);
+      GetScalarImpl get_scalar{*column, first_rows[group], nullptr};
+      RETURN_NOT_OK(VisitTypeInline(*column->type(), &get_scalar));
+      keys.push_back(equal(field_ref(batch->schema()->field(column_index)->name()),
+                           scalar(std::move(get_scalar.out))));
+    }
+    out.expressions.push_back(and_(std::move(keys)));
+  }
+
+  // partition fields are implicit in the partition expressions; drop them
+  auto values = batch;
+  std::sort(key_columns.begin(), key_columns.end(), std::greater<int>());
+  for (int column_index : key_columns) {
+    ARROW_ASSIGN_OR_RAISE(values, values->RemoveColumn(column_index));
+  }
+
+  if (num_groups == 1) {
+    out.batches.push_back(std::move(values));
+    return out;
+  }
+
+  // stable counting sort of row indices by group id, then a single Take
+  std::vector<int64_t> offsets(num_groups + 1, 0);
+  for (int32_t group_id : group_ids) {
+    ++offsets[group_id + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> sort_indices_buffer,
+                        AllocateBuffer(num_rows * sizeof(int64_t), pool));
+  auto sort_indices = reinterpret_cast<int64_t*>(sort_indices_buffer->mutable_data());
+  std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+  for (int64_t row = 0; row < num_rows; ++row) {
+    sort_indices[positions[group_ids[row]]++] = row;
+  }
+
+  std::shared_ptr<RecordBatch> sorted;
+  RETURN_NOT_OK(compute::Take(&ctx, *values,
+                              Int64Array(num_rows, std::move(sort_indices_buffer)),
+                              compute::TakeOptions(), &sorted));
+
+  for (int32_t group = 0; group < num_groups; ++group) {
+    out.batches.push_back(
+        sorted->Slice(offsets[group], offsets[group + 1] - offsets[group]));
+  }
+  return out;
+}
+
 util::optional<KeyValuePartitioning::Key> DirectoryPartitioning::ParseKey(
     const std::string& segment, int i) const {
   if (i >= schema_->num_fields()) {
@@ -200,8 +415,11 @@ Result<std::string> DirectoryPartitioning::FormatKey(const Key& key, int i) cons
 
 class KeyValuePartitioningInspectImpl {
  public:
-  static Result<std::shared_ptr<DataType>> InferType(
-      const std::string& name, const std::vector<std::string>& reprs) {
+  explicit KeyValuePartitioningInspectImpl(const PartitioningFactoryOptions& options)
+      : options_(options) {}
+
+  Result<std::shared_ptr<DataType>> InferType(const std::string& name,
+                                              const std::vector<std::string>& reprs) {
     if (reprs.empty()) {
       return Status::Invalid("No segments were available for field '", name,
                              "'; couldn't infer type");
@@ -216,6 +434,9 @@ class KeyValuePartitioningInspectImpl {
       return int32();
     }
 
+    if (options_.infer_dictionary) {
+      return dictionary(int32(), utf8());
+    }
     return utf8();
   }
 
@@ -253,18 +474,20 @@ class KeyValuePartitioningInspectImpl {
  private:
   std::unordered_map<std::string, int> name_to_index_;
   std::vector<std::vector<std::string>> values_;
+  const PartitioningFactoryOptions& options_;
 };
 
 class DirectoryPartitioningFactory : public PartitioningFactory {
  public:
-  explicit DirectoryPartitioningFactory(std::vector<std::string> field_names)
-      : field_names_(std::move(field_names)) {}
+  DirectoryPartitioningFactory(std::vector<std::string> field_names,
+                               PartitioningFactoryOptions options)
+      : field_names_(std::move(field_names)), options_(options) {}
 
   std::string type_name() const override { return "schema"; }
 
   Result<std::shared_ptr<Schema>> Inspect(
       const std::vector<string_view>& paths) const override {
-    KeyValuePartitioningInspectImpl impl;
+    KeyValuePartitioningInspectImpl impl(options_);
 
     for (const auto& name : field_names_) {
       impl.GetOrInsertField(name);
@@ -304,6 +527,7 @@ class DirectoryPartitioningFactory : public PartitioningFactory {
 
  private:
   std::vector<std::string> field_names_;
+  PartitioningFactoryOptions options_;
 };
 
 struct DirectoryPartitioningFactory::MakeWritePlanImpl {
@@ -564,9 +788,9 @@ Result<WritePlan> DirectoryPartitioningFactory::MakeWritePlan(
 }
 
 std::shared_ptr<PartitioningFactory> DirectoryPartitioning::MakeFactory(
-    std::vector<std::string> field_names) {
+    std::vector<std::string> field_names, PartitioningFactoryOptions options) {
   return std::shared_ptr<PartitioningFactory>(
-      new DirectoryPartitioningFactory(std::move(field_names)));
+      new DirectoryPartitioningFactory(std::move(field_names), options));
 }
 
 util::optional<KeyValuePartitioning::Key> HivePartitioning::ParseKey(
@@ -585,11 +809,14 @@ Result<std::string> HivePartitioning::FormatKey(const Key& key, int i) const {
 
 class HivePartitioningFactory : public PartitioningFactory {
  public:
+  explicit HivePartitioningFactory(PartitioningFactoryOptions options)
+      : options_(options) {}
+
   std::string type_name() const override { return "hive"; }
 
   Result<std::shared_ptr<Schema>> Inspect(
       const std::vector<string_view>& paths) const override {
-    KeyValuePartitioningInspectImpl impl;
+    KeyValuePartitioningInspectImpl impl(options_);
 
     for (auto path : paths) {
       for (auto&& segment : fs::internal::SplitAbstractPath(path.to_string())) {
@@ -606,10 +833,14 @@ class HivePartitioningFactory : public PartitioningFactory {
       const std::shared_ptr<Schema>& schema) const override {
     return std::shared_ptr<Partitioning>(new HivePartitioning(schema));
   }
+
+ private:
+  PartitioningFactoryOptions options_;
 };
 
-std::shared_ptr<PartitioningFactory> HivePartitioning::MakeFactory() {
-  return std::shared_ptr<PartitioningFactory>(new HivePartitioningFactory());
+std::shared_ptr<PartitioningFactory> HivePartitioning::MakeFactory(
+    PartitioningFactoryOptions options) {
+  return std::shared_ptr<PartitioningFactory>(new HivePartitioningFactory(options));
 }
 
 }  // namespace dataset
@@ -73,6 +73,25 @@ class ARROW_DS_EXPORT Partitioning {
   /// \brief Parse a path into a partition expression
   Result<std::shared_ptr<Expression>> Parse(const std::string& path) const;
 
+  /// \brief Format a partition expression into a relative directory path (with a
+  /// trailing separator if non empty), the inverse of Parse(path)
+  virtual Result<std::string> FormatPath(const Expression& expr) const;
+
+  /// \brief Batches of rows which share a partition, as produced by Partition().
+  struct PartitionedBatches {
+    /// Batches with the partition fields removed
+    RecordBatchVector batches;
+    /// The partition expression satisfied by each batch
+    ExpressionVector expressions;
+  };
+
+  /// \brief Split a batch into one batch per partition.
+  ///
+  /// The default implementation supports only partitionings without fields, for which
+  /// the whole batch is a single partition.
+  virtual Result<PartitionedBatches> Partition(const std::shared_ptr<RecordBatch>& batch,
+                                               MemoryPool* pool) const;
+
   /// \brief A default Partitioning which always yields scalar(true)
   static std::shared_ptr<Partitioning> Default();
 
@@ -84,6 +103,15 @@ class ARROW_DS_EXPORT Partitioning {
   std::shared_ptr<Schema> schema_;
 };
 
+/// \brief Options for inferring a Partitioning's schema from paths
+struct ARROW_DS_EXPORT PartitioningFactoryOptions {
+  /// When inferring a schema for partition fields, yield dictionary encoded types
+  /// instead of plain strings. Partition columns are then materialized as dictionary
+  /// arrays whose single-value dictionary is shared by every batch of a fragment,
+  /// rather than as a dense copy of the partition value per batch.
+  bool infer_dictionary = false;
+};
+
 /// \brief PartitioningFactory provides creation of a partitioning  when the
 /// specific schema must be inferred from available paths (no explicit schema is known).
 class ARROW_DS_EXPORT PartitioningFactory {
@@ -164,6 +192,8 @@ class ARROW_DS_EXPORT KeyValuePartitioning : public Partitioning {
 
   /// Convert a Key to a full expression.
   /// If the field referenced in key is absent from the schema will be ignored.
+  /// Keys of dictionary encoded fields are converted to scalars of the dictionary's
+  /// value type.
   static Result<std::shared_ptr<Expression>> ConvertKey(const Key& key,
                                                         const Schema& schema);
 
@@ -177,6 +207,15 @@ class ARROW_DS_EXPORT KeyValuePartitioning : public Partitioning {
 
   Result<std::string> Format(const Expression& expr, int i) const override;
 
+  /// Format one segment for each field of the schema. Each field must be constrained
+  /// by an equality with a scalar in expr.
+  Result<std::string> FormatPath(const Expression& expr) const override;
+
+  /// Group rows by the values of the partition fields, all of which must be present
+  /// and non-null in batch.
+  Result<PartitionedBatches> Partition(const std::shared_ptr<RecordBatch>& batch,
+                                       MemoryPool* pool) const override;
+
  protected:
   using Partitioning::Partitioning;
 };
@@ -199,7 +238,7 @@ class ARROW_DS_EXPORT DirectoryPartitioning : public KeyValuePartitioning {
   Result<std::string> FormatKey(const Key& key, int i) const override;
 
   static std::shared_ptr<PartitioningFactory> MakeFactory(
-      std::vector<std::string> field_names);
+      std::vector<std::string> field_names, PartitioningFactoryOptions options = {});
 };
 
 /// \brief Multi-level, directory based partitioning
@@ -226,7 +265,8 @@ class ARROW_DS_EXPORT HivePartitioning : public KeyValuePartitioning {
 
   static util::optional<Key> ParseKey(const std::string& segment);
 
-  static std::shared_ptr<PartitioningFactory> MakeFactory();
+  static std::shared_ptr<PartitioningFactory> MakeFactory(
+      PartitioningFactoryOptions options = {});
 };
 
 /// \brief Implementation provided by lambda or other callable
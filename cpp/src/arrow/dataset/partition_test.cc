@@ -74,6 +74,10 @@ class TestPartitioning : public ::testing::Test {
     return field(std::move(name), utf8());
   }
 
+  static std::shared_ptr<Field> DictStr(std::string name) {
+    return field(std::move(name), dictionary(int32(), utf8()));
+  }
+
   std::shared_ptr<Partitioning> partitioning_;
   std::shared_ptr<PartitioningFactory> factory_;
 };
@@ -138,6 +142,30 @@ TEST_F(TestPartitioning, DiscoverSchema) {
   AssertInspect({"/0/1", "/hello"}, {Str("alpha"), Int("beta")});
 }
 
+TEST_F(TestPartitioning, DiscoverDictionarySchema) {
+  PartitioningFactoryOptions options;
+  options.infer_dictionary = true;
+  factory_ = DirectoryPartitioning::MakeFactory({"alpha", "beta"}, options);
+
+  // integral fields are still int32, strings are dictionary encoded
+  AssertInspect({"/0/1", "/hello/1"}, {DictStr("alpha"), Int("beta")});
+
+  factory_ = HivePartitioning::MakeFactory(options);
+  AssertInspect({"/alpha=0/beta=x", "/alpha=1/beta=y"}, {Int("alpha"), DictStr("beta")});
+}
+
+TEST_F(TestPartitioning, DictionaryPartitioning) {
+  partitioning_ = std::make_shared<HivePartitioning>(
+      schema({field("alpha", int32()), field("beta", dictionary(int32(), utf8()))}));
+
+  // keys of dictionary encoded fields are parsed to the dictionary's value type
+  AssertParse("/alpha=0/beta=hello", "alpha"_ == int32_t(0) and "beta"_ == "hello");
+
+  ASSERT_OK_AND_ASSIGN(auto path,
+                       partitioning_->FormatPath("alpha"_ == 3 and "beta"_ == "hello"));
+  EXPECT_EQ(path, "alpha=3/beta=hello/");
+}
+
 TEST_F(TestPartitioning, DiscoverSchemaSegfault) {
   // ARROW-7638
   factory_ = DirectoryPartitioning::MakeFactory({"alpha", "beta"});
@@ -165,6 +193,72 @@ TEST_F(TestPartitioning, HivePartitioning) {
   AssertParseError("/alpha=0.0/beta=3.25");  // conversion of "0.0" to int32 fails
 }
 
+TEST_F(TestPartitioning, FormatPath) {
+  partitioning_ = std::make_shared<HivePartitioning>(
+      schema({field("alpha", int32()), field("beta", utf8())}));
+
+  ASSERT_OK_AND_ASSIGN(auto path,
+                       partitioning_->FormatPath("beta"_ == "x" and "alpha"_ == 3));
+  EXPECT_EQ(path, "alpha=3/beta=x/");
+  ASSERT_RAISES(Invalid, partitioning_->FormatPath("alpha"_ == 3));
+
+  partitioning_ = std::make_shared<DirectoryPartitioning>(
+      schema({field("alpha", int32()), field("beta", utf8())}));
+  ASSERT_OK_AND_ASSIGN(path, partitioning_->FormatPath("alpha"_ == 3 and "beta"_ == "x"));
+  EXPECT_EQ(path, "3/x/");
+
+  ASSERT_OK_AND_ASSIGN(path, Partitioning::Default()->FormatPath(*scalar(true)));
+  EXPECT_EQ(path, "");
+}
+
+TEST_F(TestPartitioning, PartitionBatch) {
+  partitioning_ = std::make_shared<HivePartitioning>(
+      schema({field("alpha", int32()), field("beta", utf8())}));
+
+  std::shared_ptr<Array> alpha, beta, value;
+  ArrayFromVector<Int32Type, int32_t>({0, 1, 0, 1, 0, 2}, &alpha);
+  ArrayFromVector<StringType, std::string>({"x", "x", "y", "x", "x", "x"}, &beta);
+  ArrayFromVector<Int64Type, int64_t>({0, 1, 2, 3, 4, 5}, &value);
+  auto batch = RecordBatch::Make(
+      schema({field("alpha", int32()), field("value", int64()), field("beta", utf8())}),
+      6, {alpha, value, beta});
+
+  ASSERT_OK_AND_ASSIGN(auto partitioned,
+                       partitioning_->Partition(batch, default_memory_pool()));
+
+  // partitions are ordered by first appearance, rows within a partition are stable
+  std::vector<E> expressions;
+  for (const auto& expr : partitioned.expressions) {
+    expressions.emplace_back(expr);
+  }
+  EXPECT_THAT(expressions, testing::ElementsAre(E{"alpha"_ == 0 and "beta"_ == "x"},
+                                                E{"alpha"_ == 1 and "beta"_ == "x"},
+                                                E{"alpha"_ == 0 and "beta"_ == "y"},
+                                                E{"alpha"_ == 2 and "beta"_ == "x"}));
+
+  std::vector<std::vector<int64_t>> expected_values = {{0, 4}, {1, 3}, {2}, {5}};
+  ASSERT_EQ(partitioned.batches.size(), expected_values.size());
+  for (size_t i = 0; i < expected_values.size(); ++i) {
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<Int64Type, int64_t>(expected_values[i], &expected);
+    AssertBatchesEqual(*RecordBatch::Make(schema({field("value", int64())}),
+                                          expected->length(), {expected}),
+                       *partitioned.batches[i]);
+  }
+
+  // partition fields must be present and non-null
+  ASSERT_RAISES(Invalid,
+                partitioning_->Partition(batch->RemoveColumn(2).ValueOrDie(),
+                                         default_memory_pool()));
+  std::shared_ptr<Array> null_alpha;
+  ArrayFromVector<Int32Type, int32_t>({true, false, true, true, true, true},
+                                      {0, 1, 0, 1, 0, 2}, &null_alpha);
+  ASSERT_RAISES(Invalid,
+                partitioning_->Partition(
+                    RecordBatch::Make(batch->schema(), 6, {null_alpha, value, beta}),
+                    default_memory_pool()));
+}
+
 TEST_F(TestPartitioning, DiscoverHiveSchema) {
   factory_ = HivePartitioning::MakeFactory();
 
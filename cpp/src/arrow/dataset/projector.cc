@@ -17,23 +17,28 @@
 
 #include "arrow/dataset/projector.h"
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 namespace dataset {
 
+using internal::checked_cast;
+
 Status CheckProjectable(const Schema& from, const Schema& to) {
   for (const auto& to_field : to.fields()) {
     ARROW_ASSIGN_OR_RAISE(auto from_field, FieldRef(to_field->name()).GetOneOrNone(from));
@@ -78,6 +83,14 @@ Status RecordBatchProjector::SetDefaultValue(FieldRef ref,
   auto index = match.indices()[0];
 
   auto field_type = to_->field(index)->type();
+  if (field_type->id() == Type::DICTIONARY &&
+      checked_cast<const DictionaryType&>(*field_type)
+          .value_type()
+          ->Equals(scalar->type)) {
+    // materialize the column as a dictionary holding only the scalar
+    scalar = std::make_shared<DictionaryScalar>(std::move(scalar), field_type);
+  }
+
   if (!field_type->Equals(scalar->type)) {
     return Status::TypeError("field ", to_->field(index)->ToString(),
                              " cannot be materialized from scalar of type ",
@@ -138,6 +151,7 @@ Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
 Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool* pool) {
   // TODO(bkietz) MakeArrayOfNull could use fewer buffers by reusing a single zeroed
   // buffer for every buffer in every column which is null
+  std::shared_ptr<Buffer> zero_indices;
   for (int i = 0; i < to_->num_fields(); ++i) {
     if (missing_columns_[i] == nullptr) {
       continue;
@@ -148,6 +162,12 @@ Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool
           MakeArrayOfNull(missing_columns_[i]->type(), new_length, pool));
       continue;
     }
+    if (scalars_[i]->type->id() == Type::DICTIONARY && scalars_[i]->is_valid) {
+      ARROW_ASSIGN_OR_RAISE(
+          missing_columns_[i],
+          MakeConstantDictionaryArray(i, new_length, pool, &zero_indices));
+      continue;
+    }
     ARROW_ASSIGN_OR_RAISE(missing_columns_[i],
                           MakeArrayFromScalar(*scalars_[i], new_length, pool));
   }
@@ -155,6 +175,29 @@ Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool
   return Status::OK();
 }
 
+Result<std::shared_ptr<Array>> RecordBatchProjector::MakeConstantDictionaryArray(
+    int i, int64_t length, MemoryPool* pool, std::shared_ptr<Buffer>* zero_indices) {
+  const auto& scalar = checked_cast<const DictionaryScalar&>(*scalars_[i]);
+  const auto& type = checked_cast<const DictionaryType&>(*scalar.type);
+
+  ARROW_ASSIGN_OR_RAISE(auto dictionary, MakeArrayFromScalar(*scalar.value, 1, pool));
+
+  // Every index is 0, so one zeroed buffer serves the indices of all such columns
+  const auto& index_type = checked_cast<const FixedWidthType&>(*type.index_type());
+  const int64_t indices_size = length * index_type.bit_width() / 8;
+  if (*zero_indices == nullptr || (*zero_indices)->size() < indices_size) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(indices_size, pool));
+    std::memset(buffer->mutable_data(), 0, static_cast<size_t>(indices_size));
+    *zero_indices = std::move(buffer);
+  }
+
+  auto indices = MakeArray(ArrayData::Make(
+      type.index_type(), length, {nullptr, SliceBuffer(*zero_indices, 0, indices_size)},
+      /*null_count=*/0));
+  return std::make_shared<DictionaryArray>(scalar.type, std::move(indices),
+                                           std::move(dictionary));
+}
+
 constexpr int RecordBatchProjector::kNoMatch;
 
 }  // namespace dataset
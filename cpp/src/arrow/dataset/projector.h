@@ -48,6 +48,10 @@ class ARROW_DS_EXPORT RecordBatchProjector {
 
   /// If the indexed field is absent from a record batch it will be added to the projected
   /// record batch with all its slots equal to the provided scalar (instead of null).
+  ///
+  /// If the field is dictionary encoded the scalar may have the dictionary's value type.
+  /// The column is then materialized as a dictionary array with a single entry and
+  /// zeroed indices rather than as a dense copy of the scalar.
   Status SetDefaultValue(FieldRef ref, std::shared_ptr<Scalar> scalar);
 
   Result<std::shared_ptr<RecordBatch>> Project(const RecordBatch& batch,
@@ -61,6 +65,9 @@ class ARROW_DS_EXPORT RecordBatchProjector {
  private:
   Status ResizeMissingColumns(int64_t new_length, MemoryPool* pool);
 
+  Result<std::shared_ptr<Array>> MakeConstantDictionaryArray(
+      int i, int64_t length, MemoryPool* pool, std::shared_ptr<Buffer>* zero_indices);
+
   std::shared_ptr<Schema> from_, to_;
   int64_t missing_columns_length_ = 0;
   // these vectors are indexed parallel to to_->fields()
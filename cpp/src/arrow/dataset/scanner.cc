@@ -27,6 +27,7 @@
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/numa.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
 
@@ -65,6 +66,22 @@ Result<RecordBatchIterator> InMemoryScanTask::Execute() {
   return MakeVectorIterator(record_batches_);
 }
 
+int InMemoryScanTask::numa_node() const {
+  // Assume the batches were allocated together; the first buffer is as good
+  // an indication of their placement as any.
+  for (const auto& batch : record_batches_) {
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      for (const auto& buffer : batch->column_data(i)->buffers) {
+        if (buffer != nullptr && buffer->size() > 0 && buffer->is_cpu()) {
+          auto maybe_node = internal::GetNumaNodeOfAddress(buffer->data());
+          return maybe_node.ok() ? *maybe_node : -1;
+        }
+      }
+    }
+  }
+  return -1;
+}
+
 FragmentIterator Scanner::GetFragments() {
   if (fragment_ != nullptr) {
     return MakeVectorIterator(FragmentVector{fragment_});
@@ -129,6 +146,14 @@ Status ScannerBuilder::Filter(std::shared_ptr<Expression> filter) {
 
 Status ScannerBuilder::Filter(const Expression& filter) { return Filter(filter.Copy()); }
 
+Status ScannerBuilder::Evaluator(std::shared_ptr<ExpressionEvaluator> evaluator) {
+  if (evaluator == nullptr) {
+    return Status::Invalid("Evaluator must not be null");
+  }
+  evaluator_ = std::move(evaluator);
+  return Status::OK();
+}
+
 Status ScannerBuilder::UseThreads(bool use_threads) {
   scan_context_->use_threads = use_threads;
   return Status::OK();
@@ -152,7 +177,8 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   }
 
   if (!scan_options->filter->Equals(true)) {
-    scan_options->evaluator = std::make_shared<TreeEvaluator>();
+    scan_options->evaluator =
+        evaluator_ ? evaluator_ : std::make_shared<TreeEvaluator>();
   }
 
   return std::make_shared<Scanner>(dataset_, std::move(scan_options), scan_context_);
@@ -173,9 +199,28 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
 
   auto task_group = scan_context_->TaskGroup();
 
+  // With NUMA threading, each ScanTask runs on a pool bound to the node
+  // holding its data; tasks of unknown placement are spread round-robin.
+  std::vector<std::shared_ptr<internal::TaskGroup>> numa_task_groups;
+  if (scan_context_->use_threads && IsNumaThreadingEnabled()) {
+    for (int node = 0; node < internal::GetNumaNodeCount(); ++node) {
+      numa_task_groups.push_back(
+          internal::TaskGroup::MakeThreaded(internal::GetNumaThreadPool(node)));
+    }
+  }
+  size_t next_node = 0;
+
   for (auto maybe_scan_task : scan_task_it) {
     ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
 
+    if (!numa_task_groups.empty()) {
+      int node = scan_task->numa_node();
+      if (node < 0 || static_cast<size_t>(node) >= numa_task_groups.size()) {
+        node = static_cast<int>(next_node++ % numa_task_groups.size());
+      }
+      task_group = numa_task_groups[node];
+    }
+
     task_group->Append([&batches, &mutex, scan_task] {
       ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
 
@@ -190,7 +235,15 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
   }
 
   // Wait for all tasks to complete, or the first error.
-  RETURN_NOT_OK(task_group->Finish());
+  if (!numa_task_groups.empty()) {
+    Status st;
+    for (const auto& numa_task_group : numa_task_groups) {
+      st &= numa_task_group->Finish();
+    }
+    RETURN_NOT_OK(st);
+  } else {
+    RETURN_NOT_OK(task_group->Finish());
+  }
 
   return Table::FromRecordBatches(scan_options_->schema(), std::move(batches));
 }
@@ -109,6 +109,12 @@ class ARROW_DS_EXPORT ScanTask {
   /// particular ScanTask implementation
   virtual Result<RecordBatchIterator> Execute() = 0;
 
+  /// \brief The NUMA node holding this task's input data, or -1 if unknown.
+  ///
+  /// When NUMA threading is enabled, the Scanner executes the task on a
+  /// thread pool bound to that node.
+  virtual int numa_node() const { return -1; }
+
   virtual ~ScanTask() = default;
 
   const std::shared_ptr<ScanOptions>& options() const { return options_; }
@@ -133,6 +139,8 @@ class ARROW_DS_EXPORT InMemoryScanTask : public ScanTask {
 
   Result<RecordBatchIterator> Execute() override;
 
+  int numa_node() const override;
+
  protected:
   std::vector<std::shared_ptr<RecordBatch>> record_batches_;
 };
@@ -229,6 +237,13 @@ class ARROW_DS_EXPORT ScannerBuilder {
   Status Filter(std::shared_ptr<Expression> filter);
   Status Filter(const Expression& filter);
 
+  /// \brief Set the ExpressionEvaluator used to evaluate the filter expression.
+  ///
+  /// Defaults to a TreeEvaluator.
+  ///
+  /// \param[in] evaluator the evaluator to use, e.g. a GandivaEvaluator.
+  Status Evaluator(std::shared_ptr<ExpressionEvaluator> evaluator);
+
   /// \brief Indicate if the Scanner should make use of the available
   ///        ThreadPool found in ScanContext;
   Status UseThreads(bool use_threads = true);
@@ -252,6 +267,7 @@ class ARROW_DS_EXPORT ScannerBuilder {
   std::shared_ptr<ScanContext> scan_context_;
   bool has_projection_ = false;
   std::vector<std::string> project_columns_;
+  std::shared_ptr<ExpressionEvaluator> evaluator_;
 };
 
 }  // namespace dataset
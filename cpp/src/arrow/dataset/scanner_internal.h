@@ -66,6 +66,8 @@ class FilterAndProjectScanTask : public ScanTask {
                               context_->pool);
   }
 
+  int numa_node() const override { return task_->numa_node(); }
+
  private:
   std::shared_ptr<ScanTask> task_;
 };
@@ -81,6 +83,8 @@ class ProjectScanTask : public ScanTask {
                               context_->pool);
   }
 
+  int numa_node() const override { return task_->numa_node(); }
+
  private:
   std::shared_ptr<ScanTask> task_;
 };
@@ -52,6 +52,8 @@ class FileSource;
 class FileFormat;
 class FileFragment;
 class FileSystemDataset;
+class FileWriter;
+struct FileSystemDatasetWriteOptions;
 
 class ParquetFileFormat;
 class ParquetFileFragment;
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <sstream>
 #include <utility>
 
@@ -114,8 +115,20 @@ std::string FileInfo::extension() const {
 //////////////////////////////////////////////////////////////////////////
 // FileSystem default method implementations
 
+namespace {
+
+std::atomic<int64_t> next_instance_id{0};
+
+}  // namespace
+
+FileSystem::FileSystem() : instance_id_(next_instance_id++) {}
+
 FileSystem::~FileSystem() {}
 
+std::string FileSystem::identity() const {
+  return type_name() + ":" + std::to_string(instance_id_);
+}
+
 Result<std::string> FileSystem::NormalizePath(std::string path) { return path; }
 
 Result<std::vector<FileInfo>> FileSystem::GetFileInfo(
@@ -152,6 +165,12 @@ Result<std::string> SubTreeFileSystem::NormalizeBasePath(
   return EnsureTrailingSlash(std::move(base_path));
 }
 
+std::string SubTreeFileSystem::identity() const {
+  // Length-prefix the base path so that it can't run into the base identity
+  return type_name() + ":" + std::to_string(base_path_.size()) + ":" + base_path_ +
+         base_fs_->identity();
+}
+
 bool SubTreeFileSystem::Equals(const FileSystem& other) const {
   if (this == &other) {
     return true;
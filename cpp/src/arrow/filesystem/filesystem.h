@@ -158,6 +158,7 @@ struct ARROW_EXPORT FileSelector {
 /// \brief Abstract file system API
 class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem> {
  public:
+  FileSystem();
   virtual ~FileSystem();
 
   virtual std::string type_name() const = 0;
@@ -174,6 +175,15 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
     return Equals(*other);
   }
 
+  /// \brief Identify the store this filesystem gives access to
+  ///
+  /// Filesystems which compare equal have the same identity, even if they are
+  /// distinct instances, so that the identity can key caches shared by such
+  /// instances. Filesystems giving access to distinct stores have distinct
+  /// identities. The default implementation returns an identity unique to the
+  /// instance, which no other instance will ever have.
+  virtual std::string identity() const;
+
   /// Get info for the given target.
   ///
   /// Any symlink is automatically dereferenced, recursively.
@@ -245,6 +255,9 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// If the target doesn't exist, a new empty file is created.
   virtual Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
       const std::string& path) = 0;
+
+ private:
+  const int64_t instance_id_;
 };
 
 /// \brief A FileSystem implementation that delegates to another
@@ -270,6 +283,7 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
   Result<std::string> NormalizePath(std::string path) override;
 
   bool Equals(const FileSystem& other) const override;
+  std::string identity() const override;
 
   /// \cond FALSE
   using FileSystem::GetFileInfo;
@@ -402,6 +402,13 @@ Result<FileInfo> HadoopFileSystem::GetFileInfo(const std::string& path) {
 
 HdfsOptions HadoopFileSystem::options() const { return impl_->options(); }
 
+std::string HadoopFileSystem::identity() const {
+  const HdfsOptions opts = options();
+  const auto& config = opts.connection_config;
+  return type_name() + ":" + config.user + "@" + config.host + ":" +
+         std::to_string(config.port);
+}
+
 bool HadoopFileSystem::Equals(const FileSystem& other) const {
   if (this == &other) {
     return true;
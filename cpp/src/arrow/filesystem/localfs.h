@@ -64,6 +64,8 @@ class ARROW_EXPORT LocalFileSystem : public FileSystem {
   Result<std::string> NormalizePath(std::string path) override;
 
   bool Equals(const FileSystem& other) const override;
+  /// All local filesystems access the same files, whatever their options
+  std::string identity() const override { return type_name(); }
 
   LocalFileSystemOptions options() const { return options_; }
 
@@ -20,10 +20,13 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstring>
+#include <list>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifdef _WIN32
 // Undefine preprocessor macros that interfere with AWS function / method names
@@ -41,6 +44,7 @@
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/utils/logging/ConsoleLogSystem.h>
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/AbortMultipartUploadRequest.h>
 #include <aws/s3/model/CompleteMultipartUploadRequest.h>
@@ -70,6 +74,7 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/windows_fixup.h"
 
@@ -254,6 +259,10 @@ Result<S3Options> S3Options::FromUri(const std::string& uri_string,
 bool S3Options::Equals(const S3Options& other) const {
   return (region == other.region && endpoint_override == other.endpoint_override &&
           scheme == other.scheme && background_writes == other.background_writes &&
+          read_block_size == other.read_block_size &&
+          max_readahead == other.max_readahead &&
+          read_cache_blocks == other.read_cache_blocks &&
+          max_concurrent_fetches == other.max_concurrent_fetches &&
           GetAccessKey() == other.GetAccessKey() &&
           GetSecretKey() == other.GetSecretKey());
 }
@@ -372,8 +381,8 @@ Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t sta
 // A RandomAccessFile that reads from a S3 object
 class ObjectInputFile : public io::RandomAccessFile {
  public:
-  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path)
-      : client_(client), path_(path) {}
+  ObjectInputFile(std::shared_ptr<Aws::S3::S3Client> client, const S3Path& path)
+      : client_(std::move(client)), path_(path) {}
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -453,7 +462,7 @@ class ObjectInputFile : public io::RandomAccessFile {
 
     // Read the desired range of bytes
     S3Model::GetObjectResult result;
-    RETURN_NOT_OK(GetObjectRange(client_, path_, position, nbytes, &result));
+    RETURN_NOT_OK(GetObjectRange(client_.get(), path_, position, nbytes, &result));
 
     auto& stream = result.GetBody();
     stream.read(reinterpret_cast<char*>(out), nbytes);
@@ -492,13 +501,223 @@ class ObjectInputFile : public io::RandomAccessFile {
   }
 
  protected:
-  Aws::S3::S3Client* client_;
+  std::shared_ptr<Aws::S3::S3Client> client_;
   S3Path path_;
   bool closed_ = false;
   int64_t pos_ = 0;
   int64_t content_length_ = -1;
 };
 
+// An ObjectInputFile which fetches the object in blocks of read_block_size bytes,
+// keeping the most recently used blocks in a cache keyed by block offset.
+// The missing blocks of a read are requested concurrently with GetObjectAsync, and
+// sequential reads grow a window of blocks requested ahead of the reader.
+class BlockCachingObjectInputFile : public ObjectInputFile {
+ public:
+  using BlockFuture = Future<std::shared_ptr<Buffer>>;
+
+  BlockCachingObjectInputFile(std::shared_ptr<Aws::S3::S3Client> client,
+                              const S3Path& path, const S3Options& options)
+      : ObjectInputFile(std::move(client), path),
+        block_size_(options.read_block_size),
+        max_readahead_(std::max<int64_t>(options.max_readahead, 0)) {
+    DCHECK_GT(block_size_, 0);
+    // Leave room for the readahead window in addition to the blocks being read
+    capacity_ = std::max<int64_t>(options.read_cache_blocks,
+                                  max_readahead_ / block_size_ + 2);
+  }
+
+  // The fetch handlers complete futures owned by this file, so wait for them
+  ~BlockCachingObjectInputFile() override { WaitForFetches(); }
+
+  Status Close() override {
+    RETURN_NOT_OK(ObjectInputFile::Close());
+    WaitForFetches();
+    std::lock_guard<std::mutex> lock(mutex_);
+    lru_.clear();
+    cache_.clear();
+    return Status::OK();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, content_length_ - position);
+    if (nbytes == 0) {
+      return 0;
+    }
+
+    auto blocks = GetBlocks(position, nbytes);
+    auto dest = reinterpret_cast<uint8_t*>(out);
+    int64_t block_start = position / block_size_ * block_size_;
+    int64_t bytes_read = 0;
+    for (const auto& future : blocks) {
+      ARROW_ASSIGN_OR_RAISE(auto block, GetBlockResult(block_start, future));
+      const int64_t begin = position + bytes_read - block_start;
+      const int64_t end = std::min(block->size(), position + nbytes - block_start);
+      if (end <= begin) {
+        // The object is shorter than it was when opened
+        break;
+      }
+      std::memcpy(dest + bytes_read, block->data() + begin, end - begin);
+      bytes_read += end - begin;
+      block_start += block_size_;
+    }
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, content_length_ - position);
+    const int64_t block_start = position / block_size_ * block_size_;
+    if (nbytes == 0 || position + nbytes > block_start + block_size_) {
+      return ObjectInputFile::ReadAt(position, nbytes);
+    }
+
+    // The range lies within a single block, which can be sliced without copying
+    auto blocks = GetBlocks(position, nbytes);
+    ARROW_ASSIGN_OR_RAISE(auto block, GetBlockResult(block_start, blocks[0]));
+    const int64_t begin = std::min(position - block_start, block->size());
+    return SliceBuffer(block, begin, std::min(nbytes, block->size() - begin));
+  }
+
+ protected:
+  // Return the blocks covering the given range, requesting the missing ones as well
+  // as those in the readahead window
+  std::vector<BlockFuture> GetBlocks(int64_t position, int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (position == next_sequential_position_) {
+      readahead_ = std::min(std::max(2 * readahead_, block_size_), max_readahead_);
+    } else {
+      readahead_ = 0;
+    }
+    next_sequential_position_ = position + nbytes;
+
+    const int64_t first_block = position / block_size_;
+    const int64_t last_block = (position + nbytes - 1) / block_size_;
+    const int64_t last_readahead_block =
+        std::min(position + nbytes - 1 + readahead_, content_length_ - 1) / block_size_;
+
+    std::vector<BlockFuture> blocks;
+    for (int64_t block = first_block; block <= last_readahead_block; ++block) {
+      auto future = GetBlock(block);
+      if (block <= last_block) {
+        blocks.push_back(std::move(future));
+      }
+    }
+    return blocks;
+  }
+
+  BlockFuture GetBlock(int64_t block) {
+    auto it = cache_.find(block);
+    if (it != cache_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+      return it->second.future;
+    }
+
+    const int64_t start = block * block_size_;
+    auto future = FetchBlock(start, std::min(block_size_, content_length_ - start));
+    lru_.push_front(block);
+    cache_.emplace(block, CacheEntry{future, lru_.begin()});
+
+    while (static_cast<int64_t>(lru_.size()) > capacity_) {
+      cache_.erase(lru_.back());
+      lru_.pop_back();
+    }
+    return future;
+  }
+
+  BlockFuture FetchBlock(int64_t start, int64_t length) {
+    auto future = BlockFuture::Make();
+
+    S3Model::GetObjectRequest req;
+    req.SetBucket(ToAwsString(path_.bucket));
+    req.SetKey(ToAwsString(path_.key));
+    req.SetRange(ToAwsString(FormatRange(start, length)));
+
+    auto path = path_;
+    auto handler =
+        [future, path, length](
+            const Aws::S3::S3Client*, const S3Model::GetObjectRequest&,
+            S3Model::GetObjectOutcome outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) mutable {
+          if (!outcome.IsSuccess()) {
+            future.MarkFinished(ErrorToStatus(
+                std::forward_as_tuple("When reading from key '", path.key,
+                                      "' in bucket '", path.bucket, "': "),
+                outcome.GetError()));
+            return;
+          }
+          future.MarkFinished(ReadBody(&outcome.GetResult().GetBody(), length));
+        };
+    client_->GetObjectAsync(req, handler);
+
+    // Called with mutex_ held: forget the fetches that completed, track the new one
+    fetches_.erase(std::remove_if(fetches_.begin(), fetches_.end(),
+                                  [](const BlockFuture& fetch) {
+                                    return IsFutureFinished(fetch.state());
+                                  }),
+                   fetches_.end());
+    fetches_.push_back(future);
+    return future;
+  }
+
+  void WaitForFetches() {
+    std::vector<BlockFuture> fetches;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      fetches.swap(fetches_);
+    }
+    for (auto& fetch : fetches) {
+      fetch.Wait();
+    }
+  }
+
+  static Result<std::shared_ptr<Buffer>> ReadBody(std::istream* stream, int64_t length) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(length));
+    stream->read(reinterpret_cast<char*>(buffer->mutable_data()), length);
+    RETURN_NOT_OK(buffer->Resize(stream->gcount()));
+    return std::shared_ptr<Buffer>(std::move(buffer));
+  }
+
+  // Wait for a block; failed blocks are dropped from the cache to be fetched again
+  Result<std::shared_ptr<Buffer>> GetBlockResult(int64_t block_start,
+                                                 const BlockFuture& future) {
+    const auto& result = future.result();
+    if (!result.ok()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = cache_.find(block_start / block_size_);
+      if (it != cache_.end()) {
+        lru_.erase(it->second.lru_position);
+        cache_.erase(it);
+      }
+    }
+    return result;
+  }
+
+  struct CacheEntry {
+    BlockFuture future;
+    std::list<int64_t>::iterator lru_position;
+  };
+
+  const int64_t block_size_;
+  const int64_t max_readahead_;
+  int64_t capacity_;
+
+  std::mutex mutex_;
+  // Block indices, most recently used first
+  std::list<int64_t> lru_;
+  std::unordered_map<int64_t, CacheEntry> cache_;
+  // Fetches which may still be in flight, including those of evicted blocks
+  std::vector<BlockFuture> fetches_;
+  int64_t next_sequential_position_ = 0;
+  int64_t readahead_ = 0;
+};
+
 // A non-copying istream.
 // See https://stackoverflow.com/questions/35322033/aws-c-sdk-uploadpart-times-out
 // https://stackoverflow.com/questions/13059091/creating-an-input-stream-from-constant-memory
@@ -833,7 +1052,7 @@ class S3FileSystem::Impl {
   S3Options options_;
   Aws::Client::ClientConfiguration client_config_;
   Aws::Auth::AWSCredentials credentials_;
-  std::unique_ptr<Aws::S3::S3Client> client_;
+  std::shared_ptr<Aws::S3::S3Client> client_;
 
   const int32_t kListObjectsMaxKeys = 1000;
   // At most 1000 keys per multiple-delete request
@@ -855,6 +1074,12 @@ class S3FileSystem::Impl {
       return Status::Invalid("Invalid S3 connection scheme '", options_.scheme, "'");
     }
     client_config_.retryStrategy = std::make_shared<ConnectRetryStrategy>();
+    if (options_.read_block_size > 0) {
+      // Bound the number of block fetches in flight across all input files
+      client_config_.executor =
+          Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(
+              "arrow", std::max(options_.max_concurrent_fetches, 1));
+    }
     bool use_virtual_addressing = options_.endpoint_override.empty();
     client_.reset(
         new Aws::S3::S3Client(credentials_, client_config_,
@@ -865,6 +1090,17 @@ class S3FileSystem::Impl {
 
   S3Options options() const { return options_; }
 
+  Result<std::shared_ptr<ObjectInputFile>> OpenInputFile(const S3Path& path) {
+    std::shared_ptr<ObjectInputFile> ptr;
+    if (options_.read_block_size > 0) {
+      ptr = std::make_shared<BlockCachingObjectInputFile>(client_, path, options_);
+    } else {
+      ptr = std::make_shared<ObjectInputFile>(client_, path);
+    }
+    RETURN_NOT_OK(ptr->Init());
+    return ptr;
+  }
+
   // Create a bucket.  Successful if bucket already exists.
   Status CreateBucket(const std::string& bucket) {
     S3Model::CreateBucketConfiguration config;
@@ -1219,6 +1455,14 @@ Result<std::shared_ptr<S3FileSystem>> S3FileSystem::Make(const S3Options& option
   return ptr;
 }
 
+std::string S3FileSystem::identity() const {
+  // The credentials are part of the identity, as they decide which objects
+  // are visible
+  const auto& opts = impl_->options_;
+  return type_name() + ":" + opts.GetAccessKey() + "@" + opts.scheme + "://" +
+         opts.endpoint_override + "/" + opts.region;
+}
+
 bool S3FileSystem::Equals(const FileSystem& other) const {
   if (this == &other) {
     return true;
@@ -1468,9 +1712,7 @@ Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
-  RETURN_NOT_OK(ptr->Init());
-  return ptr;
+  return impl_->OpenInputFile(path);
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
@@ -1479,9 +1721,7 @@ Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
-  RETURN_NOT_OK(ptr->Init());
-  return ptr;
+  return impl_->OpenInputFile(path);
 }
 
 Result<std::shared_ptr<io::OutputStream>> S3FileSystem::OpenOutputStream(
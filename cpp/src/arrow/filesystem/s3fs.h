@@ -55,6 +55,24 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// \brief Size in bytes of the blocks in which input files are fetched and cached
+  ///
+  /// If 0 (the default), each read issues its own GetObject request. Otherwise reads
+  /// are served from blocks cached by the input file; the missing blocks of a read are
+  /// fetched concurrently, and sequential reads grow a readahead window of blocks
+  /// fetched in the background.
+  int64_t read_block_size = 0;
+  /// Maximum number of bytes fetched ahead of sequential reads (if read_block_size
+  /// is not 0). The readahead window starts at one block and doubles with each
+  /// sequential read.
+  int64_t max_readahead = 16 * 1024 * 1024;
+  /// Number of blocks cached by each input file (if read_block_size is not 0). The
+  /// cache always has room for the readahead window.
+  int32_t read_cache_blocks = 16;
+  /// Maximum number of blocks fetched concurrently by all input files of the
+  /// filesystem (if read_block_size is not 0). Further fetches are queued.
+  int32_t max_concurrent_fetches = 16;
+
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
 
@@ -94,6 +112,7 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   S3Options options() const;
 
   bool Equals(const FileSystem& other) const override;
+  std::string identity() const override;
 
   /// \cond FALSE
   using FileSystem::GetFileInfo;
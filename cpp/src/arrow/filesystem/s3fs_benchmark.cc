@@ -53,6 +53,8 @@ static const char* kEnvBucketName = "ARROW_TEST_S3_BUCKET";
 static const char* kEnvSkipSetup = "ARROW_TEST_S3_SKIP_SETUP";
 static const char* kEnvAwsRegion = "ARROW_TEST_S3_REGION";
 
+constexpr int64_t kBlockSize = 1024 * 1024;
+
 // Set up Minio and create the test bucket and files.
 class MinioFixture : public benchmark::Fixture {
  public:
@@ -112,6 +114,10 @@ class MinioFixture : public benchmark::Fixture {
     }
     options_.endpoint_override = minio_.connect_string();
     ASSERT_OK_AND_ASSIGN(fs_, S3FileSystem::Make(options_));
+
+    auto block_options = options_;
+    block_options.read_block_size = kBlockSize;
+    ASSERT_OK_AND_ASSIGN(block_fs_, S3FileSystem::Make(block_options));
   }
 
   /// Set up bucket if it doesn't exist.
@@ -175,6 +181,8 @@ class MinioFixture : public benchmark::Fixture {
   std::unique_ptr<Aws::S3::S3Client> client_;
   S3Options options_;
   std::shared_ptr<S3FileSystem> fs_;
+  // Reading through the block cache
+  std::shared_ptr<S3FileSystem> block_fs_;
 };
 
 /// Set up/tear down the AWS SDK globally.
@@ -233,6 +241,28 @@ static void ChunkedRead(benchmark::State& st, S3FileSystem* fs, const std::strin
   std::cerr << "Read the file " << total_items << " times" << std::endl;
 }
 
+constexpr int64_t kStreamChunkSize = 64 * 1024;
+
+/// Read the file sequentially in the small chunks of a streaming reader.
+static void StreamRead(benchmark::State& st, S3FileSystem* fs, const std::string& path) {
+  int64_t total_bytes = 0;
+  int total_items = 0;
+  for (auto _ : st) {
+    std::shared_ptr<io::InputStream> stream;
+    std::shared_ptr<Buffer> buf;
+    ASSERT_OK_AND_ASSIGN(stream, fs->OpenInputStream(path));
+    total_items += 1;
+
+    do {
+      ASSERT_OK_AND_ASSIGN(buf, stream->Read(kStreamChunkSize));
+      total_bytes += buf->size();
+    } while (buf->size() > 0);
+  }
+  st.SetBytesProcessed(total_bytes);
+  st.SetItemsProcessed(total_items);
+  std::cerr << "Read the file " << total_items << " times" << std::endl;
+}
+
 /// Read the file in small chunks, but using read coalescing.
 static void CoalescedRead(benchmark::State& st, S3FileSystem* fs,
                           const std::string& path) {
@@ -322,6 +352,24 @@ BENCHMARK_DEFINE_F(MinioFixture, ReadChunked500Mib)(benchmark::State& st) {
 }
 BENCHMARK_REGISTER_F(MinioFixture, ReadChunked500Mib)->UseRealTime();
 
+BENCHMARK_DEFINE_F(MinioFixture, ReadChunkedBlocks100Mib)(benchmark::State& st) {
+  ChunkedRead(st, block_fs_.get(), bucket_ + "/bytes_100mib");
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadChunkedBlocks100Mib)->UseRealTime();
+BENCHMARK_DEFINE_F(MinioFixture, ReadChunkedBlocks500Mib)(benchmark::State& st) {
+  ChunkedRead(st, block_fs_.get(), bucket_ + "/bytes_500mib");
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadChunkedBlocks500Mib)->UseRealTime();
+
+BENCHMARK_DEFINE_F(MinioFixture, ReadStream100Mib)(benchmark::State& st) {
+  StreamRead(st, fs_.get(), bucket_ + "/bytes_100mib");
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadStream100Mib)->UseRealTime();
+BENCHMARK_DEFINE_F(MinioFixture, ReadStreamBlocks100Mib)(benchmark::State& st) {
+  StreamRead(st, block_fs_.get(), bucket_ + "/bytes_100mib");
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadStreamBlocks100Mib)->UseRealTime();
+
 BENCHMARK_DEFINE_F(MinioFixture, ReadCoalesced100Mib)(benchmark::State& st) {
   CoalescedRead(st, fs_.get(), bucket_ + "/bytes_100mib");
 }
@@ -335,6 +383,10 @@ BENCHMARK_DEFINE_F(MinioFixture, ReadParquet250K)(benchmark::State& st) {
   ParquetRead(st, fs_.get(), bucket_ + "/pq_c100_r250k");
 }
 BENCHMARK_REGISTER_F(MinioFixture, ReadParquet250K)->UseRealTime();
+BENCHMARK_DEFINE_F(MinioFixture, ReadParquetBlocks250K)(benchmark::State& st) {
+  ParquetRead(st, block_fs_.get(), bucket_ + "/pq_c100_r250k");
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadParquetBlocks250K)->UseRealTime();
 
 }  // namespace fs
 }  // namespace arrow
@@ -19,6 +19,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -253,6 +254,48 @@ class TestS3FS : public S3TestMixin {
     ASSERT_OK_AND_ASSIGN(fs_, S3FileSystem::Make(options_));
   }
 
+  void TestOpenInputFile() {
+    std::shared_ptr<io::RandomAccessFile> file;
+    std::shared_ptr<Buffer> buf;
+
+    // Nonexistent
+    ASSERT_RAISES(IOError, fs_->OpenInputFile("nonexistent-bucket/somefile"));
+    ASSERT_RAISES(IOError, fs_->OpenInputFile("bucket/zzzt"));
+
+    // "Files"
+    ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+    ASSERT_OK_AND_EQ(9, file->GetSize());
+    ASSERT_OK_AND_ASSIGN(buf, file->Read(4));
+    AssertBufferEqual(*buf, "some");
+    ASSERT_OK_AND_EQ(9, file->GetSize());
+    ASSERT_OK_AND_EQ(4, file->Tell());
+
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(2, 5));
+    AssertBufferEqual(*buf, "me da");
+    ASSERT_OK_AND_EQ(4, file->Tell());
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(5, 20));
+    AssertBufferEqual(*buf, "data");
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(9, 20));
+    AssertBufferEqual(*buf, "");
+
+    char result[10];
+    ASSERT_OK_AND_EQ(5, file->ReadAt(2, 5, &result));
+    ASSERT_OK_AND_EQ(4, file->ReadAt(5, 20, &result));
+    ASSERT_OK_AND_EQ(0, file->ReadAt(9, 0, &result));
+
+    // Reading past end of file
+    ASSERT_RAISES(IOError, file->ReadAt(10, 20));
+
+    ASSERT_OK(file->Seek(5));
+    ASSERT_OK_AND_ASSIGN(buf, file->Read(2));
+    AssertBufferEqual(*buf, "da");
+    ASSERT_OK(file->Seek(9));
+    ASSERT_OK_AND_ASSIGN(buf, file->Read(2));
+    AssertBufferEqual(*buf, "");
+    // Seeking past end of file
+    ASSERT_RAISES(IOError, file->Seek(10));
+  }
+
   void TestOpenOutputStream() {
     std::shared_ptr<io::OutputStream> stream;
 
@@ -635,46 +678,71 @@ TEST_F(TestS3FS, OpenInputStream) {
   ASSERT_RAISES(IOError, fs_->OpenInputStream("bucket"));
 }
 
-TEST_F(TestS3FS, OpenInputFile) {
-  std::shared_ptr<io::RandomAccessFile> file;
-  std::shared_ptr<Buffer> buf;
+TEST_F(TestS3FS, OpenInputFile) { TestOpenInputFile(); }
 
-  // Nonexistent
-  ASSERT_RAISES(IOError, fs_->OpenInputFile("nonexistent-bucket/somefile"));
-  ASSERT_RAISES(IOError, fs_->OpenInputFile("bucket/zzzt"));
+TEST_F(TestS3FS, OpenInputFileBlockCache) {
+  options_.read_block_size = 4;
+  options_.max_readahead = 8;
+  options_.read_cache_blocks = 2;
+  MakeFileSystem();
+  TestOpenInputFile();
+}
 
-  // "Files"
-  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
-  ASSERT_OK_AND_EQ(9, file->GetSize());
-  ASSERT_OK_AND_ASSIGN(buf, file->Read(4));
-  AssertBufferEqual(*buf, "some");
-  ASSERT_OK_AND_EQ(9, file->GetSize());
-  ASSERT_OK_AND_EQ(4, file->Tell());
-
-  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(2, 5));
+TEST_F(TestS3FS, OpenInputStreamBlockCache) {
+  options_.read_block_size = 3;
+  MakeFileSystem();
+
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(2));
+  AssertBufferEqual(*buf, "so");
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(5));
   AssertBufferEqual(*buf, "me da");
-  ASSERT_OK_AND_EQ(4, file->Tell());
-  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(5, 20));
-  AssertBufferEqual(*buf, "data");
-  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(9, 20));
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(5));
+  AssertBufferEqual(*buf, "ta");
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(5));
   AssertBufferEqual(*buf, "");
+}
+
+TEST_F(TestS3FS, ReadBlocksConcurrently) {
+  // A large object, read through many blocks in bursts of random and sequential reads
+  const std::string contents = random_string(3000000, /*seed =*/42);
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenOutputStream("bucket/largefile"));
+  ASSERT_OK(stream->Write(contents));
+  ASSERT_OK(stream->Close());
 
-  char result[10];
-  ASSERT_OK_AND_EQ(5, file->ReadAt(2, 5, &result));
-  ASSERT_OK_AND_EQ(4, file->ReadAt(5, 20, &result));
-  ASSERT_OK_AND_EQ(0, file->ReadAt(9, 0, &result));
+  options_.read_block_size = 64 * 1024;
+  options_.max_readahead = 512 * 1024;
+  MakeFileSystem();
 
-  // Reading past end of file
-  ASSERT_RAISES(IOError, file->ReadAt(10, 20));
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/largefile"));
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(contents.size()), file->GetSize());
 
-  ASSERT_OK(file->Seek(5));
-  ASSERT_OK_AND_ASSIGN(buf, file->Read(2));
-  AssertBufferEqual(*buf, "da");
-  ASSERT_OK(file->Seek(9));
-  ASSERT_OK_AND_ASSIGN(buf, file->Read(2));
-  AssertBufferEqual(*buf, "");
-  // Seeking past end of file
-  ASSERT_RAISES(IOError, file->Seek(10));
+  // A read spanning many blocks
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(1000, 2000000));
+  AssertBufferEqual(*buf, contents.substr(1000, 2000000));
+
+  // Sequential reads
+  std::string read;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(buf, file->Read(100000));
+    if (buf->size() == 0) break;
+    read += buf->ToString();
+  }
+  ASSERT_EQ(read, contents);
+
+  // Concurrent random reads
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&, i] {
+      for (int64_t offset = i * 12345; offset < 2900000; offset += 299999) {
+        ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(offset, 70000));
+        AssertBufferEqual(*buf, contents.substr(offset, 70000));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
 }
 
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
@@ -20,12 +20,16 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #ifdef GRPCPP_PP_INCLUDE
 #include <grpcpp/grpcpp.h>
@@ -42,6 +46,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 
 #include "arrow/flight/client_auth.h"
@@ -50,6 +55,7 @@
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/middleware_internal.h"
 #include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 namespace pb = arrow::flight::protocol;
@@ -180,6 +186,8 @@ class GrpcClientInterceptorAdapterFactory
       flight_method = FlightMethod::DoAction;
     } else if (method.ends_with("/ListActions")) {
       flight_method = FlightMethod::ListActions;
+    } else if (method.ends_with("/DoExchange")) {
+      flight_method = FlightMethod::DoExchange;
     } else {
       DCHECK(false) << "Unknown Flight method: " << info->method();
     }
@@ -252,32 +260,17 @@ class GrpcClientAuthReader : public ClientAuthReader {
 // additional method to get both the record batch and application
 // metadata.
 
-class GrpcIpcMessageReader;
-class GrpcStreamReader : public FlightStreamReader {
- public:
-  GrpcStreamReader();
-
-  static Status Open(std::unique_ptr<ClientRpc> rpc,
-                     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
-                     std::unique_ptr<GrpcStreamReader>* out);
-  std::shared_ptr<Schema> schema() const override;
-  Status Next(FlightStreamChunk* out) override;
-  void Cancel() override;
-
- private:
-  friend class GrpcIpcMessageReader;
-  std::shared_ptr<ipc::RecordBatchReader> batch_reader_;
-  std::shared_ptr<Buffer> last_app_metadata_;
-  std::shared_ptr<ClientRpc> rpc_;
-};
-
+// Reads from a DoGet (ClientReader) or DoExchange (ClientReaderWriter) stream
+template <typename Stream>
 class GrpcIpcMessageReader : public ipc::MessageReader {
  public:
-  GrpcIpcMessageReader(GrpcStreamReader* reader, std::shared_ptr<ClientRpc> rpc,
-                       std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream)
-      : flight_reader_(reader),
-        rpc_(rpc),
+  GrpcIpcMessageReader(std::shared_ptr<ClientRpc> rpc, std::shared_ptr<Stream> stream,
+                       std::shared_ptr<internal::SharedMemorySegment> segment,
+                       std::shared_ptr<Buffer>* last_app_metadata)
+      : rpc_(rpc),
         stream_(std::move(stream)),
+        segment_(std::move(segment)),
+        last_app_metadata_(last_app_metadata),
         stream_finished_(false) {}
 
   ::arrow::Result<std::unique_ptr<ipc::Message>> ReadNextMessage() override {
@@ -291,7 +284,7 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
     // TODO: Use Result APIs
     if (stream_finished_) {
       *out = nullptr;
-      flight_reader_->last_app_metadata_ = nullptr;
+      *last_app_metadata_ = nullptr;
       return Status::OK();
     }
     internal::FlightData data;
@@ -299,19 +292,39 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
       // Stream is completed
       stream_finished_ = true;
       *out = nullptr;
-      flight_reader_->last_app_metadata_ = nullptr;
+      *last_app_metadata_ = nullptr;
       return OverrideWithServerError(Status::OK());
     }
+    if (segment_) {
+      // The server maps the segment before writing any message, so its name
+      // is no longer needed
+      segment_->Unlink();
+    }
+    if (data.shared_memory_offset >= 0) {
+      auto st = GetSharedMemoryBody(&data);
+      if (!st.ok()) {
+        *last_app_metadata_ = nullptr;
+        return OverrideWithServerError(std::move(st));
+      }
+    }
     // Validate IPC message
     auto st = data.OpenMessage(out);
     if (!st.ok()) {
-      flight_reader_->last_app_metadata_ = nullptr;
+      *last_app_metadata_ = nullptr;
       return OverrideWithServerError(std::move(st));
     }
-    flight_reader_->last_app_metadata_ = data.app_metadata;
+    *last_app_metadata_ = data.app_metadata;
     return Status::OK();
   }
 
+  Status GetSharedMemoryBody(internal::FlightData* data) {
+    if (!segment_) {
+      return Status::IOError("Server sent a shared memory body, but none was offered");
+    }
+    return segment_->GetBody(data->shared_memory_offset, data->shared_memory_length)
+        .Value(&data->body);
+  }
+
   Status OverrideWithServerError(Status&& st) {
     // Get the gRPC status if not OK, to propagate any server error message
     RETURN_NOT_OK(internal::FromGrpcStatus(stream_->Finish(), &rpc_->context));
@@ -319,33 +332,63 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
   }
 
  private:
-  GrpcStreamReader* flight_reader_;
   // The RPC context lifetime must be coupled to the ClientReader
   std::shared_ptr<ClientRpc> rpc_;
-  std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream_;
+  std::shared_ptr<Stream> stream_;
+  // The segment offered to the server, if any
+  std::shared_ptr<internal::SharedMemorySegment> segment_;
+  std::shared_ptr<Buffer>* last_app_metadata_;
   bool stream_finished_;
 };
 
-GrpcStreamReader::GrpcStreamReader() {}
-
-Status GrpcStreamReader::Open(std::unique_ptr<ClientRpc> rpc,
-                              std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
-                              std::unique_ptr<GrpcStreamReader>* out) {
-  *out = std::unique_ptr<GrpcStreamReader>(new GrpcStreamReader);
-  out->get()->rpc_ = std::move(rpc);
-  auto reader = std::unique_ptr<ipc::MessageReader>(
-      new GrpcIpcMessageReader(out->get(), out->get()->rpc_, std::move(stream)));
-  ARROW_ASSIGN_OR_RAISE((*out)->batch_reader_,
-                        ipc::RecordBatchStreamReader::Open(std::move(reader)));
-  return Status::OK();
+class GrpcStreamReader : public FlightStreamReader {
+ public:
+  template <typename Stream>
+  static void Open(std::shared_ptr<ClientRpc> rpc, std::shared_ptr<Stream> stream,
+                   std::shared_ptr<internal::SharedMemorySegment> segment,
+                   std::unique_ptr<GrpcStreamReader>* out) {
+    out->reset(new GrpcStreamReader(rpc));
+    (*out)->message_reader_.reset(new GrpcIpcMessageReader<Stream>(
+        std::move(rpc), std::move(stream), std::move(segment),
+        &(*out)->last_app_metadata_));
+  }
+
+  /// Read the schema message, which is done on first use so that a
+  /// DoExchange server may read input before sending its results
+  Status EnsureDataStarted() const;
+
+  std::shared_ptr<Schema> schema() const override;
+  Status Next(FlightStreamChunk* out) override;
+  void Cancel() override;
+
+ private:
+  explicit GrpcStreamReader(std::shared_ptr<ClientRpc> rpc) : rpc_(std::move(rpc)) {}
+
+  mutable std::unique_ptr<ipc::MessageReader> message_reader_;
+  mutable std::shared_ptr<ipc::RecordBatchReader> batch_reader_;
+  mutable Status start_status_;
+  std::shared_ptr<Buffer> last_app_metadata_;
+  std::shared_ptr<ClientRpc> rpc_;
+};
+
+Status GrpcStreamReader::EnsureDataStarted() const {
+  if (message_reader_) {
+    start_status_ = ipc::RecordBatchStreamReader::Open(std::move(message_reader_))
+                        .Value(&batch_reader_);
+  }
+  return start_status_;
 }
 
 std::shared_ptr<Schema> GrpcStreamReader::schema() const {
+  if (!EnsureDataStarted().ok()) {
+    return nullptr;
+  }
   return batch_reader_->schema();
 }
 
 Status GrpcStreamReader::Next(FlightStreamChunk* out) {
   out->app_metadata = nullptr;
+  RETURN_NOT_OK(EnsureDataStarted());
   RETURN_NOT_OK(batch_reader_->ReadNext(&out->data));
   out->app_metadata = std::move(last_app_metadata_);
   return Status::OK();
@@ -359,22 +402,39 @@ void GrpcStreamReader::Cancel() { rpc_->context.TryCancel(); }
 // GrpcStreamWriter. GrpcStreamWriter updates a metadata field on
 // write; DoPutPayloadWriter reads that metadata field to determine
 // what to write.
+//
+// Both are used for DoPut and DoExchange streams: ProtoReadT is the type of
+// the messages read back from the server (PutResult or FlightData).
 
+template <typename ProtoReadT>
 class DoPutPayloadWriter;
+template <typename ProtoReadT>
 class GrpcStreamWriter : public FlightStreamWriter {
  public:
+  using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
+
   ~GrpcStreamWriter() override = default;
 
-  explicit GrpcStreamWriter(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer)
+  explicit GrpcStreamWriter(std::shared_ptr<GrpcStream> writer)
       : app_metadata_(nullptr), batch_writer_(nullptr), writer_(writer) {}
 
-  static Status Open(
-      const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-      std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-      std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      std::unique_ptr<FlightStreamWriter>* out);
+  static Status Open(const FlightDescriptor& descriptor,
+                     const std::shared_ptr<Schema>& schema,
+                     std::shared_ptr<ClientRpc> rpc,
+                     std::unique_ptr<pb::PutResult> response,
+                     std::shared_ptr<std::mutex> read_mutex,
+                     std::shared_ptr<GrpcStream> writer,
+                     std::unique_ptr<FlightStreamWriter>* out) {
+    std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(writer));
+    std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+        new DoPutPayloadWriter<ProtoReadT>(descriptor, std::move(rpc),
+                                           std::move(response), read_mutex, writer,
+                                           result.get()));
+    ARROW_ASSIGN_OR_RAISE(result->batch_writer_, ipc::internal::OpenRecordBatchWriter(
+                                                     std::move(payload_writer), schema));
+    *out = std::move(result);
+    return Status::OK();
+  }
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
     return WriteWithMetadata(batch, nullptr);
@@ -397,21 +457,24 @@ class GrpcStreamWriter : public FlightStreamWriter {
   Status Close() override { return batch_writer_->Close(); }
 
  private:
-  friend class DoPutPayloadWriter;
+  friend class DoPutPayloadWriter<ProtoReadT>;
   std::shared_ptr<Buffer> app_metadata_;
   std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<GrpcStream> writer_;
   bool done_writing_ = false;
 };
 
-/// A IpcPayloadWriter implementation that writes to a DoPut stream
+/// A IpcPayloadWriter implementation that writes to a DoPut or DoExchange stream
+template <typename ProtoReadT>
 class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
  public:
-  DoPutPayloadWriter(
-      const FlightDescriptor& descriptor, std::unique_ptr<ClientRpc> rpc,
-      std::unique_ptr<pb::PutResult> response, std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      GrpcStreamWriter* stream_writer)
+  using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
+
+  DoPutPayloadWriter(const FlightDescriptor& descriptor, std::shared_ptr<ClientRpc> rpc,
+                     std::unique_ptr<pb::PutResult> response,
+                     std::shared_ptr<std::mutex> read_mutex,
+                     std::shared_ptr<GrpcStream> writer,
+                     GrpcStreamWriter<ProtoReadT>* stream_writer)
       : descriptor_(descriptor),
         rpc_(std::move(rpc)),
         response_(std::move(response)),
@@ -456,15 +519,33 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
 
   Status Close() override {
     bool finished_writes = stream_writer_->done_writing_ ? true : writer_->WritesDone();
+    return FinishWrites(finished_writes, writer_.get());
+  }
+
+ protected:
+  // DoPut: drain the metadata sent back and get the status of the call
+  Status FinishWrites(bool finished_writes,
+                      grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer) {
     // Drain the read side to avoid hanging
     std::unique_lock<std::mutex> guard(*read_mutex_, std::try_to_lock);
     if (!guard.owns_lock()) {
       return Status::IOError("Cannot close stream with pending read operation.");
     }
     pb::PutResult message;
-    while (writer_->Read(&message)) {
+    while (writer->Read(&message)) {
     }
-    RETURN_NOT_OK(internal::FromGrpcStatus(writer_->Finish(), &rpc_->context));
+    RETURN_NOT_OK(internal::FromGrpcStatus(writer->Finish(), &rpc_->context));
+    if (!finished_writes) {
+      return Status::UnknownError(
+          "Could not finish writing record batches before closing");
+    }
+    return Status::OK();
+  }
+
+  // DoExchange: the results are still to be read, and the reader gets the
+  // status of the call once it reaches their end
+  Status FinishWrites(bool finished_writes,
+                      grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>*) {
     if (!finished_writes) {
       return Status::UnknownError(
           "Could not finish writing record batches before closing");
@@ -472,32 +553,16 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
     return Status::OK();
   }
 
- protected:
   // TODO: there isn't a way to access this as a user.
   const FlightDescriptor descriptor_;
-  std::unique_ptr<ClientRpc> rpc_;
+  std::shared_ptr<ClientRpc> rpc_;
   std::unique_ptr<pb::PutResult> response_;
   std::shared_ptr<std::mutex> read_mutex_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<GrpcStream> writer_;
   bool first_payload_;
-  GrpcStreamWriter* stream_writer_;
+  GrpcStreamWriter<ProtoReadT>* stream_writer_;
 };
 
-Status GrpcStreamWriter::Open(
-    const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-    std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-    std::shared_ptr<std::mutex> read_mutex,
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-    std::unique_ptr<FlightStreamWriter>* out) {
-  std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(writer));
-  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(new DoPutPayloadWriter(
-      descriptor, std::move(rpc), std::move(response), read_mutex, writer, result.get()));
-  ARROW_ASSIGN_OR_RAISE(result->batch_writer_, ipc::internal::OpenRecordBatchWriter(
-                                                   std::move(payload_writer), schema));
-  *out = std::move(result);
-  return Status::OK();
-}
-
 FlightMetadataReader::~FlightMetadataReader() = default;
 
 class GrpcMetadataReader : public FlightMetadataReader {
@@ -529,6 +594,11 @@ class FlightClient::FlightClientImpl {
   Status Connect(const Location& location, const FlightClientOptions& options) {
     const std::string& scheme = location.scheme();
 
+    if (options.shared_memory_size < 0) {
+      return Status::Invalid("Shared memory size must not be negative");
+    }
+    shared_memory_size_ = options.shared_memory_size;
+
     std::stringstream grpc_uri;
     std::shared_ptr<grpc::ChannelCredentials> creds;
     if (scheme == kSchemeGrpc || scheme == kSchemeGrpcTcp || scheme == kSchemeGrpcTls) {
@@ -700,11 +770,25 @@ class FlightClient::FlightClientImpl {
 
     std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream(
+
+    std::shared_ptr<internal::SharedMemorySegment> segment;
+    if (shared_memory_size_ > 0) {
+      // If no segment can be created, bodies are simply sent through gRPC
+      auto maybe_segment = internal::SharedMemorySegment::Create(shared_memory_size_);
+      if (maybe_segment.ok()) {
+        segment = std::move(maybe_segment).ValueOrDie();
+        rpc->context.AddMetadata(internal::kGrpcSharedMemoryHeader, segment->name());
+      }
+    }
+
+    std::shared_ptr<grpc::ClientReader<pb::FlightData>> stream(
         stub_->DoGet(&rpc->context, pb_ticket));
 
     std::unique_ptr<GrpcStreamReader> reader;
-    RETURN_NOT_OK(GrpcStreamReader::Open(std::move(rpc), std::move(stream), &reader));
+    GrpcStreamReader::Open(std::shared_ptr<ClientRpc>(std::move(rpc)), std::move(stream),
+                           std::move(segment), &reader);
+    // Read the schema now to report errors from the server
+    RETURN_NOT_OK(reader->EnsureDataStarted());
     *out = std::move(reader);
     return Status::OK();
   }
@@ -722,15 +806,226 @@ class FlightClient::FlightClientImpl {
     std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
     *reader =
         std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(writer, read_mutex));
-    return GrpcStreamWriter::Open(descriptor, schema, std::move(rpc), std::move(response),
-                                  read_mutex, writer, out);
+    return GrpcStreamWriter<pb::PutResult>::Open(descriptor, schema, std::move(rpc),
+                                                 std::move(response), read_mutex,
+                                                 writer, out);
+  }
+
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>;
+
+    std::shared_ptr<ClientRpc> rpc(new ClientRpc(options));
+    RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    // The reader and writer may be destroyed in any order, so the stream
+    // keeps the RPC context alive
+    std::shared_ptr<GrpcStream> stream(stub_->DoExchange(&rpc->context).release(),
+                                       [rpc](GrpcStream* stream) { delete stream; });
+
+    std::unique_ptr<GrpcStreamReader> stream_reader;
+    GrpcStreamReader::Open(rpc, stream, nullptr, &stream_reader);
+    RETURN_NOT_OK(GrpcStreamWriter<pb::FlightData>::Open(descriptor, schema, rpc, nullptr,
+                                                         nullptr, stream, writer));
+    *reader = std::move(stream_reader);
+    return Status::OK();
   }
 
  private:
   std::unique_ptr<pb::FlightService::Stub> stub_;
   std::shared_ptr<ClientAuthHandler> auth_handler_;
+  int64_t shared_memory_size_ = 0;
+};
+
+namespace {
+
+// The batches of the endpoints of a flight, shared by the reader returned by
+// DoGetEndpoints and the threads reading the endpoints
+class EndpointStreamsState {
+ public:
+  EndpointStreamsState(size_t num_endpoints, const FlightEndpointsReadOptions& options)
+      : ordered_(options.ordered),
+        max_buffered_batches_(static_cast<size_t>(options.max_buffered_batches)),
+        queues_(ordered_ ? num_endpoints : 1),
+        streams_(num_endpoints),
+        finished_(num_endpoints, false) {}
+
+  // Keep the stream of an endpoint so that Stop() can cancel it. Return
+  // nullptr if the reader was already destroyed.
+  FlightStreamReader* AddStream(size_t index,
+                                std::unique_ptr<FlightStreamReader> stream) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      stream->Cancel();
+      return nullptr;
+    }
+    streams_[index] = std::move(stream);
+    return streams_[index].get();
+  }
+
+  // Buffer a batch, waiting for space. Return false if the reader was
+  // destroyed in the meantime.
+  bool Push(size_t index, std::shared_ptr<RecordBatch> batch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto& queue = queues_[ordered_ ? index : 0];
+    producer_cv_.wait(lock,
+                      [&] { return stopped_ || queue.size() < max_buffered_batches_; });
+    if (stopped_) {
+      return false;
+    }
+    queue.push_back(std::move(batch));
+    consumer_cv_.notify_one();
+    return true;
+  }
+
+  void Finish(size_t index, const Status& status) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_[index] = true;
+    ++num_finished_;
+    if (!status.ok() && status_.ok()) {
+      status_ = status.WithMessage("Failed to read endpoint ", index, ": ",
+                                   status.message());
+    }
+    streams_[index].reset();
+    consumer_cv_.notify_one();
+  }
+
+  bool stopped() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stopped_;
+  }
+
+  void Stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    for (const auto& stream : streams_) {
+      if (stream) stream->Cancel();
+    }
+    producer_cv_.notify_all();
+  }
+
+  Status Next(std::shared_ptr<RecordBatch>* out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      if (!status_.ok()) {
+        return status_;
+      }
+      if (current_ == finished_.size()) {
+        // All endpoints were read
+        *out = nullptr;
+        return Status::OK();
+      }
+      auto& queue = queues_[ordered_ ? current_ : 0];
+      if (!queue.empty()) {
+        *out = std::move(queue.front());
+        queue.pop_front();
+        producer_cv_.notify_all();
+        return Status::OK();
+      }
+      if (ordered_ && finished_[current_]) {
+        ++current_;
+      } else if (!ordered_ && num_finished_ == finished_.size()) {
+        current_ = finished_.size();
+      } else {
+        consumer_cv_.wait(lock);
+      }
+    }
+  }
+
+ private:
+  const bool ordered_;
+  const size_t max_buffered_batches_;
+
+  std::mutex mutex_;
+  std::condition_variable consumer_cv_;
+  std::condition_variable producer_cv_;
+  // The buffered batches of each endpoint, or of all endpoints if unordered
+  std::vector<std::deque<std::shared_ptr<RecordBatch>>> queues_;
+  std::vector<std::unique_ptr<FlightStreamReader>> streams_;
+  std::vector<bool> finished_;
+  size_t num_finished_ = 0;
+  // The endpoint being returned if ordered
+  size_t current_ = 0;
+  Status status_;
+  bool stopped_ = false;
 };
 
+Status ReadEndpoint(FlightClient* client, const FlightCallOptions& options,
+                    const Ticket& ticket, const Schema& schema, size_t index,
+                    EndpointStreamsState* state) {
+  if (state->stopped()) {
+    return Status::OK();
+  }
+  std::unique_ptr<FlightStreamReader> stream;
+  RETURN_NOT_OK(client->DoGet(options, ticket, &stream));
+  if (!stream->schema()->Equals(schema, /*check_metadata=*/false)) {
+    return Status::Invalid("Endpoint has schema ", stream->schema()->ToString(),
+                           " instead of the flight schema ", schema.ToString());
+  }
+  FlightStreamReader* reader = state->AddStream(index, std::move(stream));
+  if (reader == nullptr) {
+    return Status::OK();
+  }
+  // Receive and decode on this thread while the consumer handles previous
+  // batches
+  FlightStreamChunk chunk;
+  while (true) {
+    RETURN_NOT_OK(reader->Next(&chunk));
+    if (chunk.data == nullptr || !state->Push(index, std::move(chunk.data))) {
+      return Status::OK();
+    }
+  }
+}
+
+class EndpointStreamsReader : public RecordBatchReader {
+ public:
+  EndpointStreamsReader(std::shared_ptr<Schema> schema,
+                        std::shared_ptr<EndpointStreamsState> state)
+      : schema_(std::move(schema)), state_(std::move(state)) {}
+
+  ~EndpointStreamsReader() override {
+    state_->Stop();
+    // Destroying the pool waits for the threads reading endpoints to exit
+    thread_pool_.reset();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    return state_->Next(batch);
+  }
+
+  Status Start(FlightClient* client, const FlightCallOptions& options,
+               const std::vector<FlightEndpoint>& endpoints, int parallelism) {
+    if (endpoints.empty()) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        thread_pool_,
+        ::arrow::internal::ThreadPool::Make(
+            static_cast<int>(std::min<size_t>(parallelism, endpoints.size()))));
+    // Endpoints start in order, so the one returned next when ordered is
+    // always being read
+    for (size_t i = 0; i < endpoints.size(); ++i) {
+      const Ticket& ticket = endpoints[i].ticket;
+      auto schema = schema_;
+      auto state = state_;
+      RETURN_NOT_OK(thread_pool_->Spawn([client, options, ticket, schema, state, i] {
+        state->Finish(i, ReadEndpoint(client, options, ticket, *schema, i, state.get()));
+      }));
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<EndpointStreamsState> state_;
+  std::shared_ptr<::arrow::internal::ThreadPool> thread_pool_;
+};
+
+}  // namespace
+
 FlightClient::FlightClient() { impl_.reset(new FlightClientImpl); }
 
 FlightClient::~FlightClient() {}
@@ -788,6 +1083,28 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::DoGetEndpoints(const FlightCallOptions& options,
+                                    const FlightInfo& info,
+                                    const FlightEndpointsReadOptions& read_options,
+                                    std::shared_ptr<RecordBatchReader>* reader) {
+  if (read_options.parallelism < 1) {
+    return Status::Invalid("Parallelism must be at least 1");
+  }
+  if (read_options.max_buffered_batches < 1) {
+    return Status::Invalid("Must buffer at least 1 batch");
+  }
+  ipc::DictionaryMemo dictionary_memo;
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(info.GetSchema(&dictionary_memo, &schema));
+
+  const auto& endpoints = info.endpoints();
+  auto state = std::make_shared<EndpointStreamsState>(endpoints.size(), read_options);
+  auto result = std::make_shared<EndpointStreamsReader>(std::move(schema), state);
+  RETURN_NOT_OK(result->Start(this, options, endpoints, read_options.parallelism));
+  *reader = std::move(result);
+  return Status::OK();
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
@@ -796,5 +1113,13 @@ Status FlightClient::DoPut(const FlightCallOptions& options,
   return impl_->DoPut(options, descriptor, schema, stream, reader);
 }
 
+Status FlightClient::DoExchange(const FlightCallOptions& options,
+                                const FlightDescriptor& descriptor,
+                                const std::shared_ptr<Schema>& schema,
+                                std::unique_ptr<FlightStreamWriter>* writer,
+                                std::unique_ptr<FlightStreamReader>* reader) {
+  return impl_->DoExchange(options, descriptor, schema, writer, reader);
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -37,6 +37,7 @@ namespace arrow {
 
 class MemoryPool;
 class RecordBatch;
+class RecordBatchReader;
 class Schema;
 
 namespace flight {
@@ -69,6 +70,31 @@ class ARROW_FLIGHT_EXPORT FlightClientOptions {
   std::string override_hostname;
   /// \brief A list of client middleware to apply.
   std::vector<std::shared_ptr<ClientMiddlewareFactory>> middleware;
+  /// \brief The size in bytes of a shared memory segment to offer the
+  /// server in DoGet calls, or 0 to not offer one.
+  ///
+  /// A server on the same host which enables shared memory writes record
+  /// batch bodies to the segment once and sends only their location through
+  /// gRPC. Bodies are read without copying and their space is reused once
+  /// the batches are released; when the segment is full, or the server is
+  /// remote, bodies are sent through gRPC as usual.
+  int64_t shared_memory_size = 0;
+};
+
+/// \brief Options for reading all the endpoints of a flight with
+/// FlightClient::DoGetEndpoints.
+class ARROW_FLIGHT_EXPORT FlightEndpointsReadOptions {
+ public:
+  /// \brief The maximum number of endpoints read concurrently. Each
+  /// endpoint being read has a thread receiving and decoding its batches.
+  int parallelism = 4;
+  /// \brief Return the batches in the order of the endpoints, rather than
+  /// as soon as they are decoded.
+  bool ordered = true;
+  /// \brief The maximum number of decoded batches buffered per endpoint if
+  /// ordered, or across all endpoints if not. Reading an endpoint pauses
+  /// while its buffer is full.
+  int64_t max_buffered_batches = 16;
 };
 
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
@@ -217,6 +243,27 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Read the data of all the endpoints of a flight concurrently.
+  ///
+  /// The tickets of the endpoints are redeemed with this client, which must
+  /// outlive the returned reader; the locations of the endpoints are not
+  /// used. Destroying the reader cancels the streams still being read.
+  ///
+  /// \param[in] options Per-RPC options, used for every endpoint
+  /// \param[in] info the flight to read, whose schema must be that of all
+  /// its endpoints
+  /// \param[in] read_options how the endpoints are read
+  /// \param[out] reader a reader returning the batches of all the endpoints
+  /// \return Status
+  Status DoGetEndpoints(const FlightCallOptions& options, const FlightInfo& info,
+                        const FlightEndpointsReadOptions& read_options,
+                        std::shared_ptr<RecordBatchReader>* reader);
+  Status DoGetEndpoints(const FlightInfo& info,
+                        const FlightEndpointsReadOptions& read_options,
+                        std::shared_ptr<RecordBatchReader>* reader) {
+    return DoGetEndpoints({}, info, read_options, reader);
+  }
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
@@ -241,6 +288,32 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoPut({}, descriptor, schema, stream, reader);
   }
 
+  /// \brief Connect to a bidirectional stream: upload data to the server
+  /// and read the data it sends back.
+  ///
+  /// The server may send results while data is still being uploaded. As
+  /// with DoPut, the schema and descriptor are sent with the first batch or
+  /// on Close(). Use \a DoneWriting or Close() on the writer once done
+  /// uploading, then read the results to their end to get the final status
+  /// of the call.
+  ///
+  /// \param[in] options Per-RPC options
+  /// \param[in] descriptor the descriptor of the stream
+  /// \param[in] schema the schema for the data to upload
+  /// \param[out] writer a writer to write record batches to
+  /// \param[out] reader a reader for the record batches sent back
+  /// \return Status
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader);
+  Status DoExchange(const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    return DoExchange({}, descriptor, schema, writer, reader);
+  }
+
  private:
   FlightClient();
   class FlightClientImpl;
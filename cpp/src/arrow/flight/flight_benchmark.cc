@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <ctime>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -45,6 +46,11 @@ DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int32(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_bool(shared_memory, false,
+            "Receive DoGet record batch bodies through shared memory (the server must "
+            "run on the same host, with -shared_memory if standalone)");
+DEFINE_int64(shared_memory_size, 64 << 20,
+             "Size of the shared memory segment offered for each stream");
 
 namespace perf = arrow::flight::perf;
 
@@ -203,10 +209,17 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
 
   PerformanceStats stats;
   auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
-  auto ConsumeStream = [&stats, &test_loop](const FlightEndpoint& endpoint) {
+  FlightClientOptions client_options;
+  if (FLAGS_shared_memory) {
+    client_options.shared_memory_size = FLAGS_shared_memory_size;
+  }
+
+  auto ConsumeStream = [&stats, &test_loop,
+                        &client_options](const FlightEndpoint& endpoint) {
     // TODO(wesm): Use location from endpoint, same host/port for now
     std::unique_ptr<FlightClient> client;
-    RETURN_NOT_OK(FlightClient::Connect(endpoint.locations.front(), &client));
+    RETURN_NOT_OK(
+        FlightClient::Connect(endpoint.locations.front(), client_options, &client));
 
     perf::Token token;
     token.ParseFromString(endpoint.ticket.ticket);
@@ -221,6 +234,7 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
 
   StopWatch timer;
   timer.Start();
+  const std::clock_t cpu_start = std::clock();
 
   // XXX(wesm): Serial version for debugging
   // for (const auto& endpoint : plan->endpoints()) {
@@ -243,6 +257,9 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   uint64_t elapsed_nanos = timer.Stop();
   double time_elapsed =
       static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
+  // CPU time of this process, i.e. of the clients only
+  double cpu_time = static_cast<double>(std::clock() - cpu_start) /
+                    static_cast<double>(CLOCKS_PER_SEC);
 
   constexpr double kMegabyte = static_cast<double>(1 << 20);
 
@@ -261,6 +278,10 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   std::cout << "Speed: "
             << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
             << " MB/s" << std::endl;
+  std::cout << "Client CPU time: " << cpu_time << " s" << std::endl;
+  std::cout << "Client CPU per GB: "
+            << (cpu_time / (static_cast<double>(stats.total_bytes) / (kMegabyte * 1024)))
+            << " s" << std::endl;
   return Status::OK();
 }
 
@@ -276,7 +297,11 @@ int main(int argc, char** argv) {
     std::cout << "Using standalone server: false" << std::endl;
     server.reset(
         new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
-    server->Start();
+    if (FLAGS_shared_memory) {
+      server->Start({"-shared_memory"});
+    } else {
+      server->Start();
+    }
   } else {
     std::cout << "Using standalone server: true" << std::endl;
     hostname = FLAGS_server_host;
@@ -291,7 +316,9 @@ int main(int argc, char** argv) {
   std::cout << std::endl;
 
   std::cout << "Server host: " << hostname << std::endl
-            << "Server port: " << FLAGS_server_port << std::endl;
+            << "Server port: " << FLAGS_server_port << std::endl
+            << "Shared memory: " << (FLAGS_shared_memory ? "true" : "false")
+            << std::endl;
 
   std::unique_ptr<arrow::flight::FlightClient> client;
   arrow::flight::Location location;
@@ -43,8 +43,15 @@
 
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/test_util.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace pb = arrow::flight::protocol;
 
 namespace arrow {
@@ -457,6 +464,29 @@ class MetadataTestServer : public FlightServerBase {
   }
 };
 
+// Sends each uploaded batch back as soon as it is read, along with its
+// metadata and the number of batches read so far
+class ExchangeTestServer : public FlightServerBase {
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    RETURN_NOT_OK(writer->Begin(reader->schema()));
+    FlightStreamChunk chunk;
+    int counter = 0;
+    while (true) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (chunk.data == nullptr) break;
+      std::string metadata = std::to_string(counter++);
+      if (chunk.app_metadata) {
+        metadata += ":" + chunk.app_metadata->ToString();
+      }
+      RETURN_NOT_OK(
+          writer->WriteWithMetadata(*chunk.data, Buffer::FromString(metadata)));
+    }
+    return writer->Close();
+  }
+};
+
 class TestMetadata : public ::testing::Test {
  public:
   void SetUp() {
@@ -472,6 +502,21 @@ class TestMetadata : public ::testing::Test {
   std::unique_ptr<FlightServerBase> server_;
 };
 
+class TestDoExchange : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<ExchangeTestServer>(
+        &server_, &client_, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
 class TestAuthHandler : public ::testing::Test {
  public:
   void SetUp() {
@@ -985,6 +1030,66 @@ TEST_F(TestFlightClient, DoGetDicts) {
   CheckDoGet(descr, expected_batches, check_endpoints);
 }
 
+TEST_F(TestFlightClient, DoGetEndpoints) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  FlightEndpoint endpoint({{"ticket-ints-1"}, {location}});
+  FlightInfo::Data info_data;
+  ASSERT_OK(MakeFlightInfo(*ExampleIntSchema(), FlightDescriptor::Path({"ints"}),
+                           {endpoint, endpoint, endpoint}, -1, -1, &info_data));
+  FlightInfo info(info_data);
+
+  BatchVector expected_batches;
+  for (int i = 0; i < 3; ++i) {
+    expected_batches.insert(expected_batches.end(), batches.begin(), batches.end());
+  }
+
+  for (bool ordered : {true, false}) {
+    FlightEndpointsReadOptions read_options;
+    read_options.ordered = ordered;
+    read_options.parallelism = 2;
+    read_options.max_buffered_batches = 2;
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(client_->DoGetEndpoints(info, read_options, &reader));
+    AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+
+    BatchVector read_batches;
+    ASSERT_OK(reader->ReadAll(&read_batches));
+    ASSERT_EQ(expected_batches.size(), read_batches.size());
+    if (ordered) {
+      for (size_t i = 0; i < expected_batches.size(); ++i) {
+        ASSERT_BATCHES_EQUAL(*expected_batches[i], *read_batches[i]);
+      }
+    }
+  }
+}
+
+TEST_F(TestFlightClient, DoGetEndpointsErrors) {
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  FlightEndpoint endpoint({{"ticket-ints-1"}, {location}});
+  FlightEndpoint bad_endpoint({{"ticket-unknown"}, {location}});
+  FlightInfo::Data info_data;
+  ASSERT_OK(MakeFlightInfo(*ExampleIntSchema(), FlightDescriptor::Path({"ints"}),
+                           {endpoint, bad_endpoint}, -1, -1, &info_data));
+  FlightInfo info(info_data);
+
+  FlightEndpointsReadOptions read_options;
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(client_->DoGetEndpoints(info, read_options, &reader));
+  BatchVector read_batches;
+  ASSERT_RAISES(NotImplemented, reader->ReadAll(&read_batches));
+
+  // Destroying a reader before the end cancels the endpoints being read
+  ASSERT_OK(client_->DoGetEndpoints(info, read_options, &reader));
+  reader.reset();
+
+  read_options.parallelism = 0;
+  ASSERT_RAISES(Invalid, client_->DoGetEndpoints(info, read_options, &reader));
+}
+
 TEST_F(TestFlightClient, ListActions) {
   std::vector<ActionType> actions;
   ASSERT_OK(client_->ListActions(&actions));
@@ -1427,6 +1532,72 @@ TEST_F(TestMetadata, DoPutReadMetadata) {
   ASSERT_OK(writer->Close());
 }
 
+TEST_F(TestDoExchange, Pipelined) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  std::shared_ptr<Schema> schema = ExampleIntSchema();
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"), schema, &writer,
+                                &reader));
+
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  // Each result is read before the next batch is written, which only
+  // completes if the server sends results while the input is still open
+  FlightStreamChunk chunk;
+  auto num_batches = static_cast<int>(expected_batches.size());
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_OK(writer->WriteWithMetadata(*expected_batches[i],
+                                        Buffer::FromString("batch" + std::to_string(i))));
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_NE(nullptr, chunk.app_metadata);
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *chunk.data);
+    ASSERT_EQ(std::to_string(i) + ":batch" + std::to_string(i),
+              chunk.app_metadata->ToString());
+  }
+  ASSERT_TRUE(reader->schema()->Equals(*schema));
+  ASSERT_OK(writer->DoneWriting());
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, Dicts) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleDictBatches(&expected_batches));
+
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"),
+                                expected_batches[0]->schema(), &writer, &reader));
+  for (const auto& batch : expected_batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+
+  BatchVector batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_EQ(expected_batches.size(), batches.size());
+  for (size_t i = 0; i < expected_batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+  }
+}
+
+TEST_F(TestDoExchange, NoInput) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  std::shared_ptr<Schema> schema = ExampleIntSchema();
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"), schema, &writer,
+                                &reader));
+  ASSERT_OK(writer->Close());
+
+  FlightStreamChunk chunk;
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_TRUE(reader->schema()->Equals(*schema));
+}
+
 TEST_F(TestRejectServerMiddleware, Rejected) {
   std::unique_ptr<FlightInfo> info;
   const auto& status = client_->GetFlightInfo(FlightDescriptor{}, &info);
@@ -1534,5 +1705,142 @@ TEST_F(TestPropagatingMiddleware, DoPut) {
   ValidateStatus(status, FlightMethod::DoPut);
 }
 
+TEST_F(TestPropagatingMiddleware, DoExchange) {
+  client_middleware_->Reset();
+  auto descr = FlightDescriptor::Path({"ints"});
+  auto a1 = ArrayFromJSON(int32(), "[4, 5, 6, null]");
+  auto schema = arrow::schema({field("f1", a1->type())});
+
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(descr, schema, &writer, &reader));
+  ASSERT_OK(writer->Close());
+  FlightStreamChunk chunk;
+  const Status status = reader->Next(&chunk);
+  ASSERT_RAISES(NotImplemented, status);
+  ValidateStatus(status, FlightMethod::DoExchange);
+}
+
+class TestSharedMemory : public ::testing::Test {
+ public:
+  void SetUp() {
+    server_ = ExampleTestServer();
+
+    Location location;
+    ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+    FlightServerOptions options(location);
+    options.enable_shared_memory = true;
+    ASSERT_OK(server_->Init(options));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+  Status ConnectClient(int64_t shared_memory_size) {
+    Location location;
+    RETURN_NOT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+    FlightClientOptions options;
+    options.shared_memory_size = shared_memory_size;
+    return FlightClient::Connect(location, options, &client_);
+  }
+
+  void CheckDoGet(const Ticket& ticket, const BatchVector& expected_batches) {
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(ticket, &stream));
+
+    // Hold on to all batches, so that small segments fill up
+    BatchVector batches;
+    FlightStreamChunk chunk;
+    while (true) {
+      ASSERT_OK(stream->Next(&chunk));
+      if (!chunk.data) break;
+      batches.push_back(chunk.data);
+    }
+
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+TEST_F(TestSharedMemory, DoGetInts) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  ASSERT_OK(ConnectClient(1 << 20));
+  CheckDoGet(Ticket{"ticket-ints-1"}, expected_batches);
+  // The space of released batches is reused
+  CheckDoGet(Ticket{"ticket-ints-1"}, expected_batches);
+}
+
+TEST_F(TestSharedMemory, DoGetDicts) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleDictBatches(&expected_batches));
+
+  ASSERT_OK(ConnectClient(1 << 20));
+  CheckDoGet(Ticket{"ticket-dicts-1"}, expected_batches);
+}
+
+TEST_F(TestSharedMemory, SegmentFull) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  // Bodies which do not fit are sent through gRPC
+  ASSERT_OK(ConnectClient(1024));
+  CheckDoGet(Ticket{"ticket-ints-1"}, expected_batches);
+}
+
+TEST_F(TestSharedMemory, InvalidSize) { ASSERT_RAISES(Invalid, ConnectClient(-1)); }
+
+#ifndef _WIN32
+TEST(SharedMemorySegment, OpenedOnce) {
+  ASSERT_OK_AND_ASSIGN(auto created, internal::SharedMemorySegment::Create(1 << 16));
+  ASSERT_OK_AND_ASSIGN(auto opened, internal::SharedMemorySegment::Open(created->name()));
+
+  // Another call naming the same segment doesn't get to allocate in it
+  ASSERT_RAISES(Invalid, internal::SharedMemorySegment::Open(created->name()));
+
+  opened.reset();
+  ASSERT_OK(internal::SharedMemorySegment::Open(created->name()));
+}
+
+TEST(SharedMemorySegment, Truncated) {
+  ASSERT_OK_AND_ASSIGN(auto created, internal::SharedMemorySegment::Create(1 << 16));
+  ASSERT_OK_AND_ASSIGN(auto opened, internal::SharedMemorySegment::Open(created->name()));
+  internal::SharedMemoryBodyWriter writer(opened);
+
+  FlightPayload payload;
+  payload.ipc_message.type = ipc::Message::RECORD_BATCH;
+  payload.ipc_message.body_buffers.push_back(std::make_shared<Buffer>("some body"));
+  ASSERT_OK_AND_ASSIGN(bool written, writer.WriteBody(&payload));
+  ASSERT_TRUE(written);
+
+  // A client shrinking its segment fails the call instead of crashing the server
+  int fd = shm_open(created->name().c_str(), O_RDWR, 0);
+  ASSERT_GE(fd, 0);
+  ASSERT_EQ(0, ftruncate(fd, 0));
+  close(fd);
+  ASSERT_RAISES(IOError, writer.WriteBody(&payload));
+}
+#endif
+
+TEST_F(TestFlightClient, DoGetOfferSharedMemory) {
+  // The server does not enable shared memory, bodies are sent through gRPC
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  FlightClientOptions options;
+  options.shared_memory_size = 1 << 20;
+  ASSERT_OK(FlightClient::Connect(location, options, &client_));
+
+  auto descr = FlightDescriptor::Path({"examples", "ints"});
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  CheckDoGet(descr, expected_batches, [](const std::vector<FlightEndpoint>&) {});
+}
+
 }  // namespace flight
 }  // namespace arrow
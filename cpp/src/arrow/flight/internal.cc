@@ -52,6 +52,7 @@ const char* kGrpcStatusCodeHeader = "x-arrow-status";
 const char* kGrpcStatusMessageHeader = "x-arrow-status-message-bin";
 const char* kGrpcStatusDetailHeader = "x-arrow-status-detail-bin";
 const char* kBinaryErrorDetailsKey = "grpc-status-details-bin";
+const char* kGrpcSharedMemoryHeader = "x-arrow-shared-memory";
 
 static Status StatusCodeFromString(const grpc::string_ref& code_ref, StatusCode* code) {
   // Bounce through std::string to get a proper null-terminated C string
@@ -82,6 +82,11 @@ extern const char* kGrpcStatusDetailHeader;
 ARROW_FLIGHT_EXPORT
 extern const char* kBinaryErrorDetailsKey;
 
+/// The name of the header used by a client to offer a shared memory segment
+/// for message bodies.
+ARROW_FLIGHT_EXPORT
+extern const char* kGrpcSharedMemoryHeader;
+
 ARROW_FLIGHT_EXPORT
 Status SchemaToString(const Schema& schema, std::string* out);
 
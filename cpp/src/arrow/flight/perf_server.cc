@@ -19,6 +19,7 @@
 
 #include <signal.h>
 #include <cstdint>
+#include <ctime>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -40,6 +41,9 @@
 
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
 DEFINE_int32(port, 31337, "Server port to listen on");
+DEFINE_bool(shared_memory, false,
+            "Write DoGet record batch bodies to shared memory segments offered by "
+            "clients on the same host");
 
 namespace perf = arrow::flight::perf;
 namespace proto = arrow::flight::protocol;
@@ -232,12 +236,18 @@ int main(int argc, char** argv) {
   arrow::flight::Location location;
   ARROW_CHECK_OK(arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
   arrow::flight::FlightServerOptions options(location);
+  options.enable_shared_memory = FLAGS_shared_memory;
 
   ARROW_CHECK_OK(g_server->Init(options));
   // Exit with a clean error code (0) on SIGTERM
   ARROW_CHECK_OK(g_server->SetShutdownOnSignals({SIGTERM}));
   std::cout << "Server host: " << FLAGS_server_host << std::endl;
   std::cout << "Server port: " << FLAGS_port << std::endl;
+  std::cout << "Shared memory: " << (FLAGS_shared_memory ? "true" : "false")
+            << std::endl;
   ARROW_CHECK_OK(g_server->Serve());
+  std::cout << "Server CPU time: "
+            << static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC)
+            << " s" << std::endl;
   return 0;
 }
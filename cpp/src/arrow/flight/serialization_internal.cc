@@ -56,6 +56,12 @@ namespace pb = arrow::flight::protocol;
 
 static constexpr int64_t kInt32Max = std::numeric_limits<int32_t>::max();
 
+// Field holding the location of a message body written to shared memory, as two
+// little-endian 64-bit integers (offset and length). It is not part of
+// Flight.proto and only sent to clients which offered a shared memory segment.
+static constexpr int kSharedMemoryBodyFieldNumber = 1001;
+static constexpr int kSharedMemoryBodySize = 16;
+
 namespace arrow {
 namespace flight {
 namespace internal {
@@ -193,6 +199,15 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
   bool has_body = ipc::Message::HasBody(ipc_msg.type);
   DCHECK(has_body || ipc_msg.body_length == 0);
 
+  // The body was written to shared memory, only send its location
+  const bool shared_memory_body = msg.shared_memory_offset >= 0;
+  if (shared_memory_body) {
+    has_body = false;
+    body_size = 0;
+    // 2 bytes for tag
+    header_size += 2 + WireFormatLite::LengthDelimitedSize(kSharedMemoryBodySize);
+  }
+
   // 2 bytes for body tag
   if (has_body) {
     // We write the body tag in the header but not the actual body data
@@ -242,6 +257,14 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
                                        static_cast<int>(msg.app_metadata->size()));
   }
 
+  if (shared_memory_body) {
+    WireFormatLite::WriteTag(kSharedMemoryBodyFieldNumber,
+                             WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &header_stream);
+    header_stream.WriteVarint32(kSharedMemoryBodySize);
+    header_stream.WriteLittleEndian64(static_cast<uint64_t>(msg.shared_memory_offset));
+    header_stream.WriteLittleEndian64(static_cast<uint64_t>(msg.shared_memory_length));
+  }
+
   if (has_body) {
     // Write body tag
     WireFormatLite::WriteTag(pb::FlightData::kDataBodyFieldNumber,
@@ -331,6 +354,18 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
                               "Unable to read FlightData body");
         }
       } break;
+      case kSharedMemoryBodyFieldNumber: {
+        uint32_t length;
+        uint64_t offset, body_length;
+        if (!pb_stream.ReadVarint32(&length) || length != kSharedMemoryBodySize ||
+            !pb_stream.ReadLittleEndian64(&offset) ||
+            !pb_stream.ReadLittleEndian64(&body_length)) {
+          return grpc::Status(grpc::StatusCode::INTERNAL,
+                              "Unable to read FlightData shared memory body");
+        }
+        out->shared_memory_offset = static_cast<int64_t>(offset);
+        out->shared_memory_length = static_cast<int64_t>(body_length);
+      } break;
       default:
         DCHECK(false) << "cannot happen";
     }
@@ -376,6 +411,20 @@ bool WritePayload(const FlightPayload& payload,
                        grpc::WriteOptions());
 }
 
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* writer) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
+                       grpc::WriteOptions());
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
+                       grpc::WriteOptions());
+}
+
 bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
   return reader->Read(reinterpret_cast<pb::FlightData*>(data));
@@ -387,6 +436,18 @@ bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader
   return reader->Read(reinterpret_cast<pb::FlightData*>(data));
 }
 
+bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+}
+
+bool ReadPayload(grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+}
+
 #ifndef _WIN32
 #pragma GCC diagnostic pop
 #endif
@@ -53,6 +53,7 @@
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/server_middleware.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 using FlightService = arrow::flight::protocol::FlightService;
@@ -91,11 +92,13 @@ namespace flight {
 
 namespace {
 
-// A MessageReader implementation that reads from a gRPC ServerReader
+// A MessageReader implementation that reads from a gRPC ServerReader.
+// WriteT is the type of the messages sent back to the client.
+template <typename WriteT>
 class FlightIpcMessageReader : public ipc::MessageReader {
  public:
   explicit FlightIpcMessageReader(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
+      grpc::ServerReaderWriter<WriteT, pb::FlightData>* reader,
       std::shared_ptr<Buffer>* last_metadata)
       : reader_(reader), app_metadata_(last_metadata) {}
 
@@ -130,7 +133,7 @@ class FlightIpcMessageReader : public ipc::MessageReader {
 
     if (first_message_) {
       if (!data.descriptor) {
-        return Status::Invalid("DoPut must start with non-null descriptor");
+        return Status::Invalid("Upload must start with non-null descriptor");
       }
       descriptor_ = *data.descriptor;
       first_message_ = false;
@@ -141,21 +144,22 @@ class FlightIpcMessageReader : public ipc::MessageReader {
     return Status::OK();
   }
 
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
+  grpc::ServerReaderWriter<WriteT, pb::FlightData>* reader_;
   bool stream_finished_ = false;
   bool first_message_ = true;
   FlightDescriptor descriptor_;
   std::shared_ptr<Buffer>* app_metadata_;
 };
 
+template <typename WriteT>
 class FlightMessageReaderImpl : public FlightMessageReader {
  public:
   explicit FlightMessageReaderImpl(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader)
+      grpc::ServerReaderWriter<WriteT, pb::FlightData>* reader)
       : reader_(reader) {}
 
   Status Init() {
-    message_reader_ = new FlightIpcMessageReader(reader_, &last_metadata_);
+    message_reader_ = new FlightIpcMessageReader<WriteT>(reader_, &last_metadata_);
     return ipc::RecordBatchStreamReader::Open(
                std::unique_ptr<ipc::MessageReader>(message_reader_))
         .Value(&batch_reader_);
@@ -177,12 +181,91 @@ class FlightMessageReaderImpl : public FlightMessageReader {
  private:
   std::shared_ptr<Schema> schema_;
   std::unique_ptr<ipc::DictionaryMemo> dictionary_memo_;
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
-  FlightIpcMessageReader* message_reader_;
+  grpc::ServerReaderWriter<WriteT, pb::FlightData>* reader_;
+  FlightIpcMessageReader<WriteT>* message_reader_;
   std::shared_ptr<Buffer> last_metadata_;
   std::shared_ptr<RecordBatchReader> batch_reader_;
 };
 
+// An IpcPayloadWriter that writes to a DoExchange stream, attaching the
+// application metadata of the batch being written
+class DoExchangePayloadWriter : public ipc::internal::IpcPayloadWriter {
+ public:
+  DoExchangePayloadWriter(
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer,
+      std::shared_ptr<Buffer>* app_metadata)
+      : writer_(writer), app_metadata_(app_metadata) {}
+
+  Status Start() override { return Status::OK(); }
+
+  Status WritePayload(const ipc::internal::IpcPayload& ipc_payload) override {
+    FlightPayload payload;
+    payload.ipc_message = ipc_payload;
+    if (ipc_payload.type == ipc::Message::RECORD_BATCH && *app_metadata_) {
+      payload.app_metadata = std::move(*app_metadata_);
+    }
+    if (!internal::WritePayload(payload, writer_)) {
+      return Status::IOError("Could not write record batch to stream");
+    }
+    return Status::OK();
+  }
+
+  // The stream is finished when the call returns
+  Status Close() override { return Status::OK(); }
+
+ private:
+  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer_;
+  std::shared_ptr<Buffer>* app_metadata_;
+};
+
+class FlightMessageWriterImpl : public FlightMessageWriter {
+ public:
+  explicit FlightMessageWriterImpl(
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer)
+      : writer_(writer) {}
+
+  Status Begin(const std::shared_ptr<Schema>& schema) override {
+    if (batch_writer_) {
+      return Status::Invalid("This writer has already been started");
+    }
+    std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+        new DoExchangePayloadWriter(writer_, &app_metadata_));
+    ARROW_ASSIGN_OR_RAISE(batch_writer_, ipc::internal::OpenRecordBatchWriter(
+                                             std::move(payload_writer), schema));
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    return WriteWithMetadata(batch, nullptr);
+  }
+
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override {
+    RETURN_NOT_OK(CheckStarted());
+    app_metadata_ = std::move(app_metadata);
+    return batch_writer_->WriteRecordBatch(batch);
+  }
+
+  Status Close() override {
+    if (batch_writer_) {
+      return batch_writer_->Close();
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status CheckStarted() {
+    if (!batch_writer_) {
+      return Status::Invalid("Must call Begin() before writing");
+    }
+    return Status::OK();
+  }
+
+  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer_;
+  std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
+  std::shared_ptr<Buffer> app_metadata_;
+};
+
 class GrpcMetadataWriter : public FlightMetadataWriter {
  public:
   explicit GrpcMetadataWriter(
@@ -301,8 +384,11 @@ class FlightServiceImpl : public FlightService::Service {
       std::shared_ptr<ServerAuthHandler> auth_handler,
       std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
           middleware,
-      FlightServerBase* server)
-      : auth_handler_(auth_handler), middleware_(middleware), server_(server) {}
+      bool enable_shared_memory, FlightServerBase* server)
+      : auth_handler_(auth_handler),
+        middleware_(middleware),
+        enable_shared_memory_(enable_shared_memory),
+        server_(server) {}
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -506,6 +592,24 @@ class FlightServiceImpl : public FlightService::Service {
                                                           "No data in this flight"));
     }
 
+    // Write bodies to the shared memory segment offered by the client, if
+    // any. This must happen before writing any message: the client removes
+    // the name of the segment once it receives the first one.
+    std::unique_ptr<internal::SharedMemoryBodyWriter> shared_memory;
+    if (enable_shared_memory_) {
+      const auto& client_metadata = context->client_metadata();
+      const auto segment_name = client_metadata.find(internal::kGrpcSharedMemoryHeader);
+      if (segment_name != client_metadata.end()) {
+        // Fails if the client is on another host, then bodies are sent inline
+        auto maybe_segment = internal::SharedMemorySegment::Open(
+            std::string(segment_name->second.data(), segment_name->second.length()));
+        if (maybe_segment.ok()) {
+          shared_memory.reset(new internal::SharedMemoryBodyWriter(
+              std::move(maybe_segment).ValueOrDie()));
+        }
+      }
+    }
+
     // Write the schema as the first message in the stream
     FlightPayload schema_payload;
     SERVICE_RETURN_NOT_OK(flight_context, data_stream->GetSchemaPayload(&schema_payload));
@@ -518,11 +622,19 @@ class FlightServiceImpl : public FlightService::Service {
     while (true) {
       FlightPayload payload;
       SERVICE_RETURN_NOT_OK(flight_context, data_stream->Next(&payload));
-      if (payload.ipc_message.metadata == nullptr ||
-          !internal::WritePayload(payload, writer))
-        // No more messages to write, or connection terminated for some other
-        // reason
+      if (payload.ipc_message.metadata == nullptr) {
+        // No more messages to write
+        break;
+      }
+      if (shared_memory) {
+        // The body is sent inline if the segment is full
+        auto written = shared_memory->WriteBody(&payload);
+        SERVICE_RETURN_NOT_OK(flight_context, written.status());
+      }
+      if (!internal::WritePayload(payload, writer)) {
+        // Connection terminated for some other reason
         break;
+      }
     }
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
@@ -532,8 +644,8 @@ class FlightServiceImpl : public FlightService::Service {
     GrpcServerCallContext flight_context(context);
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoPut, context, flight_context));
 
-    auto message_reader =
-        std::unique_ptr<FlightMessageReaderImpl>(new FlightMessageReaderImpl(reader));
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<pb::PutResult>>(
+        new FlightMessageReaderImpl<pb::PutResult>(reader));
     SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
     auto metadata_writer =
         std::unique_ptr<FlightMetadataWriter>(new GrpcMetadataWriter(reader));
@@ -542,6 +654,23 @@ class FlightServiceImpl : public FlightService::Service {
                                           std::move(metadata_writer)));
   }
 
+  grpc::Status DoExchange(
+      ServerContext* context,
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream) {
+    GrpcServerCallContext flight_context(context);
+    GRPC_RETURN_NOT_GRPC_OK(
+        CheckAuth(FlightMethod::DoExchange, context, flight_context));
+
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<pb::FlightData>>(
+        new FlightMessageReaderImpl<pb::FlightData>(stream));
+    SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
+    auto message_writer =
+        std::unique_ptr<FlightMessageWriterImpl>(new FlightMessageWriterImpl(stream));
+    RETURN_WITH_MIDDLEWARE(flight_context,
+                           server_->DoExchange(flight_context, std::move(message_reader),
+                                               std::move(message_writer)));
+  }
+
   grpc::Status ListActions(ServerContext* context, const pb::Empty* request,
                            ServerWriter<pb::ActionType>* writer) {
     GrpcServerCallContext flight_context(context);
@@ -590,6 +719,7 @@ class FlightServiceImpl : public FlightService::Service {
   std::shared_ptr<ServerAuthHandler> auth_handler_;
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware_;
+  bool enable_shared_memory_;
   FlightServerBase* server_;
 };
 
@@ -656,8 +786,8 @@ FlightServerBase::FlightServerBase() { impl_.reset(new Impl); }
 FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(const FlightServerOptions& options) {
-  impl_->service_.reset(
-      new FlightServiceImpl(options.auth_handler, options.middleware, this));
+  impl_->service_.reset(new FlightServiceImpl(options.auth_handler, options.middleware,
+                                              options.enable_shared_memory, this));
 
   grpc::ServerBuilder builder;
   // Allow uploading messages of any length
@@ -782,6 +912,12 @@ Status FlightServerBase::DoPut(const ServerCallContext& context,
   return Status::NotImplemented("NYI");
 }
 
+Status FlightServerBase::DoExchange(const ServerCallContext& context,
+                                    std::unique_ptr<FlightMessageReader> reader,
+                                    std::unique_ptr<FlightMessageWriter> writer) {
+  return Status::NotImplemented("NYI");
+}
+
 Status FlightServerBase::DoAction(const ServerCallContext& context, const Action& action,
                                   std::unique_ptr<ResultStream>* result) {
   return Status::NotImplemented("NYI");
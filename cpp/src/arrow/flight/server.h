@@ -30,6 +30,7 @@
 #include "arrow/flight/types.h"       // IWYU pragma: keep
 #include "arrow/flight/visibility.h"  // IWYU pragma: keep
 #include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 
@@ -96,6 +97,33 @@ class ARROW_FLIGHT_EXPORT FlightMetadataWriter {
   virtual Status WriteMetadata(const Buffer& app_metadata) = 0;
 };
 
+// Silence warning
+// "non dll-interface class RecordBatchWriter used as base for dll-interface class"
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4275)
+#endif
+
+/// \brief A writer for the record batches sent back to the client in a
+/// DoExchange call.
+///
+/// Batches are sent as soon as they are written, so a server may write
+/// results while the client is still uploading its input.
+class ARROW_FLIGHT_EXPORT FlightMessageWriter : public ipc::RecordBatchWriter {
+ public:
+  /// \brief Start the stream by sending the schema of the results. This
+  /// must be called once before writing any batch.
+  virtual Status Begin(const std::shared_ptr<Schema>& schema) = 0;
+
+  /// \brief Write a record batch along with application-defined metadata.
+  virtual Status WriteWithMetadata(const RecordBatch& batch,
+                                   std::shared_ptr<Buffer> app_metadata) = 0;
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
 /// \brief Call state/contextual data.
 class ARROW_FLIGHT_EXPORT ServerCallContext {
  public:
@@ -130,6 +158,12 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware;
 
+  /// \brief Write the record batch bodies of DoGet streams to the shared
+  /// memory segment offered by a client on the same host, if any.
+  ///
+  /// See FlightClientOptions::shared_memory_size.
+  bool enable_shared_memory = false;
+
   /// \brief A Flight implementation-specific callback to customize
   /// transport-specific options.
   ///
@@ -233,6 +267,19 @@ class ARROW_FLIGHT_EXPORT FlightServerBase {
                        std::unique_ptr<FlightMessageReader> reader,
                        std::unique_ptr<FlightMetadataWriter> writer);
 
+  /// \brief Process a stream of IPC payloads sent from a client while
+  /// sending a stream of IPC payloads back
+  ///
+  /// The reader and writer are independent: results may be written before
+  /// all of the input has been read.
+  /// \param[in] context The call context.
+  /// \param[in] reader a sequence of uploaded record batches
+  /// \param[in] writer a writer for the record batches sent back
+  /// \return Status
+  virtual Status DoExchange(const ServerCallContext& context,
+                            std::unique_ptr<FlightMessageReader> reader,
+                            std::unique_ptr<FlightMessageWriter> writer);
+
   /// \brief Execute an action, return stream of zero or more results
   /// \param[in] context The call context.
   /// \param[in] action the action to execute, with type and body
@@ -0,0 +1,367 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/shared_memory_internal.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <unordered_set>
+
+#include "arrow/buffer.h"
+#include "arrow/ipc/message.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+#if (ATOMIC_LLONG_LOCK_FREE != 2)
+#error "atomic 64-bit integers are not lock-free, cannot share them between processes"
+#endif
+
+namespace {
+
+// "ARROWSHM", identifying segments created by SharedMemorySegment::Create
+constexpr uint64_t kSegmentMagic = 0x4d4853574f525241ULL;
+// Only segments with this name prefix are opened on behalf of a client
+constexpr char kSegmentNamePrefix[] = "/arrow-shm-";
+// The segment header holds the magic number and the segment size
+constexpr int64_t kDataOffset = 64;
+// Each body is preceded by a block header holding its in-use flag, and bodies
+// are aligned to 64 bytes
+constexpr int64_t kBlockHeaderSize = 64;
+constexpr int64_t kMinimumSegmentSize = kDataOffset + kBlockHeaderSize + 64;
+
+struct SegmentHeader {
+  uint64_t magic;
+  int64_t size;
+};
+
+// The names of the segments opened in this process
+struct OpenedSegments {
+  std::mutex mutex;
+  std::unordered_set<std::string> names;
+};
+
+OpenedSegments& GetOpenedSegments() {
+  static OpenedSegments opened;
+  return opened;
+}
+
+std::atomic<int64_t>* BlockState(uint8_t* block) {
+  return reinterpret_cast<std::atomic<int64_t>*>(block);
+}
+
+// A body in a segment, handed back to the server when destroyed
+class SharedMemoryBuffer : public Buffer {
+ public:
+  SharedMemoryBuffer(std::shared_ptr<SharedMemorySegment> segment, const uint8_t* data,
+                     int64_t size, std::atomic<int64_t>* state)
+      : Buffer(data, size), segment_(std::move(segment)), state_(state) {}
+
+  ~SharedMemoryBuffer() override { state_->store(0, std::memory_order_release); }
+
+ private:
+  std::shared_ptr<SharedMemorySegment> segment_;
+  std::atomic<int64_t>* state_;
+};
+
+#ifndef _WIN32
+std::string MakeSegmentName() {
+  static std::atomic<uint32_t> counter{0};
+  std::random_device device;
+  const uint32_t unique = device() ^ counter.fetch_add(1);
+  char name[32];
+  // macOS limits the length of shared memory names to 31 characters
+  snprintf(name, sizeof(name), "%s%x-%x", kSegmentNamePrefix,
+           static_cast<unsigned int>(getpid()) & 0xffffff,
+           static_cast<unsigned int>(unique));
+  return name;
+}
+
+::arrow::Result<uint8_t*> MapSegment(int fd, int64_t size, const std::string& name) {
+  void* data =
+      mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED) {
+    return ::arrow::internal::IOErrorFromErrno(errno, "Failed to map shared memory '",
+                                               name, "'");
+  }
+  return reinterpret_cast<uint8_t*>(data);
+}
+#endif
+
+}  // namespace
+
+SharedMemorySegment::SharedMemorySegment(std::string name, uint8_t* data, int64_t size,
+                                         bool owner, int fd)
+    : name_(std::move(name)), data_(data), size_(size), owner_(owner), fd_(fd) {}
+
+SharedMemorySegment::~SharedMemorySegment() {
+#ifndef _WIN32
+  Unlink();
+  munmap(data_, static_cast<size_t>(size_));
+  if (fd_ >= 0) {
+    close(fd_);
+    auto& opened = GetOpenedSegments();
+    std::lock_guard<std::mutex> lock(opened.mutex);
+    opened.names.erase(name_);
+  }
+#endif
+}
+
+::arrow::Result<std::shared_ptr<SharedMemorySegment>> SharedMemorySegment::Create(
+    int64_t size) {
+#ifdef _WIN32
+  return Status::NotImplemented("Shared memory transport is not supported on Windows");
+#else
+  if (size < kMinimumSegmentSize) {
+    return Status::Invalid("Shared memory segment size must be at least ",
+                           kMinimumSegmentSize, " bytes");
+  }
+  size = BitUtil::RoundUpToMultipleOf64(size);
+
+  std::string name;
+  int fd = -1;
+  // Retry in the unlikely case of a name collision
+  for (int attempt = 0; attempt < 3 && fd < 0; ++attempt) {
+    name = MakeSegmentName();
+    fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0 && errno != EEXIST) break;
+  }
+  if (fd < 0) {
+    return ::arrow::internal::IOErrorFromErrno(errno, "Failed to create shared memory");
+  }
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    auto st = ::arrow::internal::IOErrorFromErrno(errno, "Failed to size shared memory");
+    close(fd);
+    shm_unlink(name.c_str());
+    return st;
+  }
+  auto maybe_data = MapSegment(fd, size, name);
+  close(fd);
+  if (!maybe_data.ok()) {
+    shm_unlink(name.c_str());
+    return maybe_data.status();
+  }
+  uint8_t* data = *maybe_data;
+
+  auto header = reinterpret_cast<SegmentHeader*>(data);
+  header->magic = kSegmentMagic;
+  header->size = size;
+  return std::shared_ptr<SharedMemorySegment>(
+      new SharedMemorySegment(std::move(name), data, size, /*owner=*/true, /*fd=*/-1));
+#endif
+}
+
+::arrow::Result<std::shared_ptr<SharedMemorySegment>> SharedMemorySegment::Open(
+    const std::string& name) {
+#ifdef _WIN32
+  return Status::NotImplemented("Shared memory transport is not supported on Windows");
+#else
+  if (name.compare(0, sizeof(kSegmentNamePrefix) - 1, kSegmentNamePrefix) != 0) {
+    return Status::Invalid("Not a Flight shared memory segment: '", name, "'");
+  }
+  auto& opened = GetOpenedSegments();
+  {
+    std::lock_guard<std::mutex> lock(opened.mutex);
+    if (!opened.names.insert(name).second) {
+      return Status::Invalid("Shared memory segment '", name,
+                             "' is already in use by another call");
+    }
+  }
+  auto unregister = [&]() {
+    std::lock_guard<std::mutex> lock(opened.mutex);
+    opened.names.erase(name);
+  };
+
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    unregister();
+    return ::arrow::internal::IOErrorFromErrno(errno, "Failed to open shared memory '",
+                                               name, "'");
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    auto status = ::arrow::internal::IOErrorFromErrno(errno, "Failed to stat '", name,
+                                                      "'");
+    close(fd);
+    unregister();
+    return status;
+  }
+  const int64_t size = static_cast<int64_t>(st.st_size);
+  if (size < kMinimumSegmentSize) {
+    close(fd);
+    unregister();
+    return Status::Invalid("Shared memory segment '", name, "' is too small");
+  }
+  auto maybe_data = MapSegment(fd, size, name);
+  if (!maybe_data.ok()) {
+    close(fd);
+    unregister();
+    return maybe_data.status();
+  }
+
+  // From here on the segment closes the descriptor and unregisters the name
+  auto segment = std::shared_ptr<SharedMemorySegment>(
+      new SharedMemorySegment(name, *maybe_data, size, /*owner=*/false, fd));
+  RETURN_NOT_OK(segment->CheckSize());
+  auto header = reinterpret_cast<const SegmentHeader*>(segment->data());
+  if (header->magic != kSegmentMagic || header->size != size) {
+    return Status::Invalid("Shared memory segment '", name, "' has an invalid header");
+  }
+  return segment;
+#endif
+}
+
+Status SharedMemorySegment::CheckSize() const {
+#ifndef _WIN32
+  // POSIX shared memory objects can't be sealed against shrinking (only
+  // memfds can), so the size is checked before each access instead
+  if (fd_ >= 0) {
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+      return ::arrow::internal::IOErrorFromErrno(errno, "Failed to stat '", name_, "'");
+    }
+    if (static_cast<int64_t>(st.st_size) < size_) {
+      return Status::IOError("Shared memory segment '", name_, "' was truncated");
+    }
+  }
+#endif
+  return Status::OK();
+}
+
+void SharedMemorySegment::Unlink() {
+#ifndef _WIN32
+  if (owner_) {
+    shm_unlink(name_.c_str());
+    owner_ = false;
+  }
+#endif
+}
+
+::arrow::Result<std::shared_ptr<Buffer>> SharedMemorySegment::GetBody(int64_t offset,
+                                                               int64_t length) {
+  if (offset < kDataOffset + kBlockHeaderSize || offset % kBlockHeaderSize != 0 ||
+      length < 0 || length > size_ - offset) {
+    return Status::IOError("Invalid shared memory body location (offset ", offset,
+                           ", length ", length, ")");
+  }
+  auto state = BlockState(data_ + offset - kBlockHeaderSize);
+  return std::make_shared<SharedMemoryBuffer>(shared_from_this(), data_ + offset, length,
+                                              state);
+}
+
+SharedMemoryBodyWriter::SharedMemoryBodyWriter(
+    std::shared_ptr<SharedMemorySegment> segment)
+    : segment_(std::move(segment)), head_(kDataOffset) {}
+
+void SharedMemoryBodyWriter::Reclaim() {
+  while (!blocks_.empty() &&
+         BlockState(segment_->data() + blocks_.front().first)
+                 ->load(std::memory_order_acquire) == 0) {
+    blocks_.pop_front();
+  }
+  if (blocks_.empty()) {
+    head_ = kDataOffset;
+  }
+}
+
+int64_t SharedMemoryBodyWriter::Allocate(int64_t size) {
+  Reclaim();
+
+  const int64_t end = segment_->size();
+  int64_t offset = -1;
+  if (blocks_.empty()) {
+    if (kDataOffset + size <= end) offset = kDataOffset;
+  } else {
+    const int64_t tail = blocks_.front().first;
+    if (tail < head_) {
+      // The blocks in use are contiguous: allocate after them, or wrap around
+      if (head_ + size <= end) {
+        offset = head_;
+      } else if (kDataOffset + size <= tail) {
+        offset = kDataOffset;
+      }
+    } else if (head_ + size <= tail) {
+      // The blocks in use wrap around: allocate in the gap between them
+      offset = head_;
+    }
+  }
+  if (offset >= 0) {
+    blocks_.emplace_back(offset, size);
+    head_ = offset + size;
+  }
+  return offset;
+}
+
+::arrow::Result<bool> SharedMemoryBodyWriter::WriteBody(FlightPayload* payload) {
+  const ipc::internal::IpcPayload& ipc_msg = payload->ipc_message;
+  if (!ipc::Message::HasBody(ipc_msg.type)) {
+    return false;
+  }
+
+  // Bodies are laid out as on the wire, with each buffer padded to 8 bytes
+  int64_t body_size = 0;
+  for (const auto& buffer : ipc_msg.body_buffers) {
+    if (!buffer) continue;
+    body_size += BitUtil::RoundUpToMultipleOf8(buffer->size());
+  }
+  if (body_size == 0) {
+    return false;
+  }
+
+  // Allocating reads the block headers, which must still be mapped
+  RETURN_NOT_OK(segment_->CheckSize());
+  const int64_t offset =
+      Allocate(kBlockHeaderSize + BitUtil::RoundUpToMultipleOf64(body_size));
+  if (offset < 0) {
+    return false;
+  }
+  uint8_t* block = segment_->data() + offset;
+  BlockState(block)->store(1, std::memory_order_relaxed);
+
+  uint8_t* out = block + kBlockHeaderSize;
+  for (const auto& buffer : ipc_msg.body_buffers) {
+    if (!buffer) continue;
+    const int64_t padded_size = BitUtil::RoundUpToMultipleOf8(buffer->size());
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    std::memset(out + buffer->size(), 0,
+                static_cast<size_t>(padded_size - buffer->size()));
+    out += padded_size;
+  }
+
+  payload->shared_memory_offset = offset + kBlockHeaderSize;
+  payload->shared_memory_length = body_size;
+  return true;
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
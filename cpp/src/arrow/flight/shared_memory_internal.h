@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Shared memory transport for message bodies between a Flight client and
+// server running on the same host.
+//
+// A client offers a segment by passing its name in a call header. The server
+// copies each message body into the segment once and sends only its location
+// over gRPC; the client wraps the location as a Buffer without copying. Each
+// body is preceded by a block header holding a flag which the client clears
+// when the Buffer is destroyed, after which the server may reuse the space.
+// When the segment is full the server sends the body inline as usual.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "arrow/flight/types.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+
+namespace arrow {
+
+class Buffer;
+
+namespace flight {
+namespace internal {
+
+/// A mapped POSIX shared memory segment
+class SharedMemorySegment : public std::enable_shared_from_this<SharedMemorySegment> {
+ public:
+  ~SharedMemorySegment();
+
+  /// Create and map a segment with a unique name (client side)
+  static ::arrow::Result<std::shared_ptr<SharedMemorySegment>> Create(int64_t size);
+
+  /// Map a segment created by a client (server side)
+  ///
+  /// A segment can only be opened once at a time in a process, so that two
+  /// calls naming the same segment don't allocate the same space.
+  static ::arrow::Result<std::shared_ptr<SharedMemorySegment>> Open(
+      const std::string& name);
+
+  /// Fail if an opened segment was truncated since it was mapped, as accessing
+  /// it would then fault (server side)
+  Status CheckSize() const;
+
+  /// Remove the name of a created segment. The mapping stays valid.
+  void Unlink();
+
+  const std::string& name() const { return name_; }
+  int64_t size() const { return size_; }
+  uint8_t* data() const { return data_; }
+
+  /// Wrap a body which the server wrote at the given location (client side)
+  ///
+  /// The space is handed back to the server when the Buffer is destroyed.
+  ::arrow::Result<std::shared_ptr<Buffer>> GetBody(int64_t offset, int64_t length);
+
+ private:
+  SharedMemorySegment(std::string name, uint8_t* data, int64_t size, bool owner,
+                      int fd);
+
+  std::string name_;
+  uint8_t* data_;
+  int64_t size_;
+  bool owner_;
+  // The descriptor of an opened segment, kept to check its size, or -1
+  int fd_;
+};
+
+/// Allocates space for message bodies in a client's segment (server side)
+///
+/// Space is allocated as a ring and reclaimed in allocation order.
+class SharedMemoryBodyWriter {
+ public:
+  explicit SharedMemoryBodyWriter(std::shared_ptr<SharedMemorySegment> segment);
+
+  /// Copy the body of the payload into the segment and record its location
+  /// in the payload.
+  ///
+  /// \return false if the payload has no body or there is no free space, in
+  /// which case the body is to be sent inline, or an error if the client
+  /// truncated the segment
+  ::arrow::Result<bool> WriteBody(FlightPayload* payload);
+
+ private:
+  void Reclaim();
+  int64_t Allocate(int64_t size);
+
+  std::shared_ptr<SharedMemorySegment> segment_;
+  // Offset and size of the blocks not yet released by the client, oldest first
+  std::deque<std::pair<int64_t, int64_t>> blocks_;
+  int64_t head_;
+};
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
@@ -88,10 +88,13 @@ Status ResolveCurrentExecutable(fs::path* out) {
 
 }  // namespace
 
-void TestServer::Start() {
+void TestServer::Start() { Start({}); }
+
+void TestServer::Start(const std::vector<std::string>& extra_args) {
   namespace fs = boost::filesystem;
 
-  std::string str_port = std::to_string(port_);
+  std::vector<std::string> args = {"-port", std::to_string(port_)};
+  args.insert(args.end(), extra_args.begin(), extra_args.end());
   std::vector<fs::path> search_path = ::boost::this_process::path();
   // If possible, prepend current executable directory to search path,
   // since it's likely that the test server executable is located in
@@ -106,7 +109,7 @@ void TestServer::Start() {
 
   try {
     server_process_ = std::make_shared<bp::child>(
-        bp::search_path(executable_name_, search_path), "-port", str_port);
+        bp::search_path(executable_name_, search_path), bp::args(args));
   } catch (...) {
     std::stringstream ss;
     ss << "Failed to launch test server '" << executable_name_ << "', looked in ";
@@ -56,6 +56,9 @@ class ARROW_FLIGHT_EXPORT TestServer {
 
   void Start();
 
+  /// \brief Start the server with additional command line arguments
+  void Start(const std::vector<std::string>& extra_args);
+
   int Stop();
 
   bool IsRunning();
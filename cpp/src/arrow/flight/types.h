@@ -347,6 +347,11 @@ struct ARROW_FLIGHT_EXPORT FlightPayload {
   std::shared_ptr<Buffer> descriptor;
   std::shared_ptr<Buffer> app_metadata;
   ipc::internal::IpcPayload ipc_message;
+  /// \brief The location of the message body in a shared memory segment
+  /// offered by the client, if the transport placed it there instead of
+  /// sending it inline. Negative if the body is sent inline.
+  int64_t shared_memory_offset = -1;
+  int64_t shared_memory_length = 0;
 };
 
 /// \brief Schema result returned after a schema request RPC
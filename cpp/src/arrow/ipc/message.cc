@@ -313,6 +313,58 @@ Result<std::unique_ptr<Message>> ReadMessage(int64_t offset, int32_t metadata_le
   }
 }
 
+Result<std::unique_ptr<Message>> ReadMessageMetadata(int64_t offset,
+                                                     int32_t metadata_length,
+                                                     io::RandomAccessFile* file) {
+  std::unique_ptr<Message> unused;
+  auto listener = std::make_shared<AssignMessageDecoderListener>(&unused);
+  MessageDecoder decoder(listener);
+
+  if (metadata_length < decoder.next_required_size()) {
+    return Status::Invalid("metadata_length should be at least ",
+                           decoder.next_required_size());
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto metadata, file->ReadAt(offset, metadata_length));
+  if (metadata->size() < metadata_length) {
+    return Status::Invalid("Expected to read ", metadata_length,
+                           " metadata bytes but got ", metadata->size());
+  }
+
+  // Only let the decoder parse the length prefix (and continuation token), so
+  // that it stops before the flatbuffer instead of waiting for the body
+  int64_t prefix_size = 0;
+  while ((decoder.state() == MessageDecoder::State::INITIAL ||
+          decoder.state() == MessageDecoder::State::METADATA_LENGTH) &&
+         prefix_size + decoder.next_required_size() <= metadata_length) {
+    const int64_t length_size = decoder.next_required_size();
+    ARROW_RETURN_NOT_OK(
+        decoder.Consume(SliceBuffer(metadata, prefix_size, length_size)));
+    prefix_size += length_size;
+  }
+
+  switch (decoder.state()) {
+    case MessageDecoder::State::INITIAL:
+    case MessageDecoder::State::METADATA_LENGTH:
+      return Status::Invalid("metadata length is missing. File offset: ", offset,
+                             ", metadata length: ", metadata_length);
+    case MessageDecoder::State::METADATA: {
+      if (prefix_size + decoder.next_required_size() > metadata_length) {
+        return Status::Invalid("flatbuffer size ", decoder.next_required_size(),
+                               " invalid. File offset: ", offset,
+                               ", metadata length: ", metadata_length);
+      }
+      auto flatbuffer = SliceBuffer(metadata, prefix_size, decoder.next_required_size());
+      RETURN_NOT_OK(MaybeAlignMetadata(&flatbuffer));
+      return Message::Open(std::move(flatbuffer), /*body=*/nullptr);
+    }
+    case MessageDecoder::State::EOS:
+      return Status::Invalid("Unexpected empty message in IPC file format");
+    default:
+      return Status::Invalid("Unexpected state: ", decoder.state());
+  }
+}
+
 Status AlignStream(io::InputStream* stream, int32_t alignment) {
   ARROW_ASSIGN_OR_RAISE(int64_t position, stream->Tell());
   return stream->Advance(PaddedLength(position, alignment) - position);
@@ -504,6 +504,22 @@ Result<std::unique_ptr<Message>> ReadMessage(const int64_t offset,
                                              const int32_t metadata_length,
                                              io::RandomAccessFile* file);
 
+/// \brief Read the metadata of an encapsulated IPC message from a
+/// RandomAccessFile, without its body
+///
+/// Like ReadMessage, but the returned message has a null body. Its buffers
+/// can then be read selectively from the file, starting at offset +
+/// metadata_length.
+///
+/// \param[in] offset the position in the file where the message starts
+/// \param[in] metadata_length the total number of bytes to read from file
+/// \param[in] file the seekable file interface to read from
+/// \return the message read, without body
+ARROW_EXPORT
+Result<std::unique_ptr<Message>> ReadMessageMetadata(const int64_t offset,
+                                                     const int32_t metadata_length,
+                                                     io::RandomAccessFile* file);
+
 /// \brief Advance stream to an 8-byte offset if its position is not a multiple
 /// of 8 already
 /// \param[in] stream an input stream
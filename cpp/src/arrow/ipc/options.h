@@ -81,6 +81,10 @@ struct ARROW_EXPORT IpcReadOptions {
 
   /// \brief EXPERIMENTAL: Top-level schema fields to include when
   /// deserializing RecordBatch. If empty, return all deserialized fields
+  ///
+  /// RecordBatchFileReader reads only the buffers of these fields from the
+  /// file, as it does for all fields of files supporting zero-copy reads
+  /// such as memory-mapped files.
   std::vector<int> included_fields;
 
   /// \brief Use global CPU thread pool to parallelize any computational tasks
@@ -48,6 +48,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
@@ -1298,6 +1299,69 @@ TEST_F(TestStreamFormat, ReadFieldSubset) { TestReadSubsetOfFields(); }
 
 TEST_F(TestFileFormat, ReadFieldSubset) { TestReadSubsetOfFields(); }
 
+TEST(TestRecordBatchFileReader, ReadFieldSubsetZeroCopy) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("a", int32()), field("b", utf8()), field("c", int64())}),
+      R"([[1, "x", 3], [null, "yz", 5], [4, null, null]])");
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  auto options = IpcReadOptions::Defaults();
+  options.included_fields = {1};
+  BatchVector out_batches;
+  ASSERT_OK(helper.ReadBatches(options, &out_batches));
+  ASSERT_EQ(1, static_cast<int>(out_batches.size()));
+  ASSERT_EQ(1, out_batches[0]->num_columns());
+  AssertArraysEqual(*batch->column(1), *out_batches[0]->column(0));
+
+  // The buffers of the included field are slices of the file
+  const uint8_t* file_start = helper.buffer_->data();
+  const uint8_t* file_end = file_start + helper.buffer_->size();
+  for (const auto& buffer : out_batches[0]->column(0)->data()->buffers) {
+    if (buffer == nullptr || buffer->size() == 0) continue;
+    ASSERT_GE(buffer->data(), file_start);
+    ASSERT_LE(buffer->data() + buffer->size(), file_end);
+  }
+}
+
+TEST(TestRecordBatchFileReader, ReadFieldSubsetFromFile) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("a", int32()), field("b", utf8()), field("c", int64())}),
+      R"([[1, "x", 3], [null, "yz", 5], [4, null, null]])");
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  // A regular file doesn't support zero-copy reads: the buffers of the
+  // included fields are read one by one
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       ::arrow::internal::TemporaryDir::Make("ipc-test-"));
+  ASSERT_OK_AND_ASSIGN(auto path, temp_dir->path().Join("subset.arrow"));
+  ASSERT_OK_AND_ASSIGN(auto sink, io::FileOutputStream::Open(path.ToString()));
+  ASSERT_OK(sink->Write(helper.buffer_->data(), helper.footer_offset_));
+  ASSERT_OK(sink->Close());
+  ASSERT_OK_AND_ASSIGN(auto source, io::ReadableFile::Open(path.ToString()));
+  ASSERT_FALSE(source->supports_zero_copy());
+
+  auto options = IpcReadOptions::Defaults();
+  options.included_fields = {2, 1};
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(source.get(), options));
+  ASSERT_EQ(2, reader->num_record_batches());
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto out_batch, reader->ReadRecordBatch(i));
+    ASSERT_OK(out_batch->ValidateFull());
+    ASSERT_EQ(2, out_batch->num_columns());
+    AssertArraysEqual(*batch->column(1), *out_batch->column(0));
+    AssertArraysEqual(*batch->column(2), *out_batch->column(1));
+  }
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
@@ -107,9 +107,12 @@ class ArrayLoader {
  public:
   explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
                        const DictionaryMemo* dictionary_memo,
-                       const IpcReadOptions& options, io::RandomAccessFile* file)
+                       const IpcReadOptions& options, io::RandomAccessFile* file,
+                       int64_t body_offset, int64_t body_length)
       : metadata_(metadata),
         file_(file),
+        body_offset_(body_offset),
+        body_length_(body_length),
         dictionary_memo_(dictionary_memo),
         max_recursion_depth_(options.max_recursion_depth) {}
 
@@ -122,7 +125,12 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
-    return file_->ReadAt(offset, length).Value(out);
+    if (body_length_ >= 0 &&
+        (offset < 0 || length < 0 || offset > body_length_ - length)) {
+      return Status::IOError("Buffer ", buffer_index_, " out of bounds: offset ", offset,
+                             ", length ", length, ", body length ", body_length_);
+    }
+    return file_->ReadAt(body_offset_ + offset, length).Value(out);
   }
 
   Status LoadType(const DataType& type) { return VisitTypeInline(type, this); }
@@ -331,6 +339,9 @@ class ArrayLoader {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  // The position and size (-1 if unknown) of the message body in file_
+  int64_t body_offset_;
+  int64_t body_length_;
   const DictionaryMemo* dictionary_memo_;
   int max_recursion_depth_;
   int buffer_index_ = 0;
@@ -475,8 +486,8 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
     const IpcReadOptions& options, Compression::type compression,
-    io::RandomAccessFile* file) {
-  ArrayLoader loader(metadata, dictionary_memo, options, file);
+    io::RandomAccessFile* file, int64_t body_offset, int64_t body_length) {
+  ArrayLoader loader(metadata, dictionary_memo, options, file, body_offset, body_length);
 
   std::vector<std::shared_ptr<ArrayData>> field_data;
   std::vector<std::shared_ptr<Field>> schema_fields;
@@ -515,13 +526,13 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatch(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
     const IpcReadOptions& options, Compression::type compression,
-    io::RandomAccessFile* file) {
+    io::RandomAccessFile* file, int64_t body_offset, int64_t body_length) {
   if (inclusion_mask.size() > 0) {
     return LoadRecordBatchSubset(metadata, schema, inclusion_mask, dictionary_memo,
-                                 options, compression, file);
+                                 options, compression, file, body_offset, body_length);
   }
 
-  ArrayLoader loader(metadata, dictionary_memo, options, file);
+  ArrayLoader loader(metadata, dictionary_memo, options, file, body_offset, body_length);
   std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
   for (int i = 0; i < schema->num_fields(); ++i) {
     auto arr = std::make_shared<ArrayData>();
@@ -591,10 +602,14 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
                          reader.get());
 }
 
+// The body of the message starts at body_offset in the file, which lets the
+// buffers of the included fields be read without reading the whole body. If
+// body_length is known, buffers outside of the body are rejected.
 Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
     const Buffer& metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
-    const IpcReadOptions& options, io::RandomAccessFile* file) {
+    const IpcReadOptions& options, io::RandomAccessFile* file,
+    int64_t body_offset = 0, int64_t body_length = -1) {
   const flatbuf::Message* message = nullptr;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
@@ -605,7 +620,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
   Compression::type compression;
   RETURN_NOT_OK(GetCompression(message, &compression));
   return LoadRecordBatch(batch, schema, inclusion_mask, dictionary_memo, options,
-                         compression, file);
+                         compression, file, body_offset, body_length);
 }
 
 // If we are selecting only certain fields, populate an inclusion mask for fast lookups.
@@ -707,7 +722,8 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
   ARROW_ASSIGN_OR_RAISE(
       batch, LoadRecordBatch(batch_meta, ::arrow::schema({value_field}),
                              /*field_inclusion_mask=*/{}, dictionary_memo, options,
-                             compression, file));
+                             compression, file, /*body_offset=*/0,
+                             /*body_length=*/-1));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
@@ -886,13 +902,25 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       read_dictionaries_ = true;
     }
 
+    const FileBlock block = GetRecordBatchBlock(i);
+    if (!field_inclusion_mask_.empty() || file_->supports_zero_copy()) {
+      // Only read the buffers of the included fields, straight from the
+      // file. This is zero-copy on memory-mapped files.
+      std::unique_ptr<Message> message;
+      RETURN_NOT_OK(ReadMetadataFromBlock(block, &message));
+      return ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
+                                     &dictionary_memo_, options_, file_,
+                                     block.offset + block.metadata_length,
+                                     block.body_length);
+    }
+
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
+    RETURN_NOT_OK(ReadMessageFromBlock(block, &message));
 
     CHECK_HAS_BODY(*message);
     ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                                         options_, reader.get());
+    return ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
+                                   &dictionary_memo_, options_, reader.get());
   }
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
@@ -939,6 +967,16 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return ReadMessage(block.offset, block.metadata_length, file_).Value(out);
   }
 
+  // Read the Message flatbuffer of a block, without its body
+  Status ReadMetadataFromBlock(const FileBlock& block, std::unique_ptr<Message>* out) {
+    if (!BitUtil::IsMultipleOf8(block.offset) ||
+        !BitUtil::IsMultipleOf8(block.metadata_length) ||
+        !BitUtil::IsMultipleOf8(block.body_length)) {
+      return Status::Invalid("Unaligned block in IPC file");
+    }
+    return ReadMessageMetadata(block.offset, block.metadata_length, file_).Value(out);
+  }
+
   Status ReadDictionaries() {
     // Read all the dictionaries
     for (int i = 0; i < num_dictionaries(); ++i) {
@@ -24,9 +24,13 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/numa.h"
 
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
@@ -39,6 +43,14 @@
 #include <mimalloc.h>
 #endif
 
+#ifdef ARROW_WITH_NUMA
+#include <numa.h>
+#endif
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 #ifdef ARROW_JEMALLOC
 
 // Compile-time configuration for jemalloc options.
@@ -369,6 +381,102 @@ class MimallocMemoryPool : public BaseMemoryPoolImpl<MimallocAllocator> {
 };
 #endif
 
+#ifdef ARROW_WITH_NUMA
+
+// MemoryPool implementation binding large allocations to a NUMA node.
+// Small allocations would each cost a mmap() syscall through libnuma, so
+// they are left to the system allocator.
+class NumaMemoryPool : public MemoryPool {
+ public:
+  // Allocations below this size aren't worth a dedicated mapping
+  // (this matches glibc's default mmap threshold).
+  static constexpr int64_t kMinNumaAllocation = 128 * 1024;
+
+  explicit NumaMemoryPool(int node) : node_(node) {}
+
+  Status Allocate(int64_t size, uint8_t** out) override {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size < kMinNumaAllocation) {
+      RETURN_NOT_OK(SystemAllocator::AllocateAligned(size, out));
+    } else {
+      RETURN_NOT_OK(AllocateNuma(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    const bool old_numa = old_size >= kMinNumaAllocation;
+    const bool new_numa = new_size >= kMinNumaAllocation;
+    if (!old_numa && !new_numa) {
+      RETURN_NOT_OK(SystemAllocator::ReallocateAligned(old_size, new_size, ptr));
+    } else if (old_numa && new_numa) {
+      // numa_realloc() preserves the policy of the original mapping
+      void* out = numa_realloc(*ptr, static_cast<size_t>(old_size),
+                               static_cast<size_t>(new_size));
+      if (out == nullptr) {
+        return Status::OutOfMemory("realloc of size ", new_size, " failed");
+      }
+      *ptr = reinterpret_cast<uint8_t*>(out);
+    } else {
+      uint8_t* out = nullptr;
+      if (new_numa) {
+        RETURN_NOT_OK(AllocateNuma(new_size, &out));
+      } else {
+        RETURN_NOT_OK(SystemAllocator::AllocateAligned(new_size, &out));
+      }
+      memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+      Deallocate(*ptr, old_size);
+      *ptr = out;
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) override {
+    Deallocate(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const override { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const override { return stats_.max_memory(); }
+
+  std::string backend_name() const override { return "numa"; }
+
+ private:
+  Status AllocateNuma(int64_t size, uint8_t** out) {
+    // libnuma allocations are page-aligned, which satisfies kAlignment
+    void* data = node_ < 0 ? numa_alloc_local(static_cast<size_t>(size))
+                           : numa_alloc_onnode(static_cast<size_t>(size), node_);
+    if (data == nullptr) {
+      return Status::OutOfMemory("malloc of size ", size, " failed");
+    }
+    *out = reinterpret_cast<uint8_t*>(data);
+    return Status::OK();
+  }
+
+  static void Deallocate(uint8_t* ptr, int64_t size) {
+    if (size < kMinNumaAllocation) {
+      SystemAllocator::DeallocateAligned(ptr, size);
+    } else {
+      numa_free(ptr, static_cast<size_t>(size));
+    }
+  }
+
+  const int node_;
+  internal::MemoryPoolStats stats_;
+};
+
+constexpr int64_t NumaMemoryPool::kMinNumaAllocation;
+
+#endif  // defined(ARROW_WITH_NUMA)
+
 #ifdef ARROW_JEMALLOC
 using DefaultMemoryPool = JemallocMemoryPool;
 #elif defined(ARROW_MIMALLOC)
@@ -409,6 +517,32 @@ Status mimalloc_memory_pool(MemoryPool** out) {
 #endif
 }
 
+Status numa_memory_pool(int node, MemoryPool** out) {
+#ifdef ARROW_WITH_NUMA
+  if (!internal::IsNumaAvailable()) {
+    return Status::NotImplemented("NUMA is not available on this machine");
+  }
+  static const std::vector<std::unique_ptr<NumaMemoryPool>> numa_pools = [] {
+    // The last pool allocates on the node of the calling thread
+    std::vector<std::unique_ptr<NumaMemoryPool>> pools;
+    const int num_nodes = internal::GetNumaNodeCount();
+    for (int i = 0; i < num_nodes; ++i) {
+      pools.emplace_back(new NumaMemoryPool(i));
+    }
+    pools.emplace_back(new NumaMemoryPool(-1));
+    return pools;
+  }();
+  const int num_nodes = static_cast<int>(numa_pools.size()) - 1;
+  if (node < -1 || node >= num_nodes) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  *out = numa_pools[node < 0 ? num_nodes : node].get();
+  return Status::OK();
+#else
+  return Status::NotImplemented("This Arrow build does not enable NUMA support");
+#endif
+}
+
 MemoryPool* default_memory_pool() {
 #ifdef ARROW_JEMALLOC
   return &jemalloc_pool;
@@ -678,5 +812,252 @@ std::shared_ptr<ReservationListener> ReservationListenableMemoryPool::get_listen
   return impl_->get_listener();
 }
 
+///////////////////////////////////////////////////////////////////////
+// HugePageMemoryPool implementation
+
+class HugePageMemoryPool::HugePageMemoryPoolImpl {
+ public:
+  static constexpr int64_t kHugePageSize = 2 * 1024 * 1024;
+
+  HugePageMemoryPoolImpl(MemoryPool* pool, HugePageMemoryPoolOptions options)
+      : pool_(pool), options_(options), bytes_cached_(0) {}
+
+  ~HugePageMemoryPoolImpl() { ReleaseCached(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (IsLarge(size)) {
+      RETURN_NOT_OK(AllocateLarge(size, out));
+    } else {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const bool old_large = IsLarge(old_size);
+    const bool new_large = IsLarge(new_size);
+    if (!old_large && !new_large) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    } else if (old_large && new_large) {
+      RETURN_NOT_OK(ReallocateLarge(old_size, new_size, ptr));
+    } else {
+      uint8_t* out = nullptr;
+      if (new_large) {
+        RETURN_NOT_OK(AllocateLarge(new_size, &out));
+      } else {
+        RETURN_NOT_OK(pool_->Allocate(new_size, &out));
+      }
+      memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      if (old_large) {
+        FreeLarge(*ptr, old_size);
+      } else {
+        pool_->Free(*ptr, old_size);
+      }
+      *ptr = out;
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (IsLarge(size)) {
+      FreeLarge(buffer, size);
+    } else {
+      pool_->Free(buffer, size);
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return pool_->backend_name() + "+hugepage"; }
+
+  int64_t bytes_cached() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_cached_;
+  }
+
+  void ReleaseCached() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& bucket : cache_) {
+      for (uint8_t* mapping : bucket.second) {
+        Unmap(mapping, bucket.first);
+      }
+    }
+    cache_.clear();
+    bytes_cached_ = 0;
+  }
+
+ private:
+  bool IsLarge(int64_t size) const {
+#ifdef _WIN32
+    return false;
+#else
+    return size >= options_.threshold && size > 0;
+#endif
+  }
+
+  // Round a size up to its mapping size.  There are four size classes per
+  // power of two, which bounds the overhead to 25% while giving freed
+  // mappings a good chance of being reused.
+  static int64_t SizeClass(int64_t size) {
+    const int64_t rounded = BitUtil::RoundUp(size, kHugePageSize);
+    const int64_t power_of_two = int64_t(1)
+                                 << (63 - BitUtil::CountLeadingZeros(
+                                              static_cast<uint64_t>(rounded)));
+    return BitUtil::RoundUp(rounded, std::max(power_of_two / 4, kHugePageSize));
+  }
+
+  Status AllocateLarge(int64_t size, uint8_t** out) {
+    if (size > std::numeric_limits<int64_t>::max() / 2) {
+      return Status::OutOfMemory("malloc of size ", size, " failed");
+    }
+    const int64_t size_class = SizeClass(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = cache_.find(size_class);
+      if (it != cache_.end() && !it->second.empty()) {
+        *out = it->second.back();
+        it->second.pop_back();
+        bytes_cached_ -= size_class;
+        return Status::OK();
+      }
+    }
+    return Map(size_class, out);
+  }
+
+  Status ReallocateLarge(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size > std::numeric_limits<int64_t>::max() / 2) {
+      return Status::OutOfMemory("realloc of size ", new_size, " failed");
+    }
+    const int64_t old_class = SizeClass(old_size);
+    const int64_t new_class = SizeClass(new_size);
+    if (old_class == new_class) {
+      return Status::OK();
+    }
+#ifdef __linux__
+    void* remapped = mremap(*ptr, static_cast<size_t>(old_class),
+                            static_cast<size_t>(new_class), MREMAP_MAYMOVE);
+    if (remapped != MAP_FAILED) {
+      *ptr = reinterpret_cast<uint8_t*>(remapped);
+      return Status::OK();
+    }
+    // mremap() can't resize hugetlb mappings, copy instead
+#endif
+    uint8_t* out = nullptr;
+    RETURN_NOT_OK(AllocateLarge(new_size, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    FreeLarge(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void FreeLarge(uint8_t* buffer, int64_t size) {
+    const int64_t size_class = SizeClass(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (bytes_cached_ + size_class <= options_.cache_capacity) {
+        cache_[size_class].push_back(buffer);
+        bytes_cached_ += size_class;
+        return;
+      }
+    }
+    Unmap(buffer, size_class);
+  }
+
+  Status Map(int64_t size_class, uint8_t** out) {
+#ifdef _WIN32
+    return Status::NotImplemented("mmap() not available");
+#else
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef __linux__
+    if (options_.prefault) {
+      flags |= MAP_POPULATE;
+    }
+    if (options_.explicit_huge_pages) {
+      void* data = mmap(nullptr, static_cast<size_t>(size_class), PROT_READ | PROT_WRITE,
+                        flags | MAP_HUGETLB, -1, 0);
+      if (data != MAP_FAILED) {
+        *out = reinterpret_cast<uint8_t*>(data);
+        return Status::OK();
+      }
+      // No reserved huge pages left, fall back on transparent huge pages
+    }
+#endif
+    // Over-allocate so that the mapping can be aligned on a huge page boundary,
+    // otherwise the kernel can't back its first and last pages with huge pages.
+    const size_t map_size = static_cast<size_t>(size_class + kHugePageSize);
+    void* data = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (data == MAP_FAILED) {
+      return Status::OutOfMemory("malloc of size ", size_class, " failed");
+    }
+    uint8_t* start = reinterpret_cast<uint8_t*>(data);
+    uint8_t* aligned = reinterpret_cast<uint8_t*>(
+        BitUtil::RoundUp(reinterpret_cast<int64_t>(start), kHugePageSize));
+    if (aligned > start) {
+      munmap(start, static_cast<size_t>(aligned - start));
+    }
+    const size_t tail = static_cast<size_t>(start + map_size - (aligned + size_class));
+    if (tail > 0) {
+      munmap(aligned + size_class, tail);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(aligned, static_cast<size_t>(size_class), MADV_HUGEPAGE);
+#endif
+    *out = aligned;
+    return Status::OK();
+#endif
+  }
+
+  static void Unmap(uint8_t* mapping, int64_t size_class) {
+#ifndef _WIN32
+    munmap(mapping, static_cast<size_t>(size_class));
+#endif
+  }
+
+  MemoryPool* pool_;
+  const HugePageMemoryPoolOptions options_;
+  internal::MemoryPoolStats stats_;
+
+  std::mutex mutex_;
+  // Freed mappings, by size class
+  std::unordered_map<int64_t, std::vector<uint8_t*>> cache_;
+  int64_t bytes_cached_;
+};
+
+constexpr int64_t HugePageMemoryPool::HugePageMemoryPoolImpl::kHugePageSize;
+
+HugePageMemoryPool::HugePageMemoryPool(MemoryPool* pool,
+                                       HugePageMemoryPoolOptions options) {
+  impl_.reset(new HugePageMemoryPoolImpl(pool, options));
+}
+
+HugePageMemoryPool::~HugePageMemoryPool() {}
+
+Status HugePageMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status HugePageMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void HugePageMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t HugePageMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t HugePageMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string HugePageMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t HugePageMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+void HugePageMemoryPool::ReleaseCached() { impl_->ReleaseCached(); }
 
 }  // namespace arrow
@@ -186,6 +186,69 @@ class ARROW_EXPORT ReservationListenableMemoryPool : public MemoryPool {
   std::unique_ptr<ReservationListenableMemoryPoolImpl> impl_;
 };
 
+/// Options for HugePageMemoryPool.
+struct ARROW_EXPORT HugePageMemoryPoolOptions {
+  /// Allocations of at least this size are served from dedicated mappings;
+  /// smaller ones are delegated to the wrapped pool.
+  int64_t threshold = 4 * 1024 * 1024;
+
+  /// Request explicit huge pages (MAP_HUGETLB).  These must have been reserved
+  /// by the administrator; if none are available, the pool falls back on
+  /// transparent huge pages.  When false, transparent huge pages are requested
+  /// with madvise(MADV_HUGEPAGE).
+  bool explicit_huge_pages = false;
+
+  /// Pre-fault mappings (MAP_POPULATE) so that no page faults are taken when
+  /// the buffer is first written.
+  bool prefault = false;
+
+  /// Maximum number of bytes of freed mappings kept for reuse instead of being
+  /// returned to the OS.  0 disables the cache.
+  int64_t cache_capacity = 256 * 1024 * 1024;
+
+  static HugePageMemoryPoolOptions Defaults() { return HugePageMemoryPoolOptions(); }
+};
+
+/// \brief A MemoryPool serving large allocations from huge pages.
+///
+/// Allocations above a threshold are served from anonymous mappings backed by
+/// transparent or explicit huge pages, optionally pre-faulted, and rounded up
+/// to a size class.  Freed mappings are kept in a size-bucketed cache and
+/// recycled by later allocations of the same class, so that repeatedly
+/// decoding large columns doesn't pay for page faults again.  Reallocations
+/// within a size class are free; on Linux, growing a mapping doesn't copy.
+///
+/// On platforms without mmap(), all allocations are delegated to the wrapped
+/// pool.
+class ARROW_EXPORT HugePageMemoryPool : public MemoryPool {
+ public:
+  explicit HugePageMemoryPool(
+      MemoryPool* pool,
+      HugePageMemoryPoolOptions options = HugePageMemoryPoolOptions::Defaults());
+  ~HugePageMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes of freed mappings currently held for reuse.
+  int64_t bytes_cached() const;
+
+  /// Return all cached mappings to the OS.
+  void ReleaseCached();
+
+ private:
+  class HugePageMemoryPoolImpl;
+  std::unique_ptr<HugePageMemoryPoolImpl> impl_;
+};
+
 /// Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -210,4 +273,14 @@ Status jemalloc_set_decay_ms(int ms);
 /// May return NotImplemented if mimalloc is not available.
 ARROW_EXPORT Status mimalloc_memory_pool(MemoryPool** out);
 
+/// Return a process-wide memory pool allocating memory local to a NUMA node.
+///
+/// Allocations of at least 128 KiB are bound to the node's memory through
+/// libnuma; smaller ones go to the system allocator and are placed by the
+/// kernel's first-touch policy.  Pass -1 as node to allocate on the node the
+/// calling thread is running on.
+///
+/// May return NotImplemented if NUMA support is not available.
+ARROW_EXPORT Status numa_memory_pool(int node, MemoryPool** out);
+
 }  // namespace arrow
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 
 #include <gtest/gtest.h>
 
@@ -54,6 +55,18 @@ struct MimallocMemoryPoolFactory {
 };
 #endif
 
+struct HugePageMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    // Use a low threshold so that all allocations take the huge page path
+    static HugePageMemoryPool pool(system_memory_pool(), [] {
+      auto options = HugePageMemoryPoolOptions::Defaults();
+      options.threshold = 1;
+      return options;
+    }());
+    return &pool;
+  }
+};
+
 template <typename Factory>
 class TestMemoryPool : public ::arrow::TestMemoryPoolBase {
  public:
@@ -76,6 +89,7 @@ REGISTER_TYPED_TEST_SUITE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_SUITE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(HugePage, TestMemoryPool, HugePageMemoryPoolFactory);
 
 #ifdef ARROW_JEMALLOC
 INSTANTIATE_TYPED_TEST_SUITE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFactory);
@@ -85,6 +99,107 @@ INSTANTIATE_TYPED_TEST_SUITE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFacto
 INSTANTIATE_TYPED_TEST_SUITE_P(Mimalloc, TestMemoryPool, MimallocMemoryPoolFactory);
 #endif
 
+TEST(NumaMemoryPool, AllocateReallocate) {
+  MemoryPool* pool;
+  Status st = numa_memory_pool(-1, &pool);
+  if (st.IsNotImplemented()) {
+    return;
+  }
+  ASSERT_OK(st);
+  ASSERT_EQ(pool->backend_name(), "numa");
+  ASSERT_RAISES(Invalid, numa_memory_pool(-2, &pool));
+  ASSERT_OK(numa_memory_pool(0, &pool));
+
+  // Cross the threshold between system and NUMA allocations both ways
+  const int64_t small_size = 100;
+  const int64_t large_size = 1 << 20;
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(small_size, &data));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+  std::memset(data, 0xAB, small_size);
+  ASSERT_OK(pool->Reallocate(small_size, large_size, &data));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+  ASSERT_EQ(0xAB, data[small_size - 1]);
+  std::memset(data, 0xCD, large_size);
+  ASSERT_OK(pool->Reallocate(large_size, 2 * large_size, &data));
+  ASSERT_EQ(0xCD, data[large_size - 1]);
+  ASSERT_EQ(2 * large_size, pool->bytes_allocated());
+  ASSERT_OK(pool->Reallocate(2 * large_size, small_size, &data));
+  ASSERT_EQ(0xCD, data[small_size - 1]);
+  pool->Free(data, small_size);
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(HugePageMemoryPool, ExplicitHugePagesReallocate) {
+  // hugetlb mappings can't be resized with mremap(), the pool copies them
+  // instead.  Without reserved huge pages this exercises the fallback mappings.
+  constexpr int64_t kMiB = 1024 * 1024;
+  auto options = HugePageMemoryPoolOptions::Defaults();
+  options.threshold = kMiB;
+  options.explicit_huge_pages = true;
+  HugePageMemoryPool pool(system_memory_pool(), options);
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(2 * kMiB, &data));
+  std::memset(data, 0xAB, 2 * kMiB);
+  ASSERT_OK(pool.Reallocate(2 * kMiB, 10 * kMiB, &data));
+  ASSERT_EQ(0xAB, data[2 * kMiB - 1]);
+  std::memset(data, 0xCD, 10 * kMiB);
+  ASSERT_OK(pool.Reallocate(10 * kMiB, 4 * kMiB, &data));
+  ASSERT_EQ(0xCD, data[4 * kMiB - 1]);
+  ASSERT_EQ(4 * kMiB, pool.bytes_allocated());
+  pool.Free(data, 4 * kMiB);
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(HugePageMemoryPool, Cache) {
+  constexpr int64_t kMiB = 1024 * 1024;
+  auto options = HugePageMemoryPoolOptions::Defaults();
+  options.threshold = kMiB;
+  options.cache_capacity = 8 * kMiB;
+  options.prefault = true;
+  HugePageMemoryPool pool(system_memory_pool(), options);
+
+  // Small allocations are delegated
+  uint8_t* small;
+  ASSERT_OK(pool.Allocate(100, &small));
+  ASSERT_EQ(100, system_memory_pool()->bytes_allocated());
+  pool.Free(small, 100);
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(3 * kMiB, &data));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+  std::memset(data, 0xAB, 3 * kMiB);
+  uint8_t* first = data;
+  pool.Free(data, 3 * kMiB);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  // 3 MiB rounds up to a 4 MiB mapping
+  ASSERT_EQ(4 * kMiB, pool.bytes_cached());
+
+  // An allocation of the same size class recycles the mapping
+  ASSERT_OK(pool.Allocate(4 * kMiB, &data));
+  ASSERT_EQ(first, data);
+  ASSERT_EQ(0, pool.bytes_cached());
+
+  // Reallocating within the size class doesn't move the data
+  ASSERT_OK(pool.Reallocate(4 * kMiB, 3 * kMiB + 1, &data));
+  ASSERT_EQ(first, data);
+  ASSERT_OK(pool.Reallocate(3 * kMiB + 1, 6 * kMiB, &data));
+  ASSERT_EQ(0xAB, data[3 * kMiB - 1]);
+  ASSERT_EQ(6 * kMiB, pool.bytes_allocated());
+  pool.Free(data, 6 * kMiB);
+  ASSERT_EQ(6 * kMiB, pool.bytes_cached());
+
+  // Mappings exceeding the cache capacity are returned to the OS
+  ASSERT_OK(pool.Allocate(12 * kMiB, &data));
+  pool.Free(data, 12 * kMiB);
+  ASSERT_EQ(6 * kMiB, pool.bytes_cached());
+
+  pool.ReleaseCached();
+  ASSERT_EQ(0, pool.bytes_cached());
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
 // Death tests and valgrind are known to not play well 100% of the time. See
 // googletest documentation
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
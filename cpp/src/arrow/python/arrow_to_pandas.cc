@@ -24,6 +24,7 @@
 #include <cmath>
 #include <cstdint>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -102,14 +103,14 @@ struct WrapBytes {};
 template <>
 struct WrapBytes<StringType> {
   static inline PyObject* Wrap(const char* data, int64_t length) {
-    return PyUnicode_FromStringAndSize(data, length);
+    return internal::PyUnicode_FromUtf8(data, length);
   }
 };
 
 template <>
 struct WrapBytes<LargeStringType> {
   static inline PyObject* Wrap(const char* data, int64_t length) {
-    return PyUnicode_FromStringAndSize(data, length);
+    return internal::PyUnicode_FromUtf8(data, length);
   }
 };
 
@@ -575,8 +576,7 @@ inline Status ConvertAsPyObjects(const PandasOptions& options, const ChunkedArra
   using ArrayType = typename TypeTraits<Type>::ArrayType;
   using Scalar = typename MemoizationTraits<Type>::Scalar;
 
-  // TODO(fsaintjacques): propagate memory pool.
-  ::arrow::internal::ScalarMemoTable<Scalar> memo_table(default_memory_pool());
+  ::arrow::internal::ScalarMemoTable<Scalar> memo_table(options.pool);
   std::vector<PyObject*> unique_values;
   int32_t memo_size = 0;
 
@@ -1119,6 +1119,12 @@ class BoolWriter : public TypedPandasWriter<NPY_BOOL> {
 // ----------------------------------------------------------------------
 // Date / timestamp types
 
+inline Status TimestampOutOfBounds(const DataType& type, int64_t value) {
+  return Status::Invalid("Casting from ", type.ToString(), " to ",
+                         timestamp(TimeUnit::NANO)->ToString(),
+                         " would result in out of bounds timestamp: ", value);
+}
+
 template <typename T, int64_t SHIFT>
 inline void ConvertDatetimeLikeNanos(const ChunkedArray& data, int64_t* out_values) {
   for (int c = 0; c < data.num_chunks(); c++) {
@@ -1132,6 +1138,57 @@ inline void ConvertDatetimeLikeNanos(const ChunkedArray& data, int64_t* out_valu
   }
 }
 
+// Scale timestamps to nanoseconds directly into the output block, checking
+// for overflow of the valid values if safe
+// Multiply as unsigned so that overflow wraps around if not checked
+inline int64_t ScaleTimestamp(int64_t value, int64_t factor) {
+  return static_cast<int64_t>(static_cast<uint64_t>(value) *
+                              static_cast<uint64_t>(factor));
+}
+
+template <int64_t FACTOR>
+Status ConvertTimestampNanos(const ChunkedArray& data, bool safe, int64_t* out_values) {
+  constexpr int64_t kMaxValue = std::numeric_limits<int64_t>::max() / FACTOR;
+  constexpr int64_t kMinValue = std::numeric_limits<int64_t>::min() / FACTOR;
+  for (int c = 0; c < data.num_chunks(); c++) {
+    const auto& arr = *data.chunk(c);
+    const int64_t* in_values = GetPrimitiveValues<int64_t>(arr);
+
+    if (arr.null_count() > 0) {
+      for (int64_t i = 0; i < arr.length(); ++i) {
+        if (arr.IsNull(i)) {
+          out_values[i] = kPandasTimestampNull;
+          continue;
+        }
+        if (safe && (in_values[i] < kMinValue || in_values[i] > kMaxValue)) {
+          return TimestampOutOfBounds(*arr.type(), in_values[i]);
+        }
+        out_values[i] = ScaleTimestamp(in_values[i], FACTOR);
+      }
+    } else {
+      if (safe) {
+        // Check the whole chunk first so that the scaling loop vectorizes
+        bool in_bounds = true;
+        for (int64_t i = 0; i < arr.length(); ++i) {
+          in_bounds &= in_values[i] >= kMinValue && in_values[i] <= kMaxValue;
+        }
+        if (!in_bounds) {
+          for (int64_t i = 0; i < arr.length(); ++i) {
+            if (in_values[i] < kMinValue || in_values[i] > kMaxValue) {
+              return TimestampOutOfBounds(*arr.type(), in_values[i]);
+            }
+          }
+        }
+      }
+      for (int64_t i = 0; i < arr.length(); ++i) {
+        out_values[i] = ScaleTimestamp(in_values[i], FACTOR);
+      }
+    }
+    out_values += arr.length();
+  }
+  return Status::OK();
+}
+
 template <typename T, int SHIFT>
 void ConvertDatesShift(const ChunkedArray& data, int64_t* out_values) {
   for (int c = 0; c < data.num_chunks(); c++) {
@@ -1212,15 +1269,6 @@ class DatetimeNanoWriter : public DatetimeWriter<TimeUnit::NANO> {
   Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
     Type::type type = data->type()->id();
     int64_t* out_values = this->GetBlockColumnStart(rel_placement);
-    compute::FunctionContext ctx(options_.pool);
-    compute::CastOptions options;
-    if (options_.safe_cast) {
-      options = compute::CastOptions::Safe();
-    } else {
-      options = compute::CastOptions::Unsafe();
-    }
-    compute::Datum out;
-    auto target_type = timestamp(TimeUnit::NANO);
 
     if (type == Type::DATE32) {
       // Convert from days since epoch to datetime64[ns]
@@ -1232,16 +1280,19 @@ class DatetimeNanoWriter : public DatetimeWriter<TimeUnit::NANO> {
     } else if (type == Type::TIMESTAMP) {
       const auto& ts_type = checked_cast<const TimestampType&>(*data->type());
 
-      if (ts_type.unit() == TimeUnit::NANO) {
-        ConvertNumericNullable<int64_t>(*data, kPandasTimestampNull, out_values);
-      } else if (ts_type.unit() == TimeUnit::MICRO || ts_type.unit() == TimeUnit::MILLI ||
-                 ts_type.unit() == TimeUnit::SECOND) {
-        RETURN_NOT_OK(
-            arrow::compute::Cast(&ctx, compute::Datum(data), target_type, options, &out));
-        ConvertNumericNullable<int64_t>(*out.chunked_array(), kPandasTimestampNull,
-                                        out_values);
-      } else {
-        return Status::NotImplemented("Unsupported time unit");
+      switch (ts_type.unit()) {
+        case TimeUnit::NANO:
+          ConvertNumericNullable<int64_t>(*data, kPandasTimestampNull, out_values);
+          break;
+        case TimeUnit::MICRO:
+          return ConvertTimestampNanos<1000L>(*data, options_.safe_cast, out_values);
+        case TimeUnit::MILLI:
+          return ConvertTimestampNanos<1000000L>(*data, options_.safe_cast, out_values);
+        case TimeUnit::SECOND:
+          return ConvertTimestampNanos<1000000000L>(*data, options_.safe_cast,
+                                                    out_values);
+        default:
+          return Status::NotImplemented("Unsupported time unit");
       }
     } else {
       return Status::NotImplemented("Cannot write Arrow data of type ",
@@ -1362,6 +1413,16 @@ Status CheckDictionaryIndices(const Array& arr, int64_t dict_length) {
   const auto& typed_arr =
       checked_cast<const typename TypeTraits<IndexType>::ArrayType&>(arr);
   const typename IndexType::c_type* values = typed_arr.raw_values();
+  if (arr.null_count() == 0) {
+    // Check all indices at once so that the loop vectorizes
+    bool in_bounds = true;
+    for (int64_t i = 0; i < arr.length(); ++i) {
+      in_bounds &= values[i] >= 0 && values[i] < dict_length;
+    }
+    if (in_bounds) {
+      return Status::OK();
+    }
+  }
   for (int64_t i = 0; i < arr.length(); ++i) {
     if (arr.IsValid(i) && (values[i] < 0 || values[i] >= dict_length)) {
       return Status::Invalid("Out of bounds dictionary index: ",
@@ -1449,6 +1510,13 @@ class CategoricalWriter
       auto values = reinterpret_cast<const T*>(indices.raw_values());
 
       int64_t dict_length = arr.dictionary()->length();
+      if (indices.null_count() == 0) {
+        // The codes are the indices themselves
+        RETURN_NOT_OK(CheckDictionaryIndices<IndexType>(indices, dict_length));
+        memcpy(out_values, values, sizeof(T) * indices.length());
+        out_values += indices.length();
+        continue;
+      }
       // Null is -1 in CategoricalBlock
       for (int i = 0; i < arr.length(); ++i) {
         if (indices.IsValid(i)) {
@@ -1962,24 +2030,34 @@ class SplitBlockCreator : public PandasBlockCreator {
   }
 
   Status Convert(PyObject** out) override {
+    // Write the columns concurrently if use_threads, as for consolidated
+    // blocks. Writers only take the GIL to allocate and to create Python
+    // objects.
+    writers_.resize(num_columns_);
+    auto WriteColumn = [this](int i) {
+      std::shared_ptr<PandasWriter> writer;
+      RETURN_NOT_OK(GetWriter(i, &writer));
+      // ARROW-3789 Use std::move on the array to permit self-destructing
+      RETURN_NOT_OK(writer->Write(std::move(arrays_[i]), i, /*rel_placement=*/0));
+      writers_[i] = std::move(writer);
+      return Status::OK();
+    };
+    RETURN_NOT_OK(OptionalParallelFor(options_.use_threads, num_columns_, WriteColumn));
+
     PyAcquireGIL lock;
 
     PyObject* result = PyList_New(0);
     RETURN_IF_PYERROR();
 
     for (int i = 0; i < num_columns_; ++i) {
-      std::shared_ptr<PandasWriter> writer;
-      RETURN_NOT_OK(GetWriter(i, &writer));
-      // ARROW-3789 Use std::move on the array to permit self-destructing
-      RETURN_NOT_OK(writer->Write(std::move(arrays_[i]), i, /*rel_placement=*/0));
-
       PyObject* item;
-      RETURN_NOT_OK(writer->GetDataFrameResult(&item));
+      RETURN_NOT_OK(writers_[i]->GetDataFrameResult(&item));
       if (PyList_Append(result, item) < 0) {
         RETURN_IF_PYERROR();
       }
       // PyList_Append increments object refcount
       Py_DECREF(item);
+      writers_[i].reset();
     }
 
     *out = result;
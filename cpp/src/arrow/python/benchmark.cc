@@ -33,6 +33,27 @@ void Benchmark_PandasObjectIsNull(PyObject* list) {
   }
 }
 
+void Benchmark_PyUnicode_FromUtf8(PyObject* list) {
+  if (!PyList_CheckExact(list)) {
+    PyErr_SetString(PyExc_TypeError, "expected a list");
+    return;
+  }
+  Py_ssize_t i, n = PyList_GET_SIZE(list);
+  for (i = 0; i < n; i++) {
+    PyObject* item = PyList_GET_ITEM(list, i);
+    if (!PyBytes_Check(item)) {
+      PyErr_SetString(PyExc_TypeError, "expected a list of bytes");
+      return;
+    }
+    PyObject* unicode =
+        internal::PyUnicode_FromUtf8(PyBytes_AS_STRING(item), PyBytes_GET_SIZE(item));
+    if (unicode == nullptr) {
+      return;
+    }
+    Py_DECREF(unicode);
+  }
+}
+
 }  // namespace benchmark
 }  // namespace py
 }  // namespace arrow
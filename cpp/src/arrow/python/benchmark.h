@@ -31,6 +31,11 @@ namespace benchmark {
 ARROW_PYTHON_EXPORT
 void Benchmark_PandasObjectIsNull(PyObject* list);
 
+// Create a unicode string from each UTF-8 bytes object in *list*, as done
+// when converting string arrays to pandas
+ARROW_PYTHON_EXPORT
+void Benchmark_PyUnicode_FromUtf8(PyObject* list);
+
 }  // namespace benchmark
 }  // namespace py
 }  // namespace arrow
@@ -20,6 +20,7 @@
 
 #include "arrow/python/helpers.h"
 
+#include <cstring>
 #include <limits>
 #include <sstream>
 #include <type_traits>
@@ -104,6 +105,30 @@ Status PyUnicode_AsStdString(PyObject* obj, std::string* out) {
   return Status::OK();
 }
 
+PyObject* PyUnicode_FromUtf8(const char* data, int64_t length) {
+  // PyUnicode_FromStringAndSize validates and decodes its input a character at
+  // a time. ASCII data, 8 bytes at a time free of any high bit, is already in
+  // the 1-byte-per-character representation of a compact unicode object.
+  uint64_t high_bits = 0;
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, data + i, 8);
+    high_bits |= word;
+  }
+  for (; i < length; ++i) {
+    high_bits |= static_cast<uint8_t>(data[i]);
+  }
+  if ((high_bits & 0x8080808080808080ULL) != 0) {
+    return PyUnicode_FromStringAndSize(data, static_cast<Py_ssize_t>(length));
+  }
+  PyObject* out = PyUnicode_New(static_cast<Py_ssize_t>(length), 127);
+  if (out != nullptr) {
+    std::memcpy(PyUnicode_DATA(out), data, static_cast<size_t>(length));
+  }
+  return out;
+}
+
 std::string PyObject_StdStringRepr(PyObject* obj) {
   OwnedRef unicode_ref(PyObject_Repr(obj));
   OwnedRef bytes_ref;
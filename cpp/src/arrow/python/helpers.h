@@ -91,6 +91,11 @@ Status CIntFromPython(PyObject* obj, Int* out, const std::string& overflow_messa
 ARROW_PYTHON_EXPORT
 Status PyUnicode_AsStdString(PyObject* obj, std::string* out);
 
+// \brief Create a Python unicode string from UTF-8 data, copying ASCII data
+// without decoding it
+ARROW_PYTHON_EXPORT
+PyObject* PyUnicode_FromUtf8(const char* data, int64_t length);
+
 // \brief Convert a Python bytes object to a std::string
 ARROW_PYTHON_EXPORT
 std::string PyBytes_AsStdString(PyObject* obj);
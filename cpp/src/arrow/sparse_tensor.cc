@@ -27,6 +27,8 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -46,18 +48,49 @@ Status SparseIndex::ValidateShape(const std::vector<int64_t>& shape) const {
 
 namespace internal {
 
+// The minimum number of tensor cells converted by a thread
+constexpr int64_t kMinParallelConversionSize = 1 << 16;
+
+std::vector<int64_t> SplitTensorRows(const std::vector<int64_t>& shape,
+                                     bool use_threads) {
+  const int64_t num_rows = shape.empty() ? 1 : shape[0];
+  const int64_t size = std::accumulate(shape.begin(), shape.end(), int64_t(1),
+                                       std::multiplies<int64_t>());
+  int64_t num_ranges = 1;
+  if (use_threads) {
+    num_ranges = std::min<int64_t>(GetCpuThreadPoolCapacity(), num_rows);
+    num_ranges = std::min<int64_t>(num_ranges, size / kMinParallelConversionSize);
+    num_ranges = std::max<int64_t>(num_ranges, 1);
+  }
+  std::vector<int64_t> bounds(num_ranges + 1);
+  for (int64_t i = 0; i <= num_ranges; ++i) {
+    bounds[i] = num_rows * i / num_ranges;
+  }
+  return bounds;
+}
+
 Status MakeSparseTensorFromTensor(const Tensor& tensor,
                                   SparseTensorFormat::type sparse_format_id,
                                   const std::shared_ptr<DataType>& index_value_type,
                                   MemoryPool* pool,
                                   std::shared_ptr<SparseIndex>* out_sparse_index,
                                   std::shared_ptr<Buffer>* out_data) {
+  return MakeSparseTensorFromTensor(tensor, sparse_format_id, index_value_type, pool,
+                                    /*use_threads=*/false, out_sparse_index, out_data);
+}
+
+Status MakeSparseTensorFromTensor(const Tensor& tensor,
+                                  SparseTensorFormat::type sparse_format_id,
+                                  const std::shared_ptr<DataType>& index_value_type,
+                                  MemoryPool* pool, bool use_threads,
+                                  std::shared_ptr<SparseIndex>* out_sparse_index,
+                                  std::shared_ptr<Buffer>* out_data) {
   switch (sparse_format_id) {
     case SparseTensorFormat::COO:
-      return MakeSparseCOOTensorFromTensor(tensor, index_value_type, pool,
+      return MakeSparseCOOTensorFromTensor(tensor, index_value_type, pool, use_threads,
                                            out_sparse_index, out_data);
     case SparseTensorFormat::CSR:
-      return MakeSparseCSRMatrixFromTensor(tensor, index_value_type, pool,
+      return MakeSparseCSRMatrixFromTensor(tensor, index_value_type, pool, use_threads,
                                            out_sparse_index, out_data);
     case SparseTensorFormat::CSC:
       return MakeSparseCSCMatrixFromTensor(tensor, index_value_type, pool,
@@ -102,9 +135,17 @@ void ExpandSparseCSFTensorValues(int64_t dimension, int64_t dense_offset,
 
 }  // namespace
 
+// Read the i-th value of a one-dimensional index tensor
+template <typename IndexValueType>
+inline int64_t GetIndexValue(const Tensor& indices, int64_t i) {
+  using c_index_value_type = typename IndexValueType::c_type;
+  return static_cast<int64_t>(*reinterpret_cast<const c_index_value_type*>(
+      indices.raw_data() + i * indices.strides()[0]));
+}
+
 template <typename TYPE, typename IndexValueType>
 Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_tensor,
-                                  std::shared_ptr<Tensor>* out) {
+                                  bool use_threads, std::shared_ptr<Tensor>* out) {
   using c_index_value_type = typename IndexValueType::c_type;
   using NumericTensorType = NumericTensor<TYPE>;
   using value_type = typename NumericTensorType::value_type;
@@ -113,7 +154,16 @@ Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_t
                         AllocateBuffer(sizeof(value_type) * sparse_tensor->size(), pool));
   auto values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
 
-  std::fill_n(values, sparse_tensor->size(), static_cast<value_type>(0));
+  // The values of each format are scattered to distinct cells, so that the
+  // ranges below can be written concurrently.
+  const std::vector<int64_t> fill_ranges =
+      SplitTensorRows({sparse_tensor->size()}, use_threads);
+  RETURN_NOT_OK(OptionalParallelFor(
+      use_threads, static_cast<int>(fill_ranges.size()) - 1, [&](int i) {
+        std::fill(values + fill_ranges[i], values + fill_ranges[i + 1],
+                  static_cast<value_type>(0));
+        return Status::OK();
+      }));
 
   std::vector<int64_t> strides(sparse_tensor->ndim(), 1);
   for (int i = sparse_tensor->ndim() - 1; i > 0; --i) {
@@ -128,16 +178,27 @@ Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_t
       const auto& sparse_index =
           internal::checked_cast<const SparseCOOIndex&>(*sparse_tensor->sparse_index());
       const std::shared_ptr<const Tensor> coords = sparse_index.indices();
-
-      for (int64_t i = 0; i < sparse_tensor->non_zero_length(); ++i) {
-        std::vector<c_index_value_type> coord(sparse_tensor->ndim());
-        int64_t offset = 0;
-        for (int64_t j = 0; j < static_cast<int>(coord.size()); ++j) {
-          coord[j] = coords->Value<IndexValueType>({i, j});
-          offset += coord[j] * strides[j];
-        }
-        values[offset] = raw_data[i];
-      }
+      const uint8_t* coords_data = coords->raw_data();
+      const int64_t coords_row_stride = coords->strides()[0];
+      const int64_t coords_column_stride = coords->strides()[1];
+      const int ndim = sparse_tensor->ndim();
+
+      const std::vector<int64_t> ranges =
+          SplitTensorRows(coords->shape(), use_threads);
+      RETURN_NOT_OK(OptionalParallelFor(
+          use_threads, static_cast<int>(ranges.size()) - 1, [&](int n) {
+            for (int64_t i = ranges[n]; i < ranges[n + 1]; ++i) {
+              const uint8_t* coord = coords_data + i * coords_row_stride;
+              int64_t offset = 0;
+              for (int j = 0; j < ndim; ++j) {
+                offset += *reinterpret_cast<const c_index_value_type*>(
+                              coord + j * coords_column_stride) *
+                          strides[j];
+              }
+              values[offset] = raw_data[i];
+            }
+            return Status::OK();
+          }));
       *out = std::make_shared<Tensor>(sparse_tensor->type(), std::move(values_buffer),
                                       sparse_tensor->shape(), empty_strides,
                                       sparse_tensor->dim_names());
@@ -147,18 +208,23 @@ Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_t
     case SparseTensorFormat::CSR: {
       const auto& sparse_index =
           internal::checked_cast<const SparseCSRIndex&>(*sparse_tensor->sparse_index());
-      const std::shared_ptr<const Tensor> indptr = sparse_index.indptr();
-      const std::shared_ptr<const Tensor> indices = sparse_index.indices();
-
-      int64_t offset;
-      for (int64_t i = 0; i < indptr->size() - 1; ++i) {
-        const int64_t start = indptr->Value<IndexValueType>({i});
-        const int64_t stop = indptr->Value<IndexValueType>({i + 1});
-        for (int64_t j = start; j < stop; ++j) {
-          offset = indices->Value<IndexValueType>({j}) + i * sparse_tensor->shape()[1];
-          values[offset] = raw_data[j];
-        }
-      }
+      const Tensor& indptr = *sparse_index.indptr();
+      const Tensor& indices = *sparse_index.indices();
+      const int64_t nc = sparse_tensor->shape()[1];
+
+      const std::vector<int64_t> ranges =
+          SplitTensorRows(sparse_tensor->shape(), use_threads);
+      RETURN_NOT_OK(OptionalParallelFor(
+          use_threads, static_cast<int>(ranges.size()) - 1, [&](int n) {
+            for (int64_t i = ranges[n]; i < ranges[n + 1]; ++i) {
+              const int64_t start = GetIndexValue<IndexValueType>(indptr, i);
+              const int64_t stop = GetIndexValue<IndexValueType>(indptr, i + 1);
+              for (int64_t j = start; j < stop; ++j) {
+                values[GetIndexValue<IndexValueType>(indices, j) + i * nc] = raw_data[j];
+              }
+            }
+            return Status::OK();
+          }));
       *out = std::make_shared<Tensor>(sparse_tensor->type(), std::move(values_buffer),
                                       sparse_tensor->shape(), empty_strides,
                                       sparse_tensor->dim_names());
@@ -168,18 +234,24 @@ Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_t
     case SparseTensorFormat::CSC: {
       const auto& sparse_index =
           internal::checked_cast<const SparseCSCIndex&>(*sparse_tensor->sparse_index());
-      const std::shared_ptr<const Tensor> indptr = sparse_index.indptr();
-      const std::shared_ptr<const Tensor> indices = sparse_index.indices();
-
-      int64_t offset;
-      for (int64_t j = 0; j < indptr->size() - 1; ++j) {
-        const int64_t start = indptr->Value<IndexValueType>({j});
-        const int64_t stop = indptr->Value<IndexValueType>({j + 1});
-        for (int64_t i = start; i < stop; ++i) {
-          offset = j + indices->Value<IndexValueType>({i}) * sparse_tensor->shape()[1];
-          values[offset] = raw_data[i];
-        }
-      }
+      const Tensor& indptr = *sparse_index.indptr();
+      const Tensor& indices = *sparse_index.indices();
+      const int64_t nc = sparse_tensor->shape()[1];
+
+      // Split the columns
+      const std::vector<int64_t> ranges =
+          SplitTensorRows({nc, sparse_tensor->shape()[0]}, use_threads);
+      RETURN_NOT_OK(OptionalParallelFor(
+          use_threads, static_cast<int>(ranges.size()) - 1, [&](int n) {
+            for (int64_t j = ranges[n]; j < ranges[n + 1]; ++j) {
+              const int64_t start = GetIndexValue<IndexValueType>(indptr, j);
+              const int64_t stop = GetIndexValue<IndexValueType>(indptr, j + 1);
+              for (int64_t i = start; i < stop; ++i) {
+                values[j + GetIndexValue<IndexValueType>(indices, i) * nc] = raw_data[i];
+              }
+            }
+            return Status::OK();
+          }));
       *out = std::make_shared<Tensor>(sparse_tensor->type(), std::move(values_buffer),
                                       sparse_tensor->shape(), empty_strides,
                                       sparse_tensor->dim_names());
@@ -204,13 +276,13 @@ Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_t
 
 #define MAKE_TENSOR_FROM_SPARSE_TENSOR_INDEX_TYPE(IndexValueType)                      \
   case IndexValueType##Type::type_id:                                                  \
-    return MakeTensorFromSparseTensor<TYPE, IndexValueType##Type>(pool, sparse_tensor, \
-                                                                  out);                \
+    return MakeTensorFromSparseTensor<TYPE, IndexValueType##Type>(                     \
+        pool, sparse_tensor, use_threads, out);                                        \
     break;
 
 template <typename TYPE>
 Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_tensor,
-                                  std::shared_ptr<Tensor>* out) {
+                                  bool use_threads, std::shared_ptr<Tensor>* out) {
   std::shared_ptr<DataType> type;
   switch (sparse_tensor->format_id()) {
     case SparseTensorFormat::COO: {
@@ -261,10 +333,10 @@ Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_t
 
 #define MAKE_TENSOR_FROM_SPARSE_TENSOR_VALUE_TYPE(TYPE) \
   case TYPE##Type::type_id:                             \
-    return MakeTensorFromSparseTensor<TYPE##Type>(pool, sparse_tensor, out);
+    return MakeTensorFromSparseTensor<TYPE##Type>(pool, sparse_tensor, use_threads, out);
 
 Status MakeTensorFromSparseTensor(MemoryPool* pool, const SparseTensor* sparse_tensor,
-                                  std::shared_ptr<Tensor>* out) {
+                                  bool use_threads, std::shared_ptr<Tensor>* out) {
   switch (sparse_tensor->type()->id()) {
     ARROW_GENERATE_FOR_ALL_NUMERIC_TYPES(MAKE_TENSOR_FROM_SPARSE_TENSOR_VALUE_TYPE);
     // LCOV_EXCL_START: ignore program failure
@@ -485,7 +557,12 @@ bool SparseTensor::Equals(const SparseTensor& other, const EqualOptions& opts) c
 }
 
 Status SparseTensor::ToTensor(MemoryPool* pool, std::shared_ptr<Tensor>* out) const {
-  return internal::MakeTensorFromSparseTensor(pool, this, out);
+  return internal::MakeTensorFromSparseTensor(pool, this, /*use_threads=*/false, out);
+}
+
+Status SparseTensor::ToTensor(MemoryPool* pool, bool use_threads,
+                              std::shared_ptr<Tensor>* out) const {
+  return internal::MakeTensorFromSparseTensor(pool, this, use_threads, out);
 }
 
 }  // namespace arrow
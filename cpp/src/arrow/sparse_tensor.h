@@ -468,6 +468,14 @@ class ARROW_EXPORT SparseTensor {
   /// The returned Tensor has row-major order (C-like).
   Status ToTensor(MemoryPool* pool, std::shared_ptr<Tensor>* out) const;
 
+  /// \brief Return dense representation of sparse tensor as tensor
+  /// using specified memory pool
+  ///
+  /// If use_threads is true, a COO, CSR or CSC sparse tensor is expanded on
+  /// the CPU thread pool. The returned Tensor has row-major order (C-like).
+  Status ToTensor(MemoryPool* pool, bool use_threads,
+                  std::shared_ptr<Tensor>* out) const;
+
  protected:
   // Constructor with all attributes
   SparseTensor(const std::shared_ptr<DataType>& type, const std::shared_ptr<Buffer>& data,
@@ -497,6 +505,14 @@ Status MakeSparseTensorFromTensor(const Tensor& tensor,
                                   std::shared_ptr<SparseIndex>* out_sparse_index,
                                   std::shared_ptr<Buffer>* out_data);
 
+ARROW_EXPORT
+Status MakeSparseTensorFromTensor(const Tensor& tensor,
+                                  SparseTensorFormat::type sparse_format_id,
+                                  const std::shared_ptr<DataType>& index_value_type,
+                                  MemoryPool* pool, bool use_threads,
+                                  std::shared_ptr<SparseIndex>* out_sparse_index,
+                                  std::shared_ptr<Buffer>* out_data);
+
 }  // namespace internal
 
 /// \brief EXPERIMENTAL: Concrete sparse tensor implementation classes with sparse index
@@ -540,14 +556,17 @@ class SparseTensorImpl : public SparseTensor {
   ///
   /// The dense tensor is re-encoded as a sparse index and a physical
   /// data buffer for the non-zero value.
+  ///
+  /// If use_threads is true, a large row-major tensor is converted to COO or CSR
+  /// on the CPU thread pool, split into ranges of rows along its first axis.
   static inline Result<std::shared_ptr<SparseTensorImpl<SparseIndexType>>> Make(
       const Tensor& tensor, const std::shared_ptr<DataType>& index_value_type,
-      MemoryPool* pool = default_memory_pool()) {
+      MemoryPool* pool = default_memory_pool(), bool use_threads = false) {
     std::shared_ptr<SparseIndex> sparse_index;
     std::shared_ptr<Buffer> data;
     ARROW_RETURN_NOT_OK(internal::MakeSparseTensorFromTensor(
-        tensor, SparseIndexType::format_id, index_value_type, pool, &sparse_index,
-        &data));
+        tensor, SparseIndexType::format_id, index_value_type, pool, use_threads,
+        &sparse_index, &data));
     return std::make_shared<SparseTensorImpl<SparseIndexType>>(
         internal::checked_pointer_cast<SparseIndexType>(sparse_index), tensor.type(),
         data, tensor.shape(), tensor.dim_names_);
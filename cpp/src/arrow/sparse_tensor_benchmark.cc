@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/buffer.h"
+#include "arrow/sparse_tensor.h"
+#include "arrow/tensor.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+
+constexpr int64_t kNumRows = 4096;
+constexpr int64_t kNumCols = 1024;
+
+// A row-major double matrix of which about 10% of the values are non-zero
+static std::shared_ptr<Tensor> MakeSparseMatrix() {
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(AllocateBuffer(kNumRows * kNumCols * sizeof(double)).Value(&buffer));
+  auto values = reinterpret_cast<double*>(buffer->mutable_data());
+
+  std::default_random_engine gen(42);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  for (int64_t i = 0; i < kNumRows * kNumCols; ++i) {
+    const double value = dist(gen);
+    values[i] = value < 0.1 ? value : 0.0;
+  }
+  return std::make_shared<Tensor>(float64(), buffer,
+                                  std::vector<int64_t>{kNumRows, kNumCols});
+}
+
+template <typename SparseTensorType>
+static void ConvertFromTensor(benchmark::State& state) {  // NOLINT non-const reference
+  const bool use_threads = state.range(0) != 0;
+  auto tensor = MakeSparseMatrix();
+
+  for (auto _ : state) {
+    auto sparse_tensor = SparseTensorType::Make(*tensor, int64(), default_memory_pool(),
+                                                use_threads);
+    ABORT_NOT_OK(sparse_tensor.status());
+    benchmark::DoNotOptimize(sparse_tensor);
+  }
+  state.SetBytesProcessed(state.iterations() * tensor->size() * sizeof(double));
+}
+
+template <typename SparseTensorType>
+static void ConvertToTensor(benchmark::State& state) {  // NOLINT non-const reference
+  const bool use_threads = state.range(0) != 0;
+  auto tensor = MakeSparseMatrix();
+  std::shared_ptr<SparseTensorType> sparse_tensor;
+  ABORT_NOT_OK(SparseTensorType::Make(*tensor, int64()).Value(&sparse_tensor));
+
+  for (auto _ : state) {
+    std::shared_ptr<Tensor> out;
+    ABORT_NOT_OK(sparse_tensor->ToTensor(default_memory_pool(), use_threads, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * tensor->size() * sizeof(double));
+}
+
+static void SparseCOOTensorFromTensor(benchmark::State& state) {  // NOLINT
+  ConvertFromTensor<SparseCOOTensor>(state);
+}
+
+static void SparseCSRMatrixFromTensor(benchmark::State& state) {  // NOLINT
+  ConvertFromTensor<SparseCSRMatrix>(state);
+}
+
+static void SparseCOOTensorToTensor(benchmark::State& state) {  // NOLINT
+  ConvertToTensor<SparseCOOTensor>(state);
+}
+
+static void SparseCSRMatrixToTensor(benchmark::State& state) {  // NOLINT
+  ConvertToTensor<SparseCSRMatrix>(state);
+}
+
+static void SparseCSCMatrixToTensor(benchmark::State& state) {  // NOLINT
+  ConvertToTensor<SparseCSCMatrix>(state);
+}
+
+// The argument is use_threads
+BENCHMARK(SparseCOOTensorFromTensor)->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(SparseCSRMatrixFromTensor)->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(SparseCOOTensorToTensor)->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(SparseCSRMatrixToTensor)->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(SparseCSCMatrixToTensor)->Arg(0)->Arg(1)->UseRealTime();
+
+}  // namespace arrow
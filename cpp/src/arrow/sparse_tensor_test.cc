@@ -315,6 +315,40 @@ TEST_F(TestSparseCOOTensor, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+// A tensor large enough to be converted by several threads, with one cell in
+// three non-zero
+static std::shared_ptr<Tensor> MakeLargeTensor(const std::vector<int64_t>& shape) {
+  int64_t size = 1;
+  for (const auto dim : shape) {
+    size *= dim;
+  }
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(AllocateBuffer(size * sizeof(int64_t)).Value(&buffer));
+  auto values = reinterpret_cast<int64_t*>(buffer->mutable_data());
+  for (int64_t i = 0; i < size; ++i) {
+    values[i] = i % 3 == 0 ? i + 1 : 0;
+  }
+  return std::make_shared<Tensor>(int64(), buffer, shape);
+}
+
+TEST_F(TestSparseCOOTensor, CreationFromLargeTensorWithThreads) {
+  auto tensor = MakeLargeTensor({512, 16, 64});
+
+  std::shared_ptr<SparseCOOTensor> expected;
+  ASSERT_OK_AND_ASSIGN(expected, SparseCOOTensor::Make(*tensor, int32()));
+  std::shared_ptr<SparseCOOTensor> sparse_tensor;
+  ASSERT_OK_AND_ASSIGN(sparse_tensor,
+                       SparseCOOTensor::Make(*tensor, int32(), default_memory_pool(),
+                                             /*use_threads=*/true));
+  ASSERT_EQ(512 * 16 * 64 / 3 + 1, sparse_tensor->non_zero_length());
+  ASSERT_TRUE(sparse_tensor->Equals(*expected));
+
+  std::shared_ptr<Tensor> dense_tensor;
+  ASSERT_OK(sparse_tensor->ToTensor(default_memory_pool(), /*use_threads=*/true,
+                                    &dense_tensor));
+  ASSERT_TRUE(tensor->Equals(*dense_tensor));
+}
+
 template <typename ValueType>
 class TestSparseCOOTensorEquality : public TestSparseTensorBase<ValueType> {
  public:
@@ -742,6 +776,24 @@ TEST_F(TestSparseCSRMatrix, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+TEST_F(TestSparseCSRMatrix, CreationFromLargeTensorWithThreads) {
+  auto tensor = MakeLargeTensor({1024, 512});
+
+  std::shared_ptr<SparseCSRMatrix> expected;
+  ASSERT_OK_AND_ASSIGN(expected, SparseCSRMatrix::Make(*tensor, int32()));
+  std::shared_ptr<SparseCSRMatrix> sparse_tensor;
+  ASSERT_OK_AND_ASSIGN(sparse_tensor,
+                       SparseCSRMatrix::Make(*tensor, int32(), default_memory_pool(),
+                                             /*use_threads=*/true));
+  ASSERT_EQ(1024 * 512 / 3 + 1, sparse_tensor->non_zero_length());
+  ASSERT_TRUE(sparse_tensor->Equals(*expected));
+
+  std::shared_ptr<Tensor> dense_tensor;
+  ASSERT_OK(sparse_tensor->ToTensor(default_memory_pool(), /*use_threads=*/true,
+                                    &dense_tensor));
+  ASSERT_TRUE(tensor->Equals(*dense_tensor));
+}
+
 template <typename ValueType>
 class TestSparseCSRMatrixEquality : public TestSparseTensorBase<ValueType> {
  public:
@@ -1056,6 +1108,18 @@ TEST_F(TestSparseCSCMatrix, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+TEST_F(TestSparseCSCMatrix, TestToTensorWithThreads) {
+  auto tensor = MakeLargeTensor({512, 1024});
+
+  std::shared_ptr<SparseCSCMatrix> sparse_tensor;
+  ASSERT_OK_AND_ASSIGN(sparse_tensor, SparseCSCMatrix::Make(*tensor, int32()));
+
+  std::shared_ptr<Tensor> dense_tensor;
+  ASSERT_OK(sparse_tensor->ToTensor(default_memory_pool(), /*use_threads=*/true,
+                                    &dense_tensor));
+  ASSERT_TRUE(tensor->Equals(*dense_tensor));
+}
+
 template <typename ValueType>
 class TestSparseCSCMatrixEquality : public TestSparseTensorBase<ValueType> {
  public:
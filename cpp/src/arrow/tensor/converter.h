@@ -19,20 +19,41 @@
 
 #include "arrow/sparse_tensor.h"  // IWYU pragma: export
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace arrow {
 namespace internal {
 
+/// \brief Split the first axis of a tensor into ranges of rows to convert
+/// concurrently
+///
+/// Range i spans the rows [result[i], result[i + 1]). There is a single range
+/// unless use_threads is true and the tensor is large enough to be worth
+/// splitting.
+std::vector<int64_t> SplitTensorRows(const std::vector<int64_t>& shape,
+                                     bool use_threads);
+
+/// \brief Count the non-zero values, in a loop which the compiler vectorizes
+template <typename c_value_type>
+inline int64_t CountNonZero(const c_value_type* data, int64_t length) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    count += data[i] != 0;
+  }
+  return count;
+}
+
 Status MakeSparseCOOTensorFromTensor(const Tensor& tensor,
                                      const std::shared_ptr<DataType>& index_value_type,
-                                     MemoryPool* pool,
+                                     MemoryPool* pool, bool use_threads,
                                      std::shared_ptr<SparseIndex>* out_sparse_index,
                                      std::shared_ptr<Buffer>* out_data);
 
 Status MakeSparseCSRMatrixFromTensor(const Tensor& tensor,
                                      const std::shared_ptr<DataType>& index_value_type,
-                                     MemoryPool* pool,
+                                     MemoryPool* pool, bool use_threads,
                                      std::shared_ptr<SparseIndex>* out_sparse_index,
                                      std::shared_ptr<Buffer>* out_data);
 
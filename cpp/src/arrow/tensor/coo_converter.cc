@@ -19,12 +19,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -59,8 +61,11 @@ class SparseCOOTensorConverter {
 
   SparseCOOTensorConverter(const NumericTensorType& tensor,
                            const std::shared_ptr<DataType>& index_value_type,
-                           MemoryPool* pool)
-      : tensor_(tensor), index_value_type_(index_value_type), pool_(pool) {}
+                           MemoryPool* pool, bool use_threads)
+      : tensor_(tensor),
+        index_value_type_(index_value_type),
+        pool_(pool),
+        use_threads_(use_threads) {}
 
   template <typename IndexValueType>
   Status Convert() {
@@ -68,6 +73,10 @@ class SparseCOOTensorConverter {
     const int64_t indices_elsize = sizeof(c_index_value_type);
 
     const int64_t ndim = tensor_.ndim();
+    if (ndim > 1 && tensor_.is_row_major()) {
+      return ConvertRowMajor<IndexValueType>();
+    }
+
     int64_t nonzero_count = -1;
     RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
 
@@ -107,13 +116,91 @@ class SparseCOOTensorConverter {
     }
 
     // make results
+    MakeResult<IndexValueType>(nonzero_count, std::move(indices_buffer),
+                               std::move(values_buffer));
+    return Status::OK();
+  }
+
+  // Convert a range of rows at a time, concurrently if use_threads. The
+  // non-zero values of each range are counted first to find where the range
+  // is written.
+  template <typename IndexValueType>
+  Status ConvertRowMajor() {
+    using c_index_value_type = typename IndexValueType::c_type;
+    const int64_t indices_elsize = sizeof(c_index_value_type);
+
+    const int64_t ndim = tensor_.ndim();
+    const std::vector<int64_t>& shape = tensor_.shape();
+    const value_type* tensor_data =
+        reinterpret_cast<const value_type*>(tensor_.raw_data());
+    const int64_t row_size = shape[0] == 0 ? 0 : tensor_.size() / shape[0];
+    const int64_t line_size = shape[ndim - 1];
+
+    const std::vector<int64_t> rows = SplitTensorRows(shape, use_threads_);
+    const int num_ranges = static_cast<int>(rows.size()) - 1;
+
+    // offsets[i] is the number of non-zero values before range i
+    std::vector<int64_t> offsets(num_ranges + 1, 0);
+    RETURN_NOT_OK(OptionalParallelFor(use_threads_, num_ranges, [&](int i) {
+      offsets[i + 1] = CountNonZero(tensor_data + rows[i] * row_size,
+                                    (rows[i + 1] - rows[i]) * row_size);
+      return Status::OK();
+    }));
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const int64_t nonzero_count = offsets[num_ranges];
+
+    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                          AllocateBuffer(indices_elsize * ndim * nonzero_count, pool_));
+    c_index_value_type* indices =
+        reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
+
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                          AllocateBuffer(sizeof(value_type) * nonzero_count, pool_));
+    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
+
+    RETURN_NOT_OK(OptionalParallelFor(use_threads_, num_ranges, [&](int i) {
+      value_type* out_values = values + offsets[i];
+      c_index_value_type* out_indices = indices + offsets[i] * ndim;
+
+      // The coordinates of the current line along all but the last axis
+      std::vector<int64_t> coord(ndim - 1, 0);
+      coord[0] = rows[i];
+      const value_type* line = tensor_data + rows[i] * row_size;
+      const value_type* end = tensor_data + rows[i + 1] * row_size;
+      for (; line < end; line += line_size) {
+        for (int64_t j = 0; j < line_size; ++j) {
+          if (line[j] != 0) {
+            *out_values++ = line[j];
+            // Write indices in row-major order.
+            for (int64_t d = 0; d < ndim - 1; ++d) {
+              *out_indices++ = static_cast<c_index_value_type>(coord[d]);
+            }
+            *out_indices++ = static_cast<c_index_value_type>(j);
+          }
+        }
+        for (int64_t d = ndim - 2; d >= 0; --d) {
+          if (++coord[d] < shape[d] || d == 0) break;
+          coord[d] = 0;
+        }
+      }
+      return Status::OK();
+    }));
+
+    MakeResult<IndexValueType>(nonzero_count, std::move(indices_buffer),
+                               std::move(values_buffer));
+    return Status::OK();
+  }
+
+  template <typename IndexValueType>
+  void MakeResult(int64_t nonzero_count, std::shared_ptr<Buffer> indices_buffer,
+                  std::shared_ptr<Buffer> values_buffer) {
+    const int64_t indices_elsize = sizeof(typename IndexValueType::c_type);
+    const int64_t ndim = tensor_.ndim();
     const std::vector<int64_t> indices_shape = {nonzero_count, ndim};
     const std::vector<int64_t> indices_strides = {indices_elsize * ndim, indices_elsize};
     sparse_index = std::make_shared<SparseCOOIndex>(std::make_shared<Tensor>(
         index_value_type_, std::move(indices_buffer), indices_shape, indices_strides));
     data = std::move(values_buffer);
-
-    return Status::OK();
   }
 
 #define CALL_TYPE_SPECIFIC_CONVERT(TYPE_CLASS) \
@@ -139,16 +226,18 @@ class SparseCOOTensorConverter {
   const NumericTensorType& tensor_;
   const std::shared_ptr<DataType>& index_value_type_;
   MemoryPool* pool_;
+  bool use_threads_;
 };
 
 template <typename TYPE>
 Status MakeSparseCOOTensorFromTensor(const Tensor& tensor,
                                      const std::shared_ptr<DataType>& index_value_type,
-                                     MemoryPool* pool,
+                                     MemoryPool* pool, bool use_threads,
                                      std::shared_ptr<SparseIndex>* out_sparse_index,
                                      std::shared_ptr<Buffer>* out_data) {
   NumericTensor<TYPE> numeric_tensor(tensor.data(), tensor.shape(), tensor.strides());
-  SparseCOOTensorConverter<TYPE> converter(numeric_tensor, index_value_type, pool);
+  SparseCOOTensorConverter<TYPE> converter(numeric_tensor, index_value_type, pool,
+                                           use_threads);
   RETURN_NOT_OK(converter.Convert());
 
   *out_sparse_index = checked_pointer_cast<SparseIndex>(converter.sparse_index);
@@ -161,11 +250,11 @@ Status MakeSparseCOOTensorFromTensor(const Tensor& tensor,
 #define MAKE_SPARSE_TENSOR_FROM_TENSOR(TYPE_CLASS)          \
   case TYPE_CLASS##Type::type_id:                           \
     return MakeSparseCOOTensorFromTensor<TYPE_CLASS##Type>( \
-        tensor, index_value_type, pool, out_sparse_index, out_data);
+        tensor, index_value_type, pool, use_threads, out_sparse_index, out_data);
 
 Status MakeSparseCOOTensorFromTensor(const Tensor& tensor,
                                      const std::shared_ptr<DataType>& index_value_type,
-                                     MemoryPool* pool,
+                                     MemoryPool* pool, bool use_threads,
                                      std::shared_ptr<SparseIndex>* out_sparse_index,
                                      std::shared_ptr<Buffer>* out_data) {
   switch (tensor.type()->id()) {
@@ -26,6 +26,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -46,8 +47,11 @@ class SparseCSRMatrixConverter {
 
   SparseCSRMatrixConverter(const NumericTensorType& tensor,
                            const std::shared_ptr<DataType>& index_value_type,
-                           MemoryPool* pool)
-      : tensor_(tensor), index_value_type_(index_value_type), pool_(pool) {}
+                           MemoryPool* pool, bool use_threads)
+      : tensor_(tensor),
+        index_value_type_(index_value_type),
+        pool_(pool),
+        use_threads_(use_threads) {}
 
   template <typename IndexValueType>
   Status Convert() {
@@ -62,6 +66,10 @@ class SparseCSRMatrixConverter {
       // LCOV_EXCL_STOP
     }
 
+    if (ndim == 2 && tensor_.is_row_major()) {
+      return ConvertRowMajor<IndexValueType>();
+    }
+
     const int64_t nr = tensor_.shape()[0];
     const int64_t nc = tensor_.shape()[1];
     int64_t nonzero_count = -1;
@@ -101,18 +109,87 @@ class SparseCSRMatrixConverter {
       }
     }
 
-    std::vector<int64_t> indptr_shape({nr + 1});
-    std::shared_ptr<Tensor> indptr_tensor =
-        std::make_shared<Tensor>(index_value_type_, indptr_buffer, indptr_shape);
+    MakeResult(nonzero_count, std::move(indptr_buffer), std::move(indices_buffer),
+               std::move(values_buffer));
+    return Status::OK();
+  }
+
+  // Convert a range of rows at a time, concurrently if use_threads. The
+  // non-zero values of each row are counted first to find where the row is
+  // written.
+  template <typename IndexValueType>
+  Status ConvertRowMajor() {
+    using c_index_value_type = typename IndexValueType::c_type;
+    const int64_t indices_elsize = sizeof(c_index_value_type);
+
+    const int64_t nr = tensor_.shape()[0];
+    const int64_t nc = tensor_.shape()[1];
+    const value_type* tensor_data =
+        reinterpret_cast<const value_type*>(tensor_.raw_data());
+
+    const std::vector<int64_t> rows = SplitTensorRows(tensor_.shape(), use_threads_);
+    const int num_ranges = static_cast<int>(rows.size()) - 1;
+
+    ARROW_ASSIGN_OR_RAISE(auto indptr_buffer,
+                          AllocateBuffer(indices_elsize * (nr + 1), pool_));
+    auto* indptr = reinterpret_cast<c_index_value_type*>(indptr_buffer->mutable_data());
+
+    // Count the non-zero values of each row, then sum them up into indptr
+    indptr[0] = 0;
+    RETURN_NOT_OK(OptionalParallelFor(use_threads_, num_ranges, [&](int i) {
+      for (int64_t row = rows[i]; row < rows[i + 1]; ++row) {
+        indptr[row + 1] =
+            static_cast<c_index_value_type>(CountNonZero(tensor_data + row * nc, nc));
+      }
+      return Status::OK();
+    }));
+    for (int64_t row = 0; row < nr; ++row) {
+      indptr[row + 1] += indptr[row];
+    }
+    const int64_t nonzero_count = static_cast<int64_t>(indptr[nr]);
+
+    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                          AllocateBuffer(indices_elsize * nonzero_count, pool_));
+    auto* indices = reinterpret_cast<c_index_value_type*>(indices_buffer->mutable_data());
+
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                          AllocateBuffer(sizeof(value_type) * nonzero_count, pool_));
+    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
+
+    RETURN_NOT_OK(OptionalParallelFor(use_threads_, num_ranges, [&](int i) {
+      const int64_t offset = static_cast<int64_t>(indptr[rows[i]]);
+      value_type* out_values = values + offset;
+      c_index_value_type* out_indices = indices + offset;
+      for (int64_t row = rows[i]; row < rows[i + 1]; ++row) {
+        const value_type* row_data = tensor_data + row * nc;
+        for (int64_t j = 0; j < nc; ++j) {
+          if (row_data[j] != 0) {
+            *out_values++ = row_data[j];
+            *out_indices++ = static_cast<c_index_value_type>(j);
+          }
+        }
+      }
+      return Status::OK();
+    }));
+
+    MakeResult(nonzero_count, std::move(indptr_buffer), std::move(indices_buffer),
+               std::move(values_buffer));
+    return Status::OK();
+  }
+
+  void MakeResult(int64_t nonzero_count, std::shared_ptr<Buffer> indptr_buffer,
+                  std::shared_ptr<Buffer> indices_buffer,
+                  std::shared_ptr<Buffer> values_buffer) {
+    std::vector<int64_t> indptr_shape({tensor_.shape()[0] + 1});
+    std::shared_ptr<Tensor> indptr_tensor = std::make_shared<Tensor>(
+        index_value_type_, std::move(indptr_buffer), indptr_shape);
 
     std::vector<int64_t> indices_shape({nonzero_count});
-    std::shared_ptr<Tensor> indices_tensor =
-        std::make_shared<Tensor>(index_value_type_, indices_buffer, indices_shape);
+    std::shared_ptr<Tensor> indices_tensor = std::make_shared<Tensor>(
+        index_value_type_, std::move(indices_buffer), indices_shape);
 
     sparse_index = std::make_shared<SparseCSRIndex>(indptr_tensor, indices_tensor);
     data = std::move(values_buffer);
-
-    return Status::OK();
   }
 
 #define CALL_TYPE_SPECIFIC_CONVERT(TYPE_CLASS) \
@@ -138,6 +215,7 @@ class SparseCSRMatrixConverter {
   const NumericTensorType& tensor_;
   const std::shared_ptr<DataType>& index_value_type_;
   MemoryPool* pool_;
+  bool use_threads_;
 
   template <typename c_value_type>
   inline Status CheckMaximumValue(const c_value_type type_max) const {
@@ -157,11 +235,12 @@ class SparseCSRMatrixConverter {
 template <typename TYPE>
 Status MakeSparseCSRMatrixFromTensor(const Tensor& tensor,
                                      const std::shared_ptr<DataType>& index_value_type,
-                                     MemoryPool* pool,
+                                     MemoryPool* pool, bool use_threads,
                                      std::shared_ptr<SparseIndex>* out_sparse_index,
                                      std::shared_ptr<Buffer>* out_data) {
   NumericTensor<TYPE> numeric_tensor(tensor.data(), tensor.shape(), tensor.strides());
-  SparseCSRMatrixConverter<TYPE> converter(numeric_tensor, index_value_type, pool);
+  SparseCSRMatrixConverter<TYPE> converter(numeric_tensor, index_value_type, pool,
+                                           use_threads);
   RETURN_NOT_OK(converter.Convert());
 
   *out_sparse_index = checked_pointer_cast<SparseIndex>(converter.sparse_index);
@@ -174,11 +253,11 @@ Status MakeSparseCSRMatrixFromTensor(const Tensor& tensor,
 #define MAKE_SPARSE_CSR_MATRIX_FROM_TENSOR(TYPE_CLASS)      \
   case TYPE_CLASS##Type::type_id:                           \
     return MakeSparseCSRMatrixFromTensor<TYPE_CLASS##Type>( \
-        tensor, index_value_type, pool, out_sparse_index, out_data);
+        tensor, index_value_type, pool, use_threads, out_sparse_index, out_data);
 
 Status MakeSparseCSRMatrixFromTensor(const Tensor& tensor,
                                      const std::shared_ptr<DataType>& index_value_type,
-                                     MemoryPool* pool,
+                                     MemoryPool* pool, bool use_threads,
                                      std::shared_ptr<SparseIndex>* out_sparse_index,
                                      std::shared_ptr<Buffer>* out_data) {
   switch (tensor.type()->id()) {
@@ -264,34 +264,54 @@ void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* ri
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
 
-  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset);
+  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset % 8);
   left += left_offset / 8;
   right += right_offset / 8;
   out += out_offset / 8;
   for (int64_t i = 0; i < nbytes; ++i) {
-    out[i] = op(left[i], right[i]);
+    out[i] = static_cast<uint8_t>(op(left[i], right[i]));
   }
 }
 
-template <typename Op>
+// Load the 64 bits of a bitmap starting at an arbitrary bit offset
+inline uint64_t LoadBitmapWord(const uint8_t* bitmap, int64_t bit_offset) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  uint64_t word;
+  std::memcpy(&word, bytes, sizeof(word));
+  word = BitUtil::FromLittleEndian(word);
+  if (shift != 0) {
+    // The last bits are in the 9th byte
+    word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+  }
+  return word;
+}
+
+template <typename BitOp, typename LogicalOp>
 void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                        int64_t right_offset, uint8_t* out, int64_t out_offset,
                        int64_t length) {
-  Op op;
-  auto left_reader = internal::BitmapReader(left, left_offset, length);
-  auto right_reader = internal::BitmapReader(right, right_offset, length);
-  auto writer = internal::BitmapWriter(out, out_offset, length);
-  for (int64_t i = 0; i < length; ++i) {
-    if (op(left_reader.IsSet(), right_reader.IsSet())) {
-      writer.Set();
-    } else {
-      writer.Clear();
+  BitOp bit_op;
+  LogicalOp logical_op;
+  int64_t i = 0;
+  auto bitwise_op = [&](int64_t end) {
+    for (; i < end; ++i) {
+      BitUtil::SetBitTo(out, out_offset + i,
+                        logical_op(BitUtil::GetBit(left, left_offset + i),
+                                   BitUtil::GetBit(right, right_offset + i)));
     }
-    left_reader.Next();
-    right_reader.Next();
-    writer.Next();
+  };
+
+  // Bit by bit up to a byte boundary of the output, then 64 bits at a time,
+  // shifting the inputs into place
+  bitwise_op(std::min(length, BitUtil::RoundUpToMultipleOf8(out_offset) - out_offset));
+  for (; length - i >= 64; i += 64) {
+    const uint64_t word = bit_op(LoadBitmapWord(left, left_offset + i),
+                                 LoadBitmapWord(right, right_offset + i));
+    const uint64_t out_word = BitUtil::ToLittleEndian(word);
+    std::memcpy(out + (out_offset + i) / 8, &out_word, sizeof(out_word));
   }
-  writer.Finish();
+  bitwise_op(length);
 }
 
 template <typename BitOp, typename LogicalOp>
@@ -303,8 +323,8 @@ void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                            length);
   } else {
     // Unaligned
-    UnalignedBitmapOp<LogicalOp>(left, left_offset, right, right_offset, dest, out_offset,
-                                 length);
+    UnalignedBitmapOp<BitOp, LogicalOp>(left, left_offset, right, right_offset, dest,
+                                        out_offset, length);
   }
 }
 
@@ -357,13 +377,13 @@ Result<std::shared_ptr<Buffer>> BitmapAnd(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
+  return BitmapOp<std::bit_and<uint64_t>, std::logical_and<bool>>(
       pool, left, left_offset, right, right_offset, length, out_offset);
 }
 
 void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
+  BitmapOp<std::bit_and<uint64_t>, std::logical_and<bool>>(
       left, left_offset, right, right_offset, length, out_offset, out);
 }
 
@@ -371,13 +391,13 @@ Result<std::shared_ptr<Buffer>> BitmapOr(MemoryPool* pool, const uint8_t* left,
                                          int64_t left_offset, const uint8_t* right,
                                          int64_t right_offset, int64_t length,
                                          int64_t out_offset) {
-  return BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
+  return BitmapOp<std::bit_or<uint64_t>, std::logical_or<bool>>(
       pool, left, left_offset, right, right_offset, length, out_offset);
 }
 
 void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
+  BitmapOp<std::bit_or<uint64_t>, std::logical_or<bool>>(
       left, left_offset, right, right_offset, length, out_offset, out);
 }
 
@@ -385,13 +405,13 @@ Result<std::shared_ptr<Buffer>> BitmapXor(MemoryPool* pool, const uint8_t* left,
                                           int64_t left_offset, const uint8_t* right,
                                           int64_t right_offset, int64_t length,
                                           int64_t out_offset) {
-  return BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
+  return BitmapOp<std::bit_xor<uint64_t>, std::bit_xor<bool>>(
       pool, left, left_offset, right, right_offset, length, out_offset);
 }
 
 void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
+  BitmapOp<std::bit_xor<uint64_t>, std::bit_xor<bool>>(
       left, left_offset, right, right_offset, length, out_offset, out);
 }
 
@@ -661,6 +661,28 @@ TEST_F(BitmapOp, Xor) {
   TestUnaligned(op, left, right, result);
 }
 
+TEST_F(BitmapOp, RandomLong) {
+  // Long enough for most bits to be processed by 64-bit words
+  const int64_t length = 500;
+  std::vector<uint8_t> left_bytes(length), right_bytes(length);
+  random_bytes(length, 0, left_bytes.data());
+  random_bytes(length, 1, right_bytes.data());
+
+  std::vector<int> left, right, and_result, or_result, xor_result;
+  for (int64_t i = 0; i < length; ++i) {
+    left.push_back(left_bytes[i] & 1);
+    right.push_back(right_bytes[i] & 1);
+    and_result.push_back(left[i] & right[i]);
+    or_result.push_back(left[i] | right[i]);
+    xor_result.push_back(left[i] ^ right[i]);
+  }
+
+  TestAligned(BitmapAndOp(), left, right, and_result);
+  TestUnaligned(BitmapAndOp(), left, right, and_result);
+  TestUnaligned(BitmapOrOp(), left, right, or_result);
+  TestUnaligned(BitmapXorOp(), left, right, xor_result);
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -123,6 +123,30 @@ def print_unpack_bit32_func():
     print("}")
 
 
+def print_unpack32_func():
+    print("inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, "
+          "int num_bits) {")
+    print("  batch_size = batch_size / 32 * 32;")
+    print("  int num_loops = batch_size / 32;")
+    print("")
+    print("  switch (num_bits) {")
+    print("    case 0:")
+    print("      for (int i = 0; i < num_loops; ++i) "
+          "in = nullunpacker32(in, out + i * 32);")
+    print("      break;")
+    for i in range(1, 33):
+        print(f"    case {i}:")
+        print(f"      for (int i = 0; i < num_loops; ++i) "
+              f"in = unpack{i}_32(in, out + i * 32);")
+        print("      break;")
+    print("    default:")
+    print("      break;")
+    print("  }")
+    print("")
+    print("  return batch_size;")
+    print("}")
+
+
 def print_copyright():
     print(
         """// Licensed to the Apache Software Foundation (ASF) under one
@@ -156,8 +180,12 @@ def main():
     print("")
     print("#include <immintrin.h>")
     print("")
+    print("#include <cstdint>")
+    print("#include <cstring>")
+    print("")
     print("namespace arrow {")
     print("namespace internal {")
+    print("namespace avx512 {")
     print("")
     print_unpack_bit0_func()
     print("")
@@ -166,6 +194,9 @@ def main():
         print("")
     print_unpack_bit32_func()
     print("")
+    print_unpack32_func()
+    print("")
+    print("}  // namespace avx512")
     print("}  // namespace internal")
     print("}  // namespace arrow")
 
@@ -46,6 +46,8 @@
 #include <mutex>
 #include <string>
 
+#include "arrow/result.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
 
@@ -123,8 +125,11 @@ static struct {
   int64_t flag;
 } flag_mappings[] = {
 #if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
-    {"ssse3", CpuInfo::SSSE3},   {"sse4_1", CpuInfo::SSE4_1},
-    {"sse4_2", CpuInfo::SSE4_2}, {"popcnt", CpuInfo::POPCNT},
+    {"ssse3", CpuInfo::SSSE3},       {"sse4_1", CpuInfo::SSE4_1},
+    {"sse4_2", CpuInfo::SSE4_2},     {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},         {"avx512f", CpuInfo::AVX512F},
+    {"avx512cd", CpuInfo::AVX512CD}, {"avx512vl", CpuInfo::AVX512VL},
+    {"avx512dq", CpuInfo::AVX512DQ}, {"avx512bw", CpuInfo::AVX512BW},
 #endif
 #if defined(__aarch64__)
     {"asimd", CpuInfo::ASIMD},
@@ -203,9 +208,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
     return false;
   }
   const int register_ECX_id = 1;
+  const int extended_features_id = 7;
   int highest_valid_id = 0;
   int highest_extended_valid_id = 0;
   std::bitset<32> features_ECX;
+  std::bitset<32> features_EBX;
   std::array<int, 4> cpu_info;
 
   // Get highest valid id
@@ -217,6 +224,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   __cpuidex(cpu_info.data(), register_ECX_id, 0);
   features_ECX = cpu_info[2];
 
+  if (highest_valid_id >= extended_features_id) {
+    __cpuidex(cpu_info.data(), extended_features_id, 0);
+    features_EBX = cpu_info[1];
+  }
+
   // Get highest extended id
   __cpuid(cpu_info.data(), 0x80000000);
   highest_extended_valid_id = cpu_info[0];
@@ -235,10 +247,38 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+  if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+  if (features_EBX[16]) *hardware_flags |= CpuInfo::AVX512F;
+  if (features_EBX[17]) *hardware_flags |= CpuInfo::AVX512DQ;
+  if (features_EBX[28]) *hardware_flags |= CpuInfo::AVX512CD;
+  if (features_EBX[30]) *hardware_flags |= CpuInfo::AVX512BW;
+  if (features_EBX[31]) *hardware_flags |= CpuInfo::AVX512VL;
   return true;
 }
 #endif
 
+// The flags of the instruction sets above ARROW_USER_SIMD_LEVEL
+static int64_t GetUserDisabledFlags() {
+  auto maybe_level = GetEnvVar("ARROW_USER_SIMD_LEVEL");
+  if (!maybe_level.ok()) {
+    return 0;
+  }
+  const std::string level = *std::move(maybe_level);
+  if (level.empty()) {
+    return 0;
+  } else if (level == "NONE") {
+    return CpuInfo::SSE4_2 | CpuInfo::AVX2 | CpuInfo::AVX512;
+  } else if (level == "SSE4_2") {
+    return CpuInfo::AVX2 | CpuInfo::AVX512;
+  } else if (level == "AVX2") {
+    return CpuInfo::AVX512;
+  } else if (level != "AVX512" && level != "MAX") {
+    ARROW_LOG(WARNING) << "Ignoring invalid ARROW_USER_SIMD_LEVEL '" << level
+                       << "', expected NONE, SSE4_2, AVX2, AVX512 or MAX";
+  }
+  return 0;
+}
+
 CpuInfo::CpuInfo() : hardware_flags_(0), num_cores_(1), model_name_("unknown") {}
 
 std::unique_ptr<CpuInfo> g_cpu_info;
@@ -327,6 +367,7 @@ void CpuInfo::Init() {
     cycles_per_ms_ = 1000000;
   }
   original_hardware_flags_ = hardware_flags_;
+  hardware_flags_ &= ~GetUserDisabledFlags();
 
   if (num_cores > 0) {
     num_cores_ = num_cores;
@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Selection at runtime of the implementation of a function built for the best
+// instruction set supported by the CPU.
+//
+// The variants are built from translation units compiled with
+// ARROW_AVX2_FLAG or ARROW_AVX512_FLAG, which are part of the library when
+// ARROW_HAVE_RUNTIME_AVX2 or ARROW_HAVE_RUNTIME_AVX512 is defined (see
+// ARROW_RUNTIME_SIMD_LEVEL). Such translation units should only include
+// headers whose functions have internal linkage, lest the linker picks their
+// AVX variants for the whole library.
+
+#pragma once
+
+#include <initializer_list>
+
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+/// The instruction sets a function may be built for, in increasing order
+enum class DispatchLevel : int {
+  /// The instruction set the library is built for (see ARROW_SIMD_LEVEL)
+  NONE = 0,
+  SSE4_2,
+  AVX2,
+  /// The AVX512 subsets targeted by ARROW_AVX512_FLAG
+  AVX512,
+};
+
+/// \brief Return whether the CPU supports the instruction set of a dispatch level
+///
+/// The levels above the ARROW_USER_SIMD_LEVEL environment variable, if it is
+/// set, are unsupported.
+inline bool IsDispatchLevelSupported(DispatchLevel level) {
+  auto cpu_info = CpuInfo::GetInstance();
+  switch (level) {
+    case DispatchLevel::NONE:
+      return true;
+    case DispatchLevel::SSE4_2:
+      return cpu_info->IsSupported(CpuInfo::SSE4_2);
+    case DispatchLevel::AVX2:
+      return cpu_info->IsSupported(CpuInfo::AVX2);
+    case DispatchLevel::AVX512:
+      return cpu_info->IsSupported(CpuInfo::AVX512);
+  }
+  return false;
+}
+
+/// \brief The implementation, among several, for the highest dispatch level
+/// supported by the CPU
+///
+/// Implementation is usually a function pointer, or a struct of function
+/// pointers. The selection happens on construction, so DynamicDispatch is
+/// meant to be a (function-local) static:
+///
+/// \code
+/// int Unpack(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+///   static DynamicDispatch<UnpackFunc> dispatch{
+///       {DispatchLevel::NONE, UnpackDefault},
+/// #ifdef ARROW_HAVE_RUNTIME_AVX512
+///       {DispatchLevel::AVX512, UnpackAvx512},
+/// #endif
+///   };
+///   return dispatch.func(in, out, batch_size, num_bits);
+/// }
+/// \endcode
+template <typename Implementation>
+class DynamicDispatch {
+ public:
+  struct Candidate {
+    DispatchLevel level;
+    Implementation implementation;
+  };
+
+  /// The candidates must include one for DispatchLevel::NONE
+  DynamicDispatch(std::initializer_list<Candidate> candidates) {
+    bool found = false;
+    for (const auto& candidate : candidates) {
+      if ((!found || candidate.level > level) &&
+          IsDispatchLevelSupported(candidate.level)) {
+        found = true;
+        level = candidate.level;
+        func = candidate.implementation;
+      }
+    }
+    DCHECK(found) << "No implementation for the baseline dispatch level";
+  }
+
+  /// The selected implementation
+  Implementation func{};
+  /// The dispatch level of the selected implementation
+  DispatchLevel level = DispatchLevel::NONE;
+};
+
+}  // namespace internal
+}  // namespace arrow
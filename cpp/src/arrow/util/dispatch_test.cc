@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+using IntFunc = int (*)();
+
+static int ReturnNone() { return 0; }
+static int ReturnAvx2() { return 2; }
+static int ReturnAvx512() { return 3; }
+
+static DynamicDispatch<IntFunc> MakeDispatch() {
+  return DynamicDispatch<IntFunc>{{DispatchLevel::NONE, ReturnNone},
+                                  {DispatchLevel::AVX512, ReturnAvx512},
+                                  {DispatchLevel::AVX2, ReturnAvx2}};
+}
+
+// Disable CPU features for the lifetime of the object
+class ScopedDisableFeatures {
+ public:
+  explicit ScopedDisableFeatures(int64_t flags)
+      : disabled_(CpuInfo::GetInstance()->hardware_flags() & flags) {
+    if (disabled_ != 0) {
+      CpuInfo::GetInstance()->EnableFeature(disabled_, false);
+    }
+  }
+
+  ~ScopedDisableFeatures() {
+    if (disabled_ != 0) {
+      CpuInfo::GetInstance()->EnableFeature(disabled_, true);
+    }
+  }
+
+ private:
+  int64_t disabled_;
+};
+
+TEST(DynamicDispatch, HighestSupportedLevel) {
+  auto dispatch = MakeDispatch();
+  if (IsDispatchLevelSupported(DispatchLevel::AVX512)) {
+    ASSERT_EQ(dispatch.level, DispatchLevel::AVX512);
+    ASSERT_EQ(dispatch.func(), 3);
+  } else if (IsDispatchLevelSupported(DispatchLevel::AVX2)) {
+    ASSERT_EQ(dispatch.level, DispatchLevel::AVX2);
+    ASSERT_EQ(dispatch.func(), 2);
+  } else {
+    ASSERT_EQ(dispatch.level, DispatchLevel::NONE);
+    ASSERT_EQ(dispatch.func(), 0);
+  }
+}
+
+TEST(DynamicDispatch, DisabledFeatures) {
+  {
+    ScopedDisableFeatures disable(CpuInfo::AVX2 | CpuInfo::AVX512);
+    ASSERT_FALSE(IsDispatchLevelSupported(DispatchLevel::AVX2));
+    ASSERT_FALSE(IsDispatchLevelSupported(DispatchLevel::AVX512));
+    auto dispatch = MakeDispatch();
+    ASSERT_EQ(dispatch.level, DispatchLevel::NONE);
+    ASSERT_EQ(dispatch.func(), 0);
+  }
+  {
+    // Disabling any of the AVX512 subsets disables the AVX512 level
+    ScopedDisableFeatures disable(CpuInfo::AVX512BW);
+    ASSERT_FALSE(IsDispatchLevelSupported(DispatchLevel::AVX512));
+    auto dispatch = MakeDispatch();
+    ASSERT_NE(dispatch.level, DispatchLevel::AVX512);
+  }
+}
+
+TEST(DynamicDispatch, MissingLevels) {
+  // Levels without a candidate fall back to the highest one below them
+  DynamicDispatch<IntFunc> dispatch{{DispatchLevel::NONE, ReturnNone}};
+  ASSERT_EQ(dispatch.level, DispatchLevel::NONE);
+  ASSERT_EQ(dispatch.func(), 0);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -42,6 +42,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
 
 #define XXH_INLINE_ALL
 #define XXH_PRIVATE_API
@@ -64,6 +65,11 @@ typedef uint64_t hash_t;
 template <uint64_t AlgNum>
 inline hash_t ComputeStringHash(const void* data, int64_t length);
 
+/// \brief Hash data longer than XXH3_MIDSIZE_MAX bytes with XXH3 and the given
+/// secret, using the best vector instruction set the CPU supports
+ARROW_EXPORT hash_t ComputeLongStringHash(const void* data, int64_t length,
+                                          const void* secret);
+
 template <typename Scalar, uint64_t AlgNum>
 struct ScalarHelperBase {
   static bool CompareScalars(Scalar u, Scalar v) { return u == v; }
@@ -186,6 +192,10 @@ hash_t ComputeStringHash(const void* data, int64_t length) {
 
   static_assert(AlgNum < 2, "AlgNum too large");
   static constexpr auto secret = kXxh3Secrets + AlgNum;
+  if (length > XXH3_MIDSIZE_MAX) {
+    // Only the long inputs are hashed with vector instructions
+    return ComputeLongStringHash(data, length, secret);
+  }
   return XXH3_64bits_withSecret(data, static_cast<size_t>(length), secret,
                                 XXH3_SECRET_SIZE_MIN);
 }
@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/numa.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include "arrow/util/macros.h"
+
+#ifdef ARROW_WITH_NUMA
+#include <numa.h>
+#include <numaif.h>
+#include <sched.h>
+#endif
+
+namespace arrow {
+namespace internal {
+
+#ifdef ARROW_WITH_NUMA
+
+namespace {
+
+Status CheckNode(int node) {
+  if (node < 0 || node >= GetNumaNodeCount()) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+bool IsNumaAvailable() {
+  static const bool available = numa_available() >= 0;
+  return available;
+}
+
+int GetNumaNodeCount() {
+  if (!IsNumaAvailable()) {
+    return 1;
+  }
+  static const int count = numa_num_configured_nodes();
+  return count > 0 ? count : 1;
+}
+
+int GetCurrentNumaNode() {
+  if (!IsNumaAvailable()) {
+    return 0;
+  }
+  int cpu = sched_getcpu();
+  if (cpu < 0) {
+    return 0;
+  }
+  int node = numa_node_of_cpu(cpu);
+  return node < 0 ? 0 : node;
+}
+
+Result<std::vector<int>> GetNumaNodeCpus(int node) {
+  RETURN_NOT_OK(CheckNode(node));
+  std::vector<int> cpus;
+  if (!IsNumaAvailable()) {
+    return cpus;
+  }
+  struct bitmask* cpumask = numa_allocate_cpumask();
+  int err = numa_node_to_cpus(node, cpumask);
+  if (err >= 0) {
+    for (unsigned int i = 0; i < cpumask->size; ++i) {
+      if (numa_bitmask_isbitset(cpumask, i)) {
+        cpus.push_back(static_cast<int>(i));
+      }
+    }
+  }
+  numa_free_cpumask(cpumask);
+  if (err < 0) {
+    return Status::IOError("Failed to get CPUs of NUMA node ", node, ": ",
+                           std::strerror(errno));
+  }
+  return cpus;
+}
+
+Status BindCurrentThreadToNumaNode(int node) {
+  RETURN_NOT_OK(CheckNode(node));
+  if (!IsNumaAvailable()) {
+    return Status::OK();
+  }
+  if (numa_run_on_node(node) != 0) {
+    return Status::IOError("Failed to bind thread to NUMA node ", node, ": ",
+                           std::strerror(errno));
+  }
+  numa_set_preferred(node);
+  return Status::OK();
+}
+
+Result<int> GetNumaNodeOfAddress(const void* address) {
+  if (!IsNumaAvailable()) {
+    return 0;
+  }
+  int node = -1;
+  if (get_mempolicy(&node, nullptr, 0, const_cast<void*>(address),
+                    MPOL_F_NODE | MPOL_F_ADDR) != 0) {
+    return Status::IOError("Failed to get NUMA node of address: ", std::strerror(errno));
+  }
+  return node;
+}
+
+#else  // !ARROW_WITH_NUMA
+
+bool IsNumaAvailable() { return false; }
+
+int GetNumaNodeCount() { return 1; }
+
+int GetCurrentNumaNode() { return 0; }
+
+Result<std::vector<int>> GetNumaNodeCpus(int node) {
+  if (node != 0) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  return std::vector<int>{};
+}
+
+Status BindCurrentThreadToNumaNode(int node) {
+  if (node != 0) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  return Status::OK();
+}
+
+Result<int> GetNumaNodeOfAddress(const void* address) {
+  ARROW_UNUSED(address);
+  return 0;
+}
+
+#endif  // ARROW_WITH_NUMA
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+// Thin wrappers around libnuma.  When Arrow is built without ARROW_NUMA, or
+// when the kernel doesn't expose a NUMA topology, the machine is presented
+// as a single node numbered 0 and the placement functions are no-ops.
+
+/// \brief Whether NUMA support is compiled in and usable on this machine
+ARROW_EXPORT bool IsNumaAvailable();
+
+/// \brief Return the number of configured NUMA nodes (at least 1)
+ARROW_EXPORT int GetNumaNodeCount();
+
+/// \brief Return the node the calling thread is currently running on
+ARROW_EXPORT int GetCurrentNumaNode();
+
+/// \brief Return the ids of the CPUs belonging to the given node
+ARROW_EXPORT Result<std::vector<int>> GetNumaNodeCpus(int node);
+
+/// \brief Restrict the calling thread to the CPUs of the given node, and
+/// prefer that node for the thread's future memory allocations
+ARROW_EXPORT Status BindCurrentThreadToNumaNode(int node);
+
+/// \brief Return the node on which the page holding `address` resides
+///
+/// The page must have been touched already, otherwise it isn't backed by
+/// physical memory and an error is returned.
+ARROW_EXPORT Result<int> GetNumaNodeOfAddress(const void* address);
+
+}  // namespace internal
+}  // namespace arrow
@@ -17,24 +17,39 @@
 
 #pragma once
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/numa.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace internal {
 
+// Return the thread pool to which task `task` out of `num_tasks` is dispatched.
+// With NUMA threading enabled, consecutive ranges of tasks go to consecutive
+// NUMA nodes, so that tasks working on neighbouring pieces of data (which were
+// likely allocated together) share a node.
+
+inline ThreadPool* GetParallelForThreadPool(int task, int num_tasks) {
+  if (!IsNumaThreadingEnabled()) {
+    return GetCpuThreadPool();
+  }
+  const int64_t num_nodes = GetNumaNodeCount();
+  return GetNumaThreadPool(static_cast<int>(task * num_nodes / num_tasks));
+}
+
 // A parallelizer that takes a `Status(int)` function and calls it with
 // arguments between 0 and `num_tasks - 1`, on an arbitrary number of threads.
 
 template <class FUNCTION>
 Status ParallelFor(int num_tasks, FUNCTION&& func) {
-  auto pool = internal::GetCpuThreadPool();
   std::vector<Future<Status>> futures(num_tasks);
 
   for (int i = 0; i < num_tasks; ++i) {
+    auto pool = GetParallelForThreadPool(i, num_tasks);
     ARROW_ASSIGN_OR_RAISE(futures[i], pool->Submit(func, i));
   }
   auto st = Status::OK();
@@ -28,8 +28,10 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/vendored/datetime.h"
 
 namespace arrow {
@@ -130,6 +132,53 @@ namespace detail {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// Parse exactly eight decimal digits at once, using 64-bit SWAR arithmetic.
+// Returns false if any of the characters is not a digit.
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t chunk = BitUtil::FromLittleEndian(
+      util::SafeLoadAs<uint64_t>(reinterpret_cast<const uint8_t*>(s)));
+  // Each byte must have the form 0x3X, with X <= 9
+  if (ARROW_PREDICT_FALSE(((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                           (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >>
+                            4)) != 0x3333333333333333ULL)) {
+    return false;
+  }
+  chunk -= 0x3030303030303030ULL;
+  // Combine adjacent digits pairwise, then pairs of pairs, then quads
+  chunk = (chunk * 10) + (chunk >> 8);
+  chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+           (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+          32;
+  *out = static_cast<uint32_t>(chunk);
+  return true;
+}
+
+// Parse a number that is known not to overflow the destination type,
+// consuming eight digits at a time.
+template <typename C_TYPE>
+inline bool ParseUnsignedNoOverflow(const char* s, size_t length, C_TYPE* out) {
+  C_TYPE result = 0;
+  while (length >= 8) {
+    uint32_t digits;
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &digits))) {
+      return false;
+    }
+    result = static_cast<C_TYPE>(result * 100000000U + digits);
+    s += 8;
+    length -= 8;
+  }
+  while (length > 0) {
+    uint8_t digit = ParseDecimalDigit(*s++);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = static_cast<C_TYPE>(result * 10U + digit);
+    length--;
+  }
+  *out = result;
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -189,6 +238,10 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  // Up to 9 digits cannot overflow
+  if (length >= 8 && length <= 9) {
+    return ParseUnsignedNoOverflow(s, length, out);
+  }
   uint32_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -208,6 +261,10 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  // Up to 19 digits cannot overflow
+  if (length >= 8 && length <= 19) {
+    return ParseUnsignedNoOverflow(s, length, out);
+  }
   uint64_t result = 0;
 
   PARSE_UNSIGNED_ITERATION(uint64_t);
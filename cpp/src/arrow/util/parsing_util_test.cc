@@ -204,12 +204,21 @@ TEST(StringConversion, ToUInt32) {
   AssertConversion(converter, "432198765", 432198765UL);
   AssertConversion(converter, "4294967295", 4294967295UL);
   AssertConversion(converter, "04294967295", 4294967295UL);
+  AssertConversion(converter, "12345678", 12345678UL);
+  AssertConversion(converter, "00000001", 1UL);
+  AssertConversion(converter, "999999999", 999999999UL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "4294967296");
   AssertConversionFails(converter, "12345678901");
 
+  // Non-digits in an eight-digit block
+  AssertConversionFails(converter, "1234567/");
+  AssertConversionFails(converter, ":2345678");
+  AssertConversionFails(converter, "1234 678");
+  AssertConversionFails(converter, "12345678e");
+
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
   AssertConversionFails(converter, "0.0");
@@ -240,11 +249,18 @@ TEST(StringConversion, ToUInt64) {
 
   AssertConversion(converter, "0", 0);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
+  AssertConversion(converter, "1234567890123456789", 1234567890123456789ULL);
+  AssertConversion(converter, "9999999999999999999", 9999999999999999999ULL);
+  AssertConversion(converter, "0000000000000000", 0ULL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
 
+  // Non-digits in an eight-digit block
+  AssertConversionFails(converter, "123456781234567\x87");
+  AssertConversionFails(converter, "1234567812345678.");
+
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
   AssertConversionFails(converter, "0.0");
@@ -18,6 +18,7 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <list>
@@ -28,6 +29,7 @@
 
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/numa.h"
 
 namespace arrow {
 namespace internal {
@@ -57,7 +59,14 @@ struct ThreadPool::State {
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
-                       std::list<std::thread>::iterator it) {
+                       std::list<std::thread>::iterator it, int numa_node) {
+  if (numa_node >= 0) {
+    Status st = BindCurrentThreadToNumaNode(numa_node);
+    if (!st.ok()) {
+      ARROW_LOG(WARNING) << "Failed to bind worker thread: " << st.ToString();
+    }
+  }
+
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
@@ -113,10 +122,11 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   }
 }
 
-ThreadPool::ThreadPool()
+ThreadPool::ThreadPool(int numa_node)
     : sp_state_(std::make_shared<ThreadPool::State>()),
       state_(sp_state_.get()),
-      shutdown_on_destroy_(true) {
+      shutdown_on_destroy_(true),
+      numa_node_(numa_node) {
 #ifndef _WIN32
   pid_ = getpid();
 #endif
@@ -218,11 +228,12 @@ void ThreadPool::CollectFinishedWorkersUnlocked() {
 
 void ThreadPool::LaunchWorkersUnlocked(int threads) {
   std::shared_ptr<State> state = sp_state_;
+  int numa_node = numa_node_;
 
   for (int i = 0; i < threads; i++) {
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    *it = std::thread([state, it, numa_node] { WorkerLoop(state, it, numa_node); });
   }
 }
 
@@ -246,6 +257,15 @@ Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
   return pool;
 }
 
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeForNumaNode(int node, int threads) {
+  if (node < 0 || node >= GetNumaNodeCount()) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool(node));
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  return pool;
+}
+
 Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
   ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
   // On Windows, the ThreadPool destructor may be called after non-main threads
@@ -311,6 +331,41 @@ ThreadPool* GetCpuThreadPool() {
   return singleton.get();
 }
 
+// ----------------------------------------------------------------------
+// Per-NUMA-node thread pools
+
+static std::vector<std::shared_ptr<ThreadPool>> MakeNumaThreadPools() {
+  std::vector<std::shared_ptr<ThreadPool>> pools;
+  const int num_nodes = GetNumaNodeCount();
+  for (int node = 0; node < num_nodes; ++node) {
+    // Size each pool after its node, falling back on an even share of the
+    // default capacity when the node's CPUs can't be determined.
+    int capacity = std::max(1, ThreadPool::DefaultCapacity() / num_nodes);
+    auto maybe_cpus = GetNumaNodeCpus(node);
+    if (maybe_cpus.ok() && !(*maybe_cpus).empty()) {
+      capacity = static_cast<int>((*maybe_cpus).size());
+    }
+    auto maybe_pool = ThreadPool::MakeForNumaNode(node, capacity);
+    if (!maybe_pool.ok()) {
+      maybe_pool.status().Abort("Failed to create NUMA thread pool");
+    }
+    pools.push_back(*std::move(maybe_pool));
+  }
+  return pools;
+}
+
+ThreadPool* GetNumaThreadPool(int node) {
+  if (!IsNumaAvailable()) {
+    return GetCpuThreadPool();
+  }
+  static std::vector<std::shared_ptr<ThreadPool>> singletons = MakeNumaThreadPools();
+  DCHECK_GE(node, 0);
+  DCHECK_LT(node, static_cast<int>(singletons.size()));
+  return singletons[node % singletons.size()].get();
+}
+
+static std::atomic<bool> numa_threading_enabled{false};
+
 }  // namespace internal
 
 int GetCpuThreadPoolCapacity() { return internal::GetCpuThreadPool()->GetCapacity(); }
@@ -319,4 +374,14 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+bool IsNumaThreadingEnabled() { return internal::numa_threading_enabled.load(); }
+
+Status SetNumaThreadingEnabled(bool enabled) {
+  if (enabled && !internal::IsNumaAvailable()) {
+    return Status::NotImplemented("NUMA support is not available in this Arrow build");
+  }
+  internal::numa_threading_enabled.store(enabled);
+  return Status::OK();
+}
+
 }  // namespace arrow
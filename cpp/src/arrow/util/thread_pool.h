@@ -58,6 +58,19 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 /// The current number is returned by GetCpuThreadPoolCapacity().
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+/// \brief Whether CPU-bound tasks are dispatched to NUMA-node-local thread pools
+///
+/// When enabled, helpers such as ParallelFor() and the dataset scanner
+/// spread their tasks over per-node thread pools whose workers are pinned
+/// to the CPUs of a single NUMA node.
+ARROW_EXPORT bool IsNumaThreadingEnabled();
+
+/// \brief Enable or disable dispatching of CPU-bound tasks to NUMA-node-local
+/// thread pools
+///
+/// Return NotImplemented if Arrow was built without NUMA support.
+ARROW_EXPORT Status SetNumaThreadingEnabled(bool enabled);
+
 namespace internal {
 
 namespace detail {
@@ -85,6 +98,13 @@ class ARROW_EXPORT ThreadPool {
   // with destruction late at process exit.
   static Result<std::shared_ptr<ThreadPool>> MakeEternal(int threads);
 
+  // Construct a thread pool whose workers are bound to the CPUs of the
+  // given NUMA node.
+  static Result<std::shared_ptr<ThreadPool>> MakeForNumaNode(int node, int threads);
+
+  // Return the NUMA node the workers are bound to, or -1 if unbound.
+  int numa_node() const { return numa_node_; }
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -159,7 +179,7 @@ class ARROW_EXPORT ThreadPool {
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
-  ThreadPool();
+  explicit ThreadPool(int numa_node = -1);
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
@@ -178,6 +198,7 @@ class ARROW_EXPORT ThreadPool {
   std::shared_ptr<State> sp_state_;
   State* state_;
   bool shutdown_on_destroy_;
+  int numa_node_;
 #ifndef _WIN32
   pid_t pid_;
 #endif
@@ -186,5 +207,10 @@ class ARROW_EXPORT ThreadPool {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+// Return the process-global thread pool for CPU-bound tasks whose workers
+// are bound to the given NUMA node.  Without NUMA support, this is the same
+// as GetCpuThreadPool().
+ARROW_EXPORT ThreadPool* GetNumaThreadPool(int node);
+
 }  // namespace internal
 }  // namespace arrow
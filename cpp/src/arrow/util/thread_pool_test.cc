@@ -37,6 +37,8 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/numa.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
@@ -351,6 +353,46 @@ TEST_F(TestThreadPool, ForkSafety) {
 }
 #endif
 
+TEST(TestNumaThreadPool, MakeForNumaNode) {
+  ASSERT_RAISES(Invalid, ThreadPool::MakeForNumaNode(-1, 2));
+  ASSERT_RAISES(Invalid, ThreadPool::MakeForNumaNode(GetNumaNodeCount(), 2));
+
+  for (int node = 0; node < GetNumaNodeCount(); ++node) {
+    ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::MakeForNumaNode(node, 2));
+    ASSERT_EQ(pool->numa_node(), node);
+    ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(GetCurrentNumaNode));
+    ASSERT_OK_AND_ASSIGN(int task_node, fut.result());
+    if (IsNumaAvailable()) {
+      ASSERT_EQ(task_node, node);
+    }
+    ASSERT_OK(pool->Shutdown());
+  }
+}
+
+TEST(TestNumaThreadPool, NumaThreading) {
+  ASSERT_FALSE(IsNumaThreadingEnabled());
+  if (!IsNumaAvailable()) {
+    ASSERT_RAISES(NotImplemented, SetNumaThreadingEnabled(true));
+    ASSERT_EQ(GetNumaThreadPool(0), GetCpuThreadPool());
+    return;
+  }
+  ASSERT_OK(SetNumaThreadingEnabled(true));
+  ASSERT_TRUE(IsNumaThreadingEnabled());
+
+  const int num_tasks = 4 * GetNumaNodeCount();
+  std::vector<int> nodes(num_tasks, -1);
+  ASSERT_OK(ParallelFor(num_tasks, [&](int i) {
+    nodes[i] = GetCurrentNumaNode();
+    return Status::OK();
+  }));
+  for (int i = 0; i < num_tasks; ++i) {
+    ASSERT_EQ(nodes[i], GetParallelForThreadPool(i, num_tasks)->numa_node());
+  }
+
+  ASSERT_OK(SetNumaThreadingEnabled(false));
+  ASSERT_FALSE(IsNumaThreadingEnabled());
+}
+
 TEST(TestGlobalThreadPool, Capacity) {
   // Sanity check
   auto pool = GetCpuThreadPool();
@@ -171,6 +171,94 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+// Return whether all bytes are ASCII.
+inline bool ValidateAscii(const uint8_t* data, int64_t size) {
+  static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
+  uint64_t bits = 0;
+
+  // OR together blocks of 64 bytes, a loop which compilers vectorize, and
+  // check the high bits once per block.
+  while (size >= 64) {
+    for (int i = 0; i < 8; ++i) {
+      uint64_t word;
+      memcpy(&word, data + i * 8, 8);
+      bits |= word;
+    }
+    if (bits & high_bits_64) {
+      return false;
+    }
+    size -= 64;
+    data += 64;
+  }
+  while (size-- > 0) {
+    bits |= *data++;
+  }
+  return (bits & high_bits_64) == 0;
+}
+
+// Return the number of codepoints in valid UTF8 data, that is the number of
+// bytes which are not continuation bytes.
+inline int64_t UTF8Length(const uint8_t* data, int64_t size) {
+  int64_t length = 0;
+  for (int64_t i = 0; i < size; ++i) {
+    length += (data[i] & 0xc0) != 0x80;
+  }
+  return length;
+}
+
+// Advance by at most n codepoints in valid UTF8 data, stopping at end.
+inline const uint8_t* UTF8AdvanceCodepoints(const uint8_t* data, const uint8_t* end,
+                                            int64_t n) {
+  for (; n > 0 && data < end; --n) {
+    ++data;
+    while (data < end && (*data & 0xc0) == 0x80) {
+      ++data;
+    }
+  }
+  return data;
+}
+
+// Decode the codepoint at *data and advance *data past it.
+// Return false if the data does not start with a complete, valid encoding.
+inline bool UTF8Decode(const uint8_t** data, const uint8_t* end, uint32_t* codepoint) {
+#ifndef NDEBUG
+  internal::CheckUTF8Initialized();
+#endif
+  const uint8_t* str = *data;
+  uint8_t state = internal::kUTF8DecodeAccept;
+  do {
+    if (str == end) {
+      return false;
+    }
+    state = internal::DecodeOneUTF8Byte(*str++, state, codepoint);
+  } while (state != internal::kUTF8DecodeAccept && state != internal::kUTF8DecodeReject);
+  if (state == internal::kUTF8DecodeReject) {
+    return false;
+  }
+  *data = str;
+  return true;
+}
+
+// Encode a valid codepoint and return the end of its encoding.
+inline uint8_t* UTF8Encode(uint8_t* str, uint32_t codepoint) {
+  if (codepoint < 0x80) {
+    *str++ = static_cast<uint8_t>(codepoint);
+  } else if (codepoint < 0x800) {
+    *str++ = static_cast<uint8_t>(0xc0 | (codepoint >> 6));
+    *str++ = static_cast<uint8_t>(0x80 | (codepoint & 0x3f));
+  } else if (codepoint < 0x10000) {
+    *str++ = static_cast<uint8_t>(0xe0 | (codepoint >> 12));
+    *str++ = static_cast<uint8_t>(0x80 | ((codepoint >> 6) & 0x3f));
+    *str++ = static_cast<uint8_t>(0x80 | (codepoint & 0x3f));
+  } else {
+    *str++ = static_cast<uint8_t>(0xf0 | (codepoint >> 18));
+    *str++ = static_cast<uint8_t>(0x80 | ((codepoint >> 12) & 0x3f));
+    *str++ = static_cast<uint8_t>(0x80 | ((codepoint >> 6) & 0x3f));
+    *str++ = static_cast<uint8_t>(0x80 | (codepoint & 0x3f));
+  }
+  return str;
+}
+
 // Skip UTF8 byte order mark, if any.
 ARROW_EXPORT
 Result<const uint8_t*> SkipUTF8BOM(const uint8_t* data, int64_t size);
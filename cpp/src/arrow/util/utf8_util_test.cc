@@ -251,6 +251,77 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST(ValidateAscii, Basics) {
+  auto Check = [](const std::string& s) -> bool {
+    return ValidateAscii(reinterpret_cast<const uint8_t*>(s.data()),
+                         static_cast<int64_t>(s.size()));
+  };
+
+  ASSERT_TRUE(Check(""));
+  ASSERT_TRUE(Check("abc"));
+  ASSERT_TRUE(Check(std::string(200, 'x')));
+  ASSERT_FALSE(Check("h\xc3\xa9h"));
+  // Non-ASCII byte in a 64-byte block and in the tail
+  for (size_t pos : {0, 10, 63, 64, 100, 199}) {
+    std::string s(200, 'x');
+    s[pos] = '\x80';
+    ASSERT_FALSE(Check(s)) << pos;
+  }
+}
+
+TEST_F(UTF8Test, Length) {
+  auto Length = [](const std::string& s) -> int64_t {
+    return UTF8Length(reinterpret_cast<const uint8_t*>(s.data()),
+                      static_cast<int64_t>(s.size()));
+  };
+
+  ASSERT_EQ(Length(""), 0);
+  ASSERT_EQ(Length("abc"), 3);
+  ASSERT_EQ(Length("h\xc3\xa9h\xc3\xa9"), 4);
+  for (const auto& s : all_valid_sequences) {
+    ASSERT_EQ(Length(s), 1);
+  }
+}
+
+TEST_F(UTF8Test, AdvanceCodepoints) {
+  const std::string s = "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80z";
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
+  const uint8_t* end = data + s.size();
+
+  ASSERT_EQ(UTF8AdvanceCodepoints(data, end, 0), data);
+  ASSERT_EQ(UTF8AdvanceCodepoints(data, end, 1), data + 1);
+  ASSERT_EQ(UTF8AdvanceCodepoints(data, end, 2), data + 3);
+  ASSERT_EQ(UTF8AdvanceCodepoints(data, end, 3), data + 6);
+  ASSERT_EQ(UTF8AdvanceCodepoints(data, end, 4), data + 10);
+  ASSERT_EQ(UTF8AdvanceCodepoints(data, end, 5), end);
+  ASSERT_EQ(UTF8AdvanceCodepoints(data, end, 100), end);
+}
+
+TEST_F(UTF8Test, DecodeEncode) {
+  uint8_t buffer[4];
+  for (const auto& s : all_valid_sequences) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
+    const uint8_t* end = data + s.size();
+    uint32_t codepoint;
+    ASSERT_TRUE(UTF8Decode(&data, end, &codepoint));
+    ASSERT_EQ(data, end);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(buffer),
+                          UTF8Encode(buffer, codepoint) - buffer),
+              s);
+  }
+  for (const auto& s : all_invalid_sequences) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
+    const uint8_t* end = data + s.size();
+    uint32_t codepoint;
+    ASSERT_FALSE(UTF8Decode(&data, end, &codepoint)) << s;
+  }
+  // Truncated sequence
+  const std::string truncated = "\xe2\x82";
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(truncated.data());
+  uint32_t codepoint;
+  ASSERT_FALSE(UTF8Decode(&data, data + truncated.size(), &codepoint));
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
@@ -669,8 +669,8 @@ jobjectArray JNICALL Java_org_apache_arrow_dataset_jni_JniWrapper_nextRecordBatc
       std::vector<std::shared_ptr<arrow::Array>> dict_datum;
       dict_datum.push_back(dict_data->dictionary());
       std::shared_ptr<arrow::RecordBatch>
-          dict_batch = arrow::RecordBatch::Make(dict_batch_schema, dict_data->length(),
-              dict_datum);
+          dict_batch = arrow::RecordBatch::Make(dict_batch_schema,
+              dict_data->dictionary()->length(), dict_datum);
       jobject dict_handle = createJavaDictionaryBatchHandle(env, dict_id++, dict_batch);
       handles.push_back(dict_handle);
     }
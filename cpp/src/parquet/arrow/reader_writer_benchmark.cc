@@ -165,7 +165,7 @@ BENCHMARK_TEMPLATE2(BM_WriteColumn, false, BooleanType);
 BENCHMARK_TEMPLATE2(BM_WriteColumn, true, BooleanType);
 
 template <bool nullable, typename ParquetType>
-static void BM_ReadColumn(::benchmark::State& state) {
+static void ReadColumn(::benchmark::State& state, ::arrow::MemoryPool* pool) {
   using T = typename ParquetType::c_type;
 
   std::vector<T> values(BENCHMARK_SIZE, static_cast<T>(128));
@@ -176,17 +176,28 @@ static void BM_ReadColumn(::benchmark::State& state) {
   PARQUET_ASSIGN_OR_THROW(auto buffer, output->Finish());
 
   while (state.KeepRunning()) {
-    auto reader =
-        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    auto reader = ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer), ReaderProperties(pool));
     std::unique_ptr<FileReader> arrow_reader;
-    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(), std::move(reader),
-                                 &arrow_reader));
+    EXIT_NOT_OK(FileReader::Make(pool, std::move(reader), &arrow_reader));
     std::shared_ptr<::arrow::Table> table;
     EXIT_NOT_OK(arrow_reader->ReadTable(&table));
   }
   SetBytesProcessed<nullable, ParquetType>(state);
 }
 
+template <bool nullable, typename ParquetType>
+static void BM_ReadColumn(::benchmark::State& state) {
+  ReadColumn<nullable, ParquetType>(state, ::arrow::default_memory_pool());
+}
+
+// Decode into huge page mappings which are recycled across iterations
+template <bool nullable, typename ParquetType>
+static void BM_ReadColumnHugePages(::benchmark::State& state) {
+  static ::arrow::HugePageMemoryPool pool(::arrow::default_memory_pool());
+  ReadColumn<nullable, ParquetType>(state, &pool);
+}
+
 BENCHMARK_TEMPLATE2(BM_ReadColumn, false, Int32Type);
 BENCHMARK_TEMPLATE2(BM_ReadColumn, true, Int32Type);
 
@@ -199,6 +210,12 @@ BENCHMARK_TEMPLATE2(BM_ReadColumn, true, DoubleType);
 BENCHMARK_TEMPLATE2(BM_ReadColumn, false, BooleanType);
 BENCHMARK_TEMPLATE2(BM_ReadColumn, true, BooleanType);
 
+BENCHMARK_TEMPLATE2(BM_ReadColumnHugePages, false, Int64Type);
+BENCHMARK_TEMPLATE2(BM_ReadColumnHugePages, true, Int64Type);
+
+BENCHMARK_TEMPLATE2(BM_ReadColumnHugePages, false, DoubleType);
+BENCHMARK_TEMPLATE2(BM_ReadColumnHugePages, true, DoubleType);
+
 static void BM_ReadIndividualRowGroups(::benchmark::State& state) {
   std::vector<int64_t> values(BENCHMARK_SIZE, 128);
   std::shared_ptr<::arrow::Table> table = TableFromVector<Int64Type>(values, true);
@@ -652,6 +652,10 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void AppendRowGroups(const std::unique_ptr<FileMetaDataImpl>& other) {
+    if (!schema()->Equals(*other->schema())) {
+      throw ParquetException("AppendRowGroups requires equal schemas.");
+    }
+
     format::RowGroup other_rg;
     for (int i = 0; i < other->num_row_groups(); i++) {
       other_rg = other->row_group(i);
@@ -805,6 +809,30 @@ void FileMetaData::AppendRowGroups(const FileMetaData& other) {
   impl_->AppendRowGroups(other.impl_);
 }
 
+std::shared_ptr<FileMetaData> FileMetaData::MakeSummary(
+    const std::vector<std::shared_ptr<FileMetaData>>& metadata,
+    const std::vector<std::string>& paths) {
+  if (metadata.empty() || metadata.size() != paths.size()) {
+    throw ParquetException("MakeSummary requires one path per footer, and at least one");
+  }
+
+  // Copy by round tripping through thrift, since set_file_path mutates
+  auto copy = [](const FileMetaData& original) {
+    std::string serialized = original.SerializeToString();
+    auto length = static_cast<uint32_t>(serialized.size());
+    return FileMetaData::Make(serialized.data(), &length);
+  };
+
+  auto summary = copy(*metadata[0]);
+  summary->set_file_path(paths[0]);
+  for (size_t i = 1; i < metadata.size(); ++i) {
+    auto file_metadata = copy(*metadata[i]);
+    file_metadata->set_file_path(paths[i]);
+    summary->AppendRowGroups(*file_metadata);
+  }
+  return summary;
+}
+
 void FileMetaData::WriteTo(::arrow::io::OutputStream* dst,
                            const std::shared_ptr<Encryptor>& encryptor) const {
   return impl_->WriteTo(dst, encryptor);
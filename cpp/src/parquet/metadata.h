@@ -261,9 +261,21 @@ class PARQUET_EXPORT FileMetaData {
   // Set file_path ColumnChunk fields to a particular value
   void set_file_path(const std::string& path);
 
-  // Merge row-group metadata from "other" FileMetaData object
+  // Merge row-group metadata from "other" FileMetaData object. Throws if the schemas
+  // of the two objects differ.
   void AppendRowGroups(const FileMetaData& other);
 
+  /// \brief Merge the footers of the files of a dataset into the metadata of a
+  /// `_metadata` summary file, which may then be written with WriteMetaDataFile.
+  ///
+  /// The row groups of each footer are appended in order, with the file_path of their
+  /// column chunks set to the corresponding entry of paths (by convention, relative to
+  /// the directory containing the summary file). Key-value metadata is taken from the
+  /// first footer. The footers are not modified. Throws if their schemas differ.
+  static std::shared_ptr<FileMetaData> MakeSummary(
+      const std::vector<std::shared_ptr<FileMetaData>>& metadata,
+      const std::vector<std::string>& paths);
+
  private:
   friend FileMetaDataBuilder;
   friend class SerializedFile;
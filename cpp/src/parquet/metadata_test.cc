@@ -214,6 +214,50 @@ TEST(Metadata, TestBuildAccess) {
   ASSERT_EQ(3, f_accessor->num_schema_elements());
 }
 
+TEST(Metadata, TestMakeSummary) {
+  parquet::schema::NodeVector fields;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  parquet::SchemaDescriptor schema;
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+
+  auto props = WriterProperties::Builder().build();
+  int64_t nrows = 1000;
+  EncodedStatistics stats;
+  std::shared_ptr<FileMetaData> a =
+      GenerateTableMetaData(schema, props, nrows, stats, stats);
+  std::shared_ptr<FileMetaData> b =
+      GenerateTableMetaData(schema, props, nrows, stats, stats);
+
+  auto summary = FileMetaData::MakeSummary({a, b}, {"x=1/a.parquet", "x=2/b.parquet"});
+  ASSERT_EQ(4, summary->num_row_groups());
+  ASSERT_EQ(2 * nrows, summary->num_rows());
+  ASSERT_TRUE(summary->schema()->Equals(schema));
+  ASSERT_EQ("x=1/a.parquet", summary->RowGroup(1)->ColumnChunk(1)->file_path());
+  ASSERT_EQ("x=2/b.parquet", summary->RowGroup(2)->ColumnChunk(0)->file_path());
+
+  // the footers themselves are untouched
+  ASSERT_TRUE(a->RowGroup(0)->ColumnChunk(0)->file_path().empty());
+  ASSERT_EQ(2, a->num_row_groups());
+
+  // the summary survives serialization
+  std::string serialized = summary->SerializeToString();
+  auto length = static_cast<uint32_t>(serialized.size());
+  auto deserialized = FileMetaData::Make(serialized.data(), &length);
+  ASSERT_EQ(4, deserialized->num_row_groups());
+  ASSERT_EQ("x=2/b.parquet", deserialized->RowGroup(3)->ColumnChunk(1)->file_path());
+
+  // schemas must match
+  parquet::SchemaDescriptor other_schema;
+  fields[1] = parquet::schema::Float("other_col", Repetition::REQUIRED);
+  other_schema.Init(
+      parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  std::shared_ptr<FileMetaData> c =
+      GenerateTableMetaData(other_schema, props, nrows, stats, stats);
+  ASSERT_THROW(FileMetaData::MakeSummary({a, c}, {"a", "c"}), ParquetException);
+  ASSERT_THROW(FileMetaData::MakeSummary({a}, {"a", "c"}), ParquetException);
+}
+
 TEST(Metadata, TestV1Version) {
   // PARQUET-839
   parquet::schema::NodeVector fields;
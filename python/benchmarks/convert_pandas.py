@@ -72,6 +72,59 @@ class ToPandasStrings(object):
         self.arr.to_pandas(deduplicate_objects=False)
 
 
+class ToPandasManyColumns(object):
+
+    param_names = ('dtype', 'use_threads', 'split_blocks')
+    params = (('str', 'int64'), (False, True), (False, True))
+    nrows = 100000
+    ncols = 20
+
+    def setup(self, dtype, use_threads, split_blocks):
+        if dtype == 'str':
+            values = pa.array([tm.rands(10) for i in range(self.nrows)])
+        else:
+            values = pa.array(np.arange(self.nrows, dtype=dtype))
+        self.table = pa.Table.from_arrays([values] * self.ncols,
+                                          [str(i) for i in range(self.ncols)])
+
+    def time_to_pandas(self, dtype, use_threads, split_blocks):
+        self.table.to_pandas(use_threads=use_threads,
+                             split_blocks=split_blocks)
+
+
+class ToPandasCategorical(object):
+
+    param_names = ('num_chunks',)
+    params = ((1, 100),)
+    total = 1000000
+
+    def setup(self, num_chunks):
+        dictionary = pa.array([tm.rands(10) for i in range(1000)])
+        indices = pa.array(np.random.randint(0, 1000, self.total // num_chunks,
+                                             dtype='int32'))
+        chunk = pa.DictionaryArray.from_arrays(indices, dictionary)
+        self.arr = pa.chunked_array([chunk] * num_chunks)
+
+    def time_to_pandas(self, num_chunks):
+        self.arr.to_pandas()
+
+
+class ToPandasTimestamps(object):
+
+    param_names = ('unit', 'tz')
+    params = (('s', 'us', 'ns'), (None, 'America/New_York'))
+    total = 1000000
+
+    def setup(self, unit, tz):
+        values = np.arange(self.total, dtype='int64')
+        self.arr = pa.array(values, type=pa.timestamp(unit, tz=tz))
+        # Two chunks to prevent zero-copy conversion
+        self.arr = pa.chunked_array([self.arr, self.arr])
+
+    def time_to_pandas(self, unit, tz):
+        self.arr.to_pandas()
+
+
 class ZeroCopyPandasRead(object):
 
     def setup(self):
@@ -43,3 +43,26 @@ class PandasObjectIsNull(object):
 
     def time_PandasObjectIsNull(self, *args):
         pb.benchmark_PandasObjectIsNull(self.lst)
+
+
+class PyUnicodeFromUtf8(object):
+    size = 10 ** 5
+    types = ('ascii', 'unicode')
+
+    param_names = ['type']
+    params = [types]
+
+    def setup(self, type_name):
+        gen = common.BuiltinsGenerator()
+        if type_name == 'ascii':
+            lst = gen.generate_ascii_string_list(self.size, 10, 30,
+                                                 none_prob=0)
+        elif type_name == 'unicode':
+            lst = gen.generate_unicode_string_list(self.size, 10, 30,
+                                                   none_prob=0)
+        else:
+            assert 0
+        self.lst = [s.encode('utf8') for s in lst]
+
+    def time_PyUnicode_FromUtf8(self, *args):
+        pb.benchmark_PyUnicode_FromUtf8(self.lst)
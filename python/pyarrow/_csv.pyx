@@ -624,7 +624,9 @@ def open_csv(input_file, read_options=None, parse_options=None,
     """
     Open a streaming reader of CSV data.
 
-    Reading using this function is always single-threaded.
+    If `read_options.use_threads` is true, blocks are parsed and converted
+    in parallel, while batches are still yielded in file order.  Only a
+    bounded number of blocks is read ahead of the consumer.
 
     Parameters
     ----------
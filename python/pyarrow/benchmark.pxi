@@ -18,3 +18,7 @@
 
 def benchmark_PandasObjectIsNull(list obj):
     Benchmark_PandasObjectIsNull(obj)
+
+
+def benchmark_PyUnicode_FromUtf8(list obj):
+    Benchmark_PyUnicode_FromUtf8(obj)
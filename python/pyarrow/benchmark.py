@@ -18,4 +18,5 @@
 # flake8: noqa
 
 
-from pyarrow.lib import benchmark_PandasObjectIsNull
+from pyarrow.lib import (benchmark_PandasObjectIsNull,
+                         benchmark_PyUnicode_FromUtf8)
@@ -1798,6 +1798,7 @@ cdef extern from 'arrow/python/extension_type.h' namespace 'arrow::py':
 
 cdef extern from 'arrow/python/benchmark.h' namespace 'arrow::py::benchmark':
     void Benchmark_PandasObjectIsNull(object lst) except *
+    void Benchmark_PyUnicode_FromUtf8(object lst) except *
 
 
 cdef extern from 'arrow/util/compression.h' namespace 'arrow' nogil:
@@ -1039,6 +1039,28 @@ class TestSerialStreamingCSVRead(BaseTestStreamingCSVRead, unittest.TestCase):
         assert pa.total_allocated_bytes() == old_allocated
 
 
+class TestParallelStreamingCSVRead(BaseTestStreamingCSVRead,
+                                   unittest.TestCase):
+
+    def open_csv(self, *args, **kwargs):
+        read_options = kwargs.setdefault('read_options', ReadOptions())
+        read_options.use_threads = True
+        return open_csv(*args, **kwargs)
+
+    def test_batch_order(self):
+        # Many small blocks are parsed concurrently but must be
+        # delivered in file order
+        num_rows = 10000
+        rows = b"a,b\n" + b"".join(b"%d,%d\n" % (i, -i)
+                                   for i in range(num_rows))
+        read_options = ReadOptions(block_size=1000)
+        reader = self.open_bytes(rows, read_options=read_options)
+        table = reader.read_all()
+        assert table.num_rows == num_rows
+        assert table.column('a').to_pylist() == list(range(num_rows))
+        assert table.column('b').to_pylist() == [-i for i in range(num_rows)]
+
+
 class BaseTestCompressedCSVRead:
 
     def setUp(self):
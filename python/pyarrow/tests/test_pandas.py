@@ -3165,6 +3165,26 @@ def test_to_pandas_split_blocks():
     _check_to_pandas_memory_unchanged(t, split_blocks=True)
 
 
+@pytest.mark.parametrize('use_threads', [False, True])
+def test_to_pandas_split_blocks_mixed_types(use_threads):
+    strings = ['foo', None, 'mañana', 'x' * 20]
+    dict_chunk = pa.DictionaryArray.from_arrays(
+        pa.array([0, 1, 1, 0], type='i1'), pa.array(['a', 'b']))
+    t = pa.table([
+        pa.chunked_array([pa.array(strings), pa.array(strings)]),
+        pa.chunked_array([pa.array([1, None, 3, 4], type='i8')] * 2),
+        pa.chunked_array([dict_chunk, dict_chunk]),
+        pa.chunked_array([pa.array([1, None, 3, 4],
+                                   type=pa.timestamp('s', tz='UTC'))] * 2),
+    ], ['strings', 'ints', 'categories', 'timestamps'])
+
+    result = t.to_pandas(split_blocks=True, use_threads=use_threads)
+    expected = t.to_pandas(use_threads=False)
+    tm.assert_frame_equal(result, expected)
+    assert result['strings'].tolist() == strings * 2
+    assert result['categories'].tolist() == ['a', 'b', 'b', 'a'] * 2
+
+
 def _check_blocks_created(t, number):
     x = t.to_pandas(split_blocks=True)
     assert len(x._data.blocks) == number